@@ -1381,6 +1381,13 @@ void hhHunterSimple::Event_CallBackup( float delay ) {
 	}
 }
 
+// CanSee also updates AI_ENEMY_SHOOTABLE, so every entity is left to it
+void hhHunterSimple::CanSeeBatch( idEntity * const *ents, int numEnts, bool useFov, int *results ) {
+	for ( int i = 0; i < numEnts; i++ ) {
+		results[i] = SIGHT_CHECK;
+	}
+}
+
 bool hhHunterSimple::CanSee( idEntity *ent, bool useFov ) {
 	trace_t		tr;
 	idVec3		eye;
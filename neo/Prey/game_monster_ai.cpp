@@ -727,6 +727,19 @@ bool hhMonsterAI::CanSee( idEntity *ent, bool useFov ) {
 	return false;
 }
 
+//
+// CanSeeBatch
+//
+// The same line of sight test as CanSee, looking through portals is still done by CanSee
+//
+void hhMonsterAI::CanSeeBatch( idEntity * const *ents, int numEnts, bool useFov, int *results ) {
+	if ( InVehicle() ) {
+		TraceSightBatch( ents, numEnts, useFov, true, GetVehicleInterface()->GetVehicle(), SIGHT_BLOCKED, results );
+	} else {
+		TraceSightBatch( ents, numEnts, useFov, true, this, ( bSeeThroughPortals && aas ) ? SIGHT_CHECK : SIGHT_BLOCKED, results );
+	}
+}
+
 idPlayer* hhMonsterAI::GetClosestPlayer(void) {
 	idEntity *closestEnt = NULL;
 	float closestDist = idMath::INFINITY;	
@@ -79,6 +79,7 @@ public:
 	virtual bool	TurnToward( const idVec3 &pos );
 	ID_INLINE virtual bool TurnToward( float yaw ) { return idAI::TurnToward( yaw ); } // HUMANHEAD mdl:  Needed because of bizarre inheritance issue that resulted in TurnToward(idVec3) being called 
 	virtual bool	CanSee( idEntity *ent, bool useFov );
+	virtual void	CanSeeBatch( idEntity * const *ents, int numEnts, bool useFOV, int *results );
 	idPlayer*		GetClosestPlayer( void );
 	void			Show();
 	bool			GetFacePosAngle( const idVec3 &pos, float &delta );
@@ -765,8 +765,25 @@ gameReturn_t hhGameLocal::RunFrame( const usercmd_t *clientCmds, int activeEdito
 		// sort the active entity list
 		SortActiveEntityList();
 
+		// rebuild some of the routing cache flushed by doors and obstacles
+		for( int i = 0; i < aasList.Num(); i++ ) {
+			aasList[ i ]->UpdateRoutingCache( aas_routingCacheMsec.GetFloat() );
+		}
+
 		timer_think.Clear();
 		timer_think.Start();
+
+		// solve the articulated figures that are on their own ahead of the think loop
+		if ( !inCinematic ) {
+			physicsIslands.Solve();
+		}
+
+		// blend the animation frames the entities are going to create on the job workers
+		thinkScheduler.BeginFrame();
+		if ( !inCinematic ) {
+			thinkScheduler.BlendAnimations();
+		}
+
 		PROFILE_START("Misc_Think", PROFMASK_NORMAL);	// HUMANHEAD pdm
 
 		// HUMANHEAD pdm: This loop reworked to support debugger and dormant timings
@@ -856,6 +873,7 @@ gameReturn_t hhGameLocal::RunFrame( const usercmd_t *clientCmds, int activeEdito
 		PROFILE_STOP("Misc_Think", PROFMASK_NORMAL);
 
 		timer_think.Stop();
+		thinkScheduler.EndFrame();
 		timer_events.Clear();
 		timer_events.Start();
 
@@ -45,6 +45,12 @@ If you have questions concerning this license or the applicable additional terms
 	A translation with start == end or a rotation with angle == 0 performs
 	a position test and fills in the trace_t structure accordingly.
 
+	Translations, rotations, contents and contact queries can be issued from
+	the main thread and the job workers at the same time, every thread traces
+	with its own check stamps and trace model.  The handle returned by
+	SetupTrmModel is only valid on the thread that set it up.  Loading and
+	freeing models must still be done on the main thread while no traces run.
+
 ===============================================================================
 */
 
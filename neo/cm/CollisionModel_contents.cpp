@@ -59,10 +59,10 @@ bool idCollisionModelManagerLocal::TestTrmVertsInBrush( cm_traceWork_t *tw, cm_b
 	float d, bestd;
 	idVec3 *p;
 
-	if ( b->checkcount == idCollisionModelManagerLocal::checkCount ) {
+	if ( CM_BrushCheck( tw, b ) == tw->checkCount ) {
 		return false;
 	}
-	b->checkcount = idCollisionModelManagerLocal::checkCount;
+	CM_BrushCheck( tw, b ) = tw->checkCount;
 
 	if ( !(b->contents & tw->contents) ) {
 		return false;
@@ -131,10 +131,10 @@ CM_SetTrmEdgeSidedness
 CM_SetTrmPolygonSidedness
 ================
 */
-#define CM_SetTrmPolygonSidedness( v, plane, bitNum ) {								\
+#define CM_SetTrmPolygonSidedness( v, p, plane, bitNum ) {							\
 	if ( !((v)->sideSet & (1<<bitNum)) ) {											\
 		float fl;																	\
-		fl = plane.Distance( (v)->p );												\
+		fl = plane.Distance( p );													\
 		/* cannot use float sign bit because it is undetermined when fl == 0.0f */	\
 		if ( fl < 0.0f ) {															\
 			(v)->side |= (1 << bitNum);												\
@@ -159,13 +159,14 @@ bool idCollisionModelManagerLocal::TestTrmInPolygon( cm_traceWork_t *tw, cm_poly
 	float d, bestd;
 	cm_trmEdge_t *trmEdge;
 	cm_edge_t *edge;
-	cm_vertex_t *v, *v1, *v2;
+	cm_vertex_t *v;
+	cm_sideCheck_t *edgeCheck, *vertexCheck, *v1, *v2;
 
 	// if already checked this polygon
-	if ( p->checkcount == idCollisionModelManagerLocal::checkCount ) {
+	if ( CM_PolygonCheck( tw, p ) == tw->checkCount ) {
 		return false;
 	}
-	p->checkcount = idCollisionModelManagerLocal::checkCount;
+	CM_PolygonCheck( tw, p ) = tw->checkCount;
 
 	// if this polygon does not have the right contents behind it
 	if ( !(p->contents & tw->contents) ) {
@@ -197,14 +198,14 @@ bool idCollisionModelManagerLocal::TestTrmInPolygon( cm_traceWork_t *tw, cm_poly
 			edgeNum = p->edges[i];
 			edge = tw->model->edges + abs(edgeNum);
 			// if this edge is already tested
-			if ( edge->checkcount == idCollisionModelManagerLocal::checkCount ) {
+			if ( CM_EdgeCheck( tw, edge )->checkcount == tw->checkCount ) {
 				continue;
 			}
 
 			for ( j = 0; j < 2; j++ ) {
 				v = &tw->model->vertices[edge->vertexNum[j]];
 				// if this vertex is already tested
-				if ( v->checkcount == idCollisionModelManagerLocal::checkCount ) {
+				if ( CM_VertexCheck( tw, v )->checkcount == tw->checkCount ) {
 					continue;
 				}
 
@@ -239,19 +240,20 @@ bool idCollisionModelManagerLocal::TestTrmInPolygon( cm_traceWork_t *tw, cm_poly
 	for ( i = 0; i < p->numEdges; i++ ) {
 		edgeNum = p->edges[i];
 		edge = tw->model->edges + abs(edgeNum);
+		edgeCheck = CM_EdgeCheck( tw, edge );
 		// reset sidedness cache if this is the first time we encounter this edge
-		if ( edge->checkcount != idCollisionModelManagerLocal::checkCount ) {
-			edge->sideSet = 0;
+		if ( edgeCheck->checkcount != tw->checkCount ) {
+			edgeCheck->sideSet = 0;
 		}
 		// pluecker coordinate for edge
 		tw->polygonEdgePlueckerCache[i].FromLine( tw->model->vertices[edge->vertexNum[0]].p,
 													tw->model->vertices[edge->vertexNum[1]].p );
-		v = &tw->model->vertices[edge->vertexNum[INTSIGNBITSET(edgeNum)]];
+		vertexCheck = &tw->checks->vertices[edge->vertexNum[INTSIGNBITSET(edgeNum)]];
 		// reset sidedness cache if this is the first time we encounter this vertex
-		if ( v->checkcount != idCollisionModelManagerLocal::checkCount ) {
-			v->sideSet = 0;
+		if ( vertexCheck->checkcount != tw->checkCount ) {
+			vertexCheck->sideSet = 0;
 		}
-		v->checkcount = idCollisionModelManagerLocal::checkCount;
+		vertexCheck->checkcount = tw->checkCount;
 	}
 
 	// get side of polygon for each trm vertex
@@ -271,10 +273,10 @@ bool idCollisionModelManagerLocal::TestTrmInPolygon( cm_traceWork_t *tw, cm_poly
 		// test if trm edge goes through the polygon between the polygon edges
 		for ( j = 0; j < p->numEdges; j++ ) {
 			edgeNum = p->edges[j];
-			edge = tw->model->edges + abs(edgeNum);
+			edgeCheck = &tw->checks->edges[abs(edgeNum)];
 #if 1
-			CM_SetTrmEdgeSidedness( edge, tw->edges[i].pl, tw->polygonEdgePlueckerCache[j], i );
-			if ( INTSIGNBITSET(edgeNum) ^ ((edge->side >> i) & 1) ^ flip ) {
+			CM_SetTrmEdgeSidedness( edgeCheck, tw->edges[i].pl, tw->polygonEdgePlueckerCache[j], i );
+			if ( INTSIGNBITSET(edgeNum) ^ ((edgeCheck->side >> i) & 1) ^ flip ) {
 				break;
 			}
 #else
@@ -312,17 +314,18 @@ bool idCollisionModelManagerLocal::TestTrmInPolygon( cm_traceWork_t *tw, cm_poly
 	for ( i = 0; i < p->numEdges; i++ ) {
 		edgeNum = p->edges[i];
 		edge = tw->model->edges + abs(edgeNum);
-		if ( edge->checkcount == idCollisionModelManagerLocal::checkCount ) {
+		edgeCheck = CM_EdgeCheck( tw, edge );
+		if ( edgeCheck->checkcount == tw->checkCount ) {
 			continue;
 		}
-		edge->checkcount = idCollisionModelManagerLocal::checkCount;
+		edgeCheck->checkcount = tw->checkCount;
 
 		for ( j = 0; j < tw->numPolys; j++ ) {
 #if 1
-			v1 = tw->model->vertices + edge->vertexNum[0];
-			CM_SetTrmPolygonSidedness( v1, tw->polys[j].plane, j );
-			v2 = tw->model->vertices + edge->vertexNum[1];
-			CM_SetTrmPolygonSidedness( v2, tw->polys[j].plane, j );
+			v1 = &tw->checks->vertices[edge->vertexNum[0]];
+			CM_SetTrmPolygonSidedness( v1, tw->model->vertices[edge->vertexNum[0]].p, tw->polys[j].plane, j );
+			v2 = &tw->checks->vertices[edge->vertexNum[1]];
+			CM_SetTrmPolygonSidedness( v2, tw->model->vertices[edge->vertexNum[1]].p, tw->polys[j].plane, j );
 			// if the polygon edge does not cross the trm polygon plane
 			if ( !(((v1->side ^ v2->side) >> j) & 1) ) {
 				continue;
@@ -350,8 +353,8 @@ bool idCollisionModelManagerLocal::TestTrmInPolygon( cm_traceWork_t *tw, cm_poly
 				trmEdge = tw->edges + abs(trmEdgeNum);
 #if 1
 				bitNum = abs(trmEdgeNum);
-				CM_SetTrmEdgeSidedness( edge, trmEdge->pl, tw->polygonEdgePlueckerCache[i], bitNum );
-				if ( INTSIGNBITSET(trmEdgeNum) ^ ((edge->side >> bitNum) & 1) ^ flip ) {
+				CM_SetTrmEdgeSidedness( edgeCheck, trmEdge->pl, tw->polygonEdgePlueckerCache[i], bitNum );
+				if ( INTSIGNBITSET(trmEdgeNum) ^ ((edgeCheck->side >> bitNum) & 1) ^ flip ) {
 					break;
 				}
 #else
@@ -423,7 +426,7 @@ int idCollisionModelManagerLocal::PointContents( const idVec3 p, cmHandle_t mode
 	cm_brush_t *b;
 	idPlane *plane;
 
-	node = idCollisionModelManagerLocal::PointNode( p, idCollisionModelManagerLocal::models[model] );
+	node = idCollisionModelManagerLocal::PointNode( p, GetTraceModel( GetTraceContext(), model ) );
 	for ( bref = node->brushes; bref; bref = bref->next ) {
 		b = bref->b;
 		// test if the point is within the brush bounds
@@ -483,6 +486,7 @@ int idCollisionModelManagerLocal::ContentsTrm( trace_t *results, const idVec3 &s
 	idMat3 invModelAxis, tmpAxis;
 	idVec3 dir;
 	ALIGN16( cm_traceWork_t tw );
+	cm_traceContext_t *context;
 
 	// fast point case
 	if ( !trm || ( trm->bounds[1][0] - trm->bounds[0][0] <= 0.0f &&
@@ -497,7 +501,7 @@ int idCollisionModelManagerLocal::ContentsTrm( trace_t *results, const idVec3 &s
 		return results->c.contents;
 	}
 
-	idCollisionModelManagerLocal::checkCount++;
+	context = GetTraceContext();
 
 	tw.trace.fraction = 1.0f;
 	tw.trace.c.contents = 0;
@@ -511,7 +515,8 @@ int idCollisionModelManagerLocal::ContentsTrm( trace_t *results, const idVec3 &s
 	tw.pointTrace = false;
 	tw.quickExit = false;
 	tw.numContacts = 0;
-	tw.model = idCollisionModelManagerLocal::models[model];
+	tw.model = GetTraceModel( context, model );
+	SetupTraceChecks( &tw, context, model );
 	tw.start = start - modelOrigin;
 	tw.end = tw.start;
 
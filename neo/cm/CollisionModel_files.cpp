@@ -327,8 +327,6 @@ void idCollisionModelManagerLocal::ParseVertices( idLexer *src, cm_model_t *mode
 	model->vertices = (cm_vertex_t *) Mem_Alloc( model->maxVertices * sizeof( cm_vertex_t ) );
 	for ( i = 0; i < model->numVertices; i++ ) {
 		src->Parse1DMatrix( 3, model->vertices[i].p.ToFloatPtr() );
-		model->vertices[i].side = 0;
-		model->vertices[i].sideSet = 0;
 		model->vertices[i].checkcount = 0;
 	}
 	src->ExpectTokenString( "}" );
@@ -351,8 +349,6 @@ void idCollisionModelManagerLocal::ParseEdges( idLexer *src, cm_model_t *model )
 		model->edges[i].vertexNum[0] = src->ParseInt();
 		model->edges[i].vertexNum[1] = src->ParseInt();
 		src->ExpectTokenString( ")" );
-		model->edges[i].side = 0;
-		model->edges[i].sideSet = 0;
 		model->edges[i].internal = src->ParseInt();
 		model->edges[i].numUsers = src->ParseInt();
 		model->edges[i].normal = vec3_origin;
@@ -565,6 +561,12 @@ bool idCollisionModelManagerLocal::LoadCollisionModelFile( const char *name, uns
 	idToken token;
 	idLexer *src;
 	unsigned int crc;
+	int firstModel;
+
+	// use the binary cache if it is up to date
+	if ( LoadBinaryCollisionModelFile( name, mapFileCRC ) ) {
+		return true;
+	}
 
 	// load it
 	fileName = name;
@@ -602,6 +604,7 @@ bool idCollisionModelManagerLocal::LoadCollisionModelFile( const char *name, uns
 	}
 
 	// parse the file
+	firstModel = numModels;
 	while ( 1 ) {
 		if ( !src->ReadToken( &token ) ) {
 			break;
@@ -620,5 +623,797 @@ bool idCollisionModelManagerLocal::LoadCollisionModelFile( const char *name, uns
 
 	delete src;
 
+	// write the binary cache so the next load doesn't have to parse the text
+	WriteBinaryCollisionModelsToFile( name, firstModel, numModels, crc );
+
+	return true;
+}
+
+
+/*
+===============================================================================
+
+Binary collision model cache
+
+	After a text .cm file has been parsed the models are written to a .cmb
+	file next to it. The next load reads the .cmb with a single file read and
+	only has to copy the lumps into the model structures, the bsp tree with
+	the polygon and brush references is stored as well so nothing has to be
+	filtered into the tree again. All offsets are relative to the start of the
+	model so the models don't depend on where the file is loaded.
+
+	The cache is ignored when its crc doesn't match, when it was written for
+	another map geometry crc, when the .cm file is newer, or when it was
+	written with a different byte order. The text file is parsed instead and
+	the cache is written again.
+
+===============================================================================
+*/
+
+#define CMB_FILE_EXT		"cmb"
+#define CMB_IDENT			( ( 'B' << 24 ) + ( 'M' << 16 ) + ( 'C' << 8 ) + 'I' )
+#define CMB_VERSION			1
+
+static idCVar cm_binaryCache(	"cm_binaryCache",	"1",		CVAR_GAME | CVAR_BOOL,	"read and write binary .cmb caches of the collision model files" );
+
+typedef struct cmbHeader_s {
+	int						ident;
+	int						version;
+	unsigned int			mapFileCRC;			// map file crc of the .cm file
+	unsigned int			dataCRC;			// crc of everything after the header
+	int						dataSize;
+	int						numModels;
+} cmbHeader_t;
+
+typedef struct cmbModel_s {
+	int						size;				// size of the model with all its lumps
+	int						nameOfs;
+	idBounds				bounds;
+	int						contents;
+	int						numInternalEdges;
+	int						numSharpEdges;
+	int						numVertices;
+	int						vertexOfs;			// idVec3
+	int						numEdges;
+	int						edgeOfs;			// cmbEdge_t
+	int						numNodes;
+	int						nodeOfs;			// cmbNode_t, depth first with the head node first
+	int						numPolygons;
+	int						polygonOfs;			// cmbPolygon_t
+	int						numPolygonEdges;
+	int						polygonEdgeOfs;		// int
+	int						numBrushes;
+	int						brushOfs;			// cmbBrush_t
+	int						numBrushPlanes;
+	int						brushPlaneOfs;		// idPlane
+	int						numPolygonRefs;
+	int						polygonRefOfs;		// int, polygon number, in the order of the node lists
+	int						numBrushRefs;
+	int						brushRefOfs;		// int, brush number, in the order of the node lists
+	int						numMaterials;
+	int						materialOfs;		// int, offset of the material name
+} cmbModel_t;
+
+typedef struct cmbEdge_s {
+	int						vertexNum[2];
+	unsigned short			internal;
+	unsigned short			numUsers;
+	idVec3					normal;
+} cmbEdge_t;
+
+typedef struct cmbNode_s {
+	int						planeType;
+	float					planeDist;
+	int						children[2];
+	int						firstPolygonRef;
+	int						numPolygonRefs;
+	int						firstBrushRef;
+	int						numBrushRefs;
+} cmbNode_t;
+
+typedef struct cmbPolygon_s {
+	int						material;
+	idPlane					plane;
+	idBounds				bounds;
+	int						firstEdge;
+	int						numEdges;
+} cmbPolygon_t;
+
+typedef struct cmbBrush_s {
+	int						contents;
+	idBounds				bounds;
+	int						firstPlane;
+	int						numPlanes;
+} cmbBrush_t;
+
+/*
+================
+CMB_Align
+================
+*/
+static ID_INLINE int CMB_Align( int size ) {
+	return ( size + 3 ) & ~3;
+}
+
+/*
+================
+CMB_GatherNodes_r
+================
+*/
+static int CMB_GatherNodes_r( cm_node_t *node, idList<cm_node_t *> &nodes, idList<int> &children ) {
+	int index, child;
+
+	index = nodes.Append( node );
+	children.Append( -1 );
+	children.Append( -1 );
+	if ( node->planeType != -1 ) {
+		child = CMB_GatherNodes_r( node->children[0], nodes, children );
+		children[index * 2 + 0] = child;
+		child = CMB_GatherNodes_r( node->children[1], nodes, children );
+		children[index * 2 + 1] = child;
+	}
+	return index;
+}
+
+/*
+================
+idCollisionModelManagerLocal::WriteBinaryCollisionModel
+
+  returns the model in the binary layout, free with Mem_Free
+================
+*/
+byte *idCollisionModelManagerLocal::WriteBinaryCollisionModel( cm_model_t *model, int &size ) {
+	int i, j, ofs;
+	idList<cm_node_t *> nodes;
+	idList<int> children;
+	idList<cm_polygon_t *> polygons;
+	idList<int> polygonMaterials;
+	idList<cm_brush_t *> brushes;
+	idList<const idMaterial *> materials;
+	idHashIndex materialHash;
+	idList<int> polygonRefs, brushRefs;
+	int *polygonNums, *brushNums;
+	int numPolygonEdges, numBrushPlanes, stringSize;
+	cm_polygonRef_t *pref;
+	cm_brushRef_t *bref;
+	cmbModel_t *out;
+	byte *data;
+
+	CMB_GatherNodes_r( model->node, nodes, children );
+
+	// number the polygons and brushes in the order they are first referenced
+	polygonNums = (int *) Mem_Alloc( ( model->numPolygonChecks + 1 ) * sizeof( int ) );
+	brushNums = (int *) Mem_Alloc( ( model->numBrushChecks + 1 ) * sizeof( int ) );
+	memset( polygonNums, -1, ( model->numPolygonChecks + 1 ) * sizeof( int ) );
+	memset( brushNums, -1, ( model->numBrushChecks + 1 ) * sizeof( int ) );
+
+	numPolygonEdges = numBrushPlanes = 0;
+	stringSize = CMB_Align( model->name.Length() + 1 );
+	for ( i = 0; i < nodes.Num(); i++ ) {
+		for ( pref = nodes[i]->polygons; pref; pref = pref->next ) {
+			cm_polygon_t *p = pref->p;
+			if ( polygonNums[p->checkNum] == -1 ) {
+				polygonNums[p->checkNum] = polygons.Append( p );
+				numPolygonEdges += p->numEdges;
+				// keep a list with the materials
+				int hash = materialHash.GenerateKey( p->material->GetName(), false );
+				for ( j = materialHash.First( hash ); j != -1; j = materialHash.Next( j ) ) {
+					if ( materials[j] == p->material ) {
+						break;
+					}
+				}
+				if ( j == -1 ) {
+					j = materials.Append( p->material );
+					materialHash.Add( hash, j );
+					stringSize += CMB_Align( idStr::Length( p->material->GetName() ) + 1 );
+				}
+				polygonMaterials.Append( j );
+			}
+			polygonRefs.Append( polygonNums[p->checkNum] );
+		}
+		for ( bref = nodes[i]->brushes; bref; bref = bref->next ) {
+			cm_brush_t *b = bref->b;
+			if ( brushNums[b->checkNum] == -1 ) {
+				brushNums[b->checkNum] = brushes.Append( b );
+				numBrushPlanes += b->numPlanes;
+			}
+			brushRefs.Append( brushNums[b->checkNum] );
+		}
+	}
+
+	size = sizeof( cmbModel_t ) +
+			model->numVertices * sizeof( idVec3 ) +
+			model->numEdges * sizeof( cmbEdge_t ) +
+			nodes.Num() * sizeof( cmbNode_t ) +
+			polygons.Num() * sizeof( cmbPolygon_t ) +
+			numPolygonEdges * sizeof( int ) +
+			brushes.Num() * sizeof( cmbBrush_t ) +
+			numBrushPlanes * sizeof( idPlane ) +
+			polygonRefs.Num() * sizeof( int ) +
+			brushRefs.Num() * sizeof( int ) +
+			materials.Num() * sizeof( int ) +
+			stringSize;
+
+	data = (byte *) Mem_ClearedAlloc( size );
+	out = (cmbModel_t *) data;
+	ofs = sizeof( cmbModel_t );
+
+	out->size = size;
+	out->bounds = model->bounds;
+	out->contents = model->contents;
+	out->numInternalEdges = model->numInternalEdges;
+	out->numSharpEdges = model->numSharpEdges;
+
+	// vertices
+	out->numVertices = model->numVertices;
+	out->vertexOfs = ofs;
+	idVec3 *vertices = (idVec3 *) ( data + ofs );
+	for ( i = 0; i < model->numVertices; i++ ) {
+		vertices[i] = model->vertices[i].p;
+	}
+	ofs += model->numVertices * sizeof( idVec3 );
+
+	// edges
+	out->numEdges = model->numEdges;
+	out->edgeOfs = ofs;
+	cmbEdge_t *edges = (cmbEdge_t *) ( data + ofs );
+	for ( i = 0; i < model->numEdges; i++ ) {
+		edges[i].vertexNum[0] = model->edges[i].vertexNum[0];
+		edges[i].vertexNum[1] = model->edges[i].vertexNum[1];
+		edges[i].internal = model->edges[i].internal;
+		edges[i].numUsers = model->edges[i].numUsers;
+		edges[i].normal = model->edges[i].normal;
+	}
+	ofs += model->numEdges * sizeof( cmbEdge_t );
+
+	// nodes, the children follow each other depth first
+	out->numNodes = nodes.Num();
+	out->nodeOfs = ofs;
+	cmbNode_t *outNodes = (cmbNode_t *) ( data + ofs );
+	int numPolygonRefs = 0, numBrushRefs = 0;
+	for ( i = 0; i < nodes.Num(); i++ ) {
+		outNodes[i].planeType = nodes[i]->planeType;
+		outNodes[i].planeDist = nodes[i]->planeDist;
+		outNodes[i].children[0] = children[i * 2 + 0];
+		outNodes[i].children[1] = children[i * 2 + 1];
+		outNodes[i].firstPolygonRef = numPolygonRefs;
+		for ( pref = nodes[i]->polygons; pref; pref = pref->next ) {
+			numPolygonRefs++;
+		}
+		outNodes[i].numPolygonRefs = numPolygonRefs - outNodes[i].firstPolygonRef;
+		outNodes[i].firstBrushRef = numBrushRefs;
+		for ( bref = nodes[i]->brushes; bref; bref = bref->next ) {
+			numBrushRefs++;
+		}
+		outNodes[i].numBrushRefs = numBrushRefs - outNodes[i].firstBrushRef;
+	}
+	ofs += nodes.Num() * sizeof( cmbNode_t );
+
+	// polygons
+	out->numPolygons = polygons.Num();
+	out->polygonOfs = ofs;
+	ofs += polygons.Num() * sizeof( cmbPolygon_t );
+	out->numPolygonEdges = numPolygonEdges;
+	out->polygonEdgeOfs = ofs;
+	ofs += numPolygonEdges * sizeof( int );
+	cmbPolygon_t *outPolygons = (cmbPolygon_t *) ( data + out->polygonOfs );
+	int *polygonEdges = (int *) ( data + out->polygonEdgeOfs );
+	for ( i = 0, j = 0; i < polygons.Num(); i++ ) {
+		cm_polygon_t *p = polygons[i];
+		outPolygons[i].material = polygonMaterials[i];
+		outPolygons[i].plane = p->plane;
+		outPolygons[i].bounds = p->bounds;
+		outPolygons[i].firstEdge = j;
+		outPolygons[i].numEdges = p->numEdges;
+		memcpy( polygonEdges + j, p->edges, p->numEdges * sizeof( int ) );
+		j += p->numEdges;
+	}
+
+	// brushes
+	out->numBrushes = brushes.Num();
+	out->brushOfs = ofs;
+	ofs += brushes.Num() * sizeof( cmbBrush_t );
+	out->numBrushPlanes = numBrushPlanes;
+	out->brushPlaneOfs = ofs;
+	ofs += numBrushPlanes * sizeof( idPlane );
+	cmbBrush_t *outBrushes = (cmbBrush_t *) ( data + out->brushOfs );
+	idPlane *brushPlanes = (idPlane *) ( data + out->brushPlaneOfs );
+	for ( i = 0, j = 0; i < brushes.Num(); i++ ) {
+		cm_brush_t *b = brushes[i];
+		outBrushes[i].contents = b->contents;
+		outBrushes[i].bounds = b->bounds;
+		outBrushes[i].firstPlane = j;
+		outBrushes[i].numPlanes = b->numPlanes;
+		memcpy( brushPlanes + j, b->planes, b->numPlanes * sizeof( idPlane ) );
+		j += b->numPlanes;
+	}
+
+	// references
+	out->numPolygonRefs = polygonRefs.Num();
+	out->polygonRefOfs = ofs;
+	if ( polygonRefs.Num() ) {
+		memcpy( data + ofs, polygonRefs.Ptr(), polygonRefs.Num() * sizeof( int ) );
+	}
+	ofs += polygonRefs.Num() * sizeof( int );
+	out->numBrushRefs = brushRefs.Num();
+	out->brushRefOfs = ofs;
+	if ( brushRefs.Num() ) {
+		memcpy( data + ofs, brushRefs.Ptr(), brushRefs.Num() * sizeof( int ) );
+	}
+	ofs += brushRefs.Num() * sizeof( int );
+
+	// strings
+	out->numMaterials = materials.Num();
+	out->materialOfs = ofs;
+	int *materialNames = (int *) ( data + ofs );
+	ofs += materials.Num() * sizeof( int );
+	out->nameOfs = ofs;
+	idStr::Copynz( (char *) data + ofs, model->name.c_str(), model->name.Length() + 1 );
+	ofs += CMB_Align( model->name.Length() + 1 );
+	for ( i = 0; i < materials.Num(); i++ ) {
+		const char *name = materials[i]->GetName();
+		materialNames[i] = ofs;
+		idStr::Copynz( (char *) data + ofs, name, idStr::Length( name ) + 1 );
+		ofs += CMB_Align( idStr::Length( name ) + 1 );
+	}
+
+	assert( ofs == size );
+
+	Mem_Free( polygonNums );
+	Mem_Free( brushNums );
+
+	return data;
+}
+
+/*
+================
+idCollisionModelManagerLocal::WriteBinaryCollisionModelsToFile
+================
+*/
+void idCollisionModelManagerLocal::WriteBinaryCollisionModelsToFile( const char *filename, int firstModel, int lastModel, unsigned int mapFileCRC ) {
+	int i, size;
+	idFile *fp;
+	idStr name;
+	cmbHeader_t header;
+	byte *data;
+
+	if ( !cm_binaryCache.GetBool() ) {
+		return;
+	}
+
+	name = filename;
+	name.SetFileExtension( CMB_FILE_EXT );
+
+	fp = fileSystem->OpenFileWrite( name, "fs_devpath" );
+	if ( !fp ) {
+		common->Warning( "idCollisionModelManagerLocal::WriteBinaryCollisionModelsToFile: Error opening file %s\n", name.c_str() );
+		return;
+	}
+
+	// the header is written again when the crc is known
+	memset( &header, 0, sizeof( header ) );
+	fp->Write( &header, sizeof( header ) );
+
+	header.ident = CMB_IDENT;
+	header.version = CMB_VERSION;
+	header.mapFileCRC = mapFileCRC;
+	CRC32_InitChecksum( header.dataCRC );
+
+	for ( i = firstModel; i < lastModel; i++ ) {
+		if ( !models[i] ) {
+			continue;
+		}
+		data = WriteBinaryCollisionModel( models[i], size );
+		CRC32_UpdateChecksum( header.dataCRC, data, size );
+		fp->Write( data, size );
+		header.dataSize += size;
+		header.numModels++;
+		Mem_Free( data );
+	}
+
+	CRC32_FinishChecksum( header.dataCRC );
+	fp->Seek( 0, FS_SEEK_SET );
+	fp->Write( &header, sizeof( header ) );
+
+	fileSystem->CloseFile( fp );
+}
+
+/*
+================
+CMB_LumpInside
+
+  tests ofs + num * elementSize <= size without overflowing
+================
+*/
+static bool CMB_LumpInside( int ofs, int num, int elementSize, int size ) {
+	if ( ofs < (int)sizeof( cmbModel_t ) || num < 0 || ofs > size || ( ofs & 3 ) ) {
+		return false;
+	}
+	return num <= ( size - ofs ) / elementSize;
+}
+
+/*
+================
+CMB_StringInside
+================
+*/
+static bool CMB_StringInside( const byte *data, int ofs, int size ) {
+	if ( ofs < (int)sizeof( cmbModel_t ) || ofs >= size ) {
+		return false;
+	}
+	return memchr( data + ofs, 0, size - ofs ) != NULL;
+}
+
+/*
+================
+CMB_ValidateModel
+
+  checks every count, offset and index in the model so the pointer fixup can not read outside the data
+================
+*/
+static bool CMB_ValidateModel( const byte *data, int size ) {
+	int i, j, total;
+	const cmbModel_t *in;
+	byte *hasParent;
+	bool valid;
+
+	in = (const cmbModel_t *) data;
+
+	// make sure all the lumps are inside the model
+	if ( in->size < (int)sizeof( cmbModel_t ) || in->size > size ||
+			!CMB_LumpInside( in->vertexOfs, in->numVertices, sizeof( idVec3 ), in->size ) ||
+			!CMB_LumpInside( in->edgeOfs, in->numEdges, sizeof( cmbEdge_t ), in->size ) ||
+			!CMB_LumpInside( in->nodeOfs, in->numNodes, sizeof( cmbNode_t ), in->size ) ||
+			!CMB_LumpInside( in->polygonOfs, in->numPolygons, sizeof( cmbPolygon_t ), in->size ) ||
+			!CMB_LumpInside( in->polygonEdgeOfs, in->numPolygonEdges, sizeof( int ), in->size ) ||
+			!CMB_LumpInside( in->brushOfs, in->numBrushes, sizeof( cmbBrush_t ), in->size ) ||
+			!CMB_LumpInside( in->brushPlaneOfs, in->numBrushPlanes, sizeof( idPlane ), in->size ) ||
+			!CMB_LumpInside( in->polygonRefOfs, in->numPolygonRefs, sizeof( int ), in->size ) ||
+			!CMB_LumpInside( in->brushRefOfs, in->numBrushRefs, sizeof( int ), in->size ) ||
+			!CMB_LumpInside( in->materialOfs, in->numMaterials, sizeof( int ), in->size ) ||
+			!CMB_StringInside( data, in->nameOfs, in->size ) || in->numNodes < 1 ) {
+		return false;
+	}
+
+	// material names
+	const int *materialNames = (const int *) ( data + in->materialOfs );
+	for ( i = 0; i < in->numMaterials; i++ ) {
+		if ( !CMB_StringInside( data, materialNames[i], in->size ) ) {
+			return false;
+		}
+	}
+
+	// edges
+	const cmbEdge_t *inEdges = (const cmbEdge_t *) ( data + in->edgeOfs );
+	for ( i = 0; i < in->numEdges; i++ ) {
+		for ( j = 0; j < 2; j++ ) {
+			if ( inEdges[i].vertexNum[j] < 0 || inEdges[i].vertexNum[j] >= in->numVertices ) {
+				return false;
+			}
+		}
+	}
+
+	// polygons, the edge numbers are signed for the winding direction
+	const cmbPolygon_t *inPolygons = (const cmbPolygon_t *) ( data + in->polygonOfs );
+	const int *inPolygonEdges = (const int *) ( data + in->polygonEdgeOfs );
+	for ( total = 0, i = 0; i < in->numPolygons; i++ ) {
+		const cmbPolygon_t &inp = inPolygons[i];
+		if ( inp.material < 0 || inp.material >= in->numMaterials ||
+				inp.numEdges < 1 || inp.firstEdge < 0 || inp.firstEdge > in->numPolygonEdges ||
+				inp.numEdges > in->numPolygonEdges - inp.firstEdge ) {
+			return false;
+		}
+		// the polygons are allocated from one block sized for numPolygonEdges
+		total += inp.numEdges;
+		if ( total > in->numPolygonEdges ) {
+			return false;
+		}
+		for ( j = 0; j < inp.numEdges; j++ ) {
+			int edgeNum = inPolygonEdges[inp.firstEdge + j];
+			if ( edgeNum <= -in->numEdges || edgeNum >= in->numEdges ) {
+				return false;
+			}
+		}
+	}
+
+	// brushes
+	const cmbBrush_t *inBrushes = (const cmbBrush_t *) ( data + in->brushOfs );
+	for ( total = 0, i = 0; i < in->numBrushes; i++ ) {
+		const cmbBrush_t &inb = inBrushes[i];
+		if ( inb.numPlanes < 1 || inb.firstPlane < 0 || inb.firstPlane > in->numBrushPlanes ||
+				inb.numPlanes > in->numBrushPlanes - inb.firstPlane ) {
+			return false;
+		}
+		total += inb.numPlanes;
+		if ( total > in->numBrushPlanes ) {
+			return false;
+		}
+	}
+
+	// references
+	const int *inPolygonRefs = (const int *) ( data + in->polygonRefOfs );
+	for ( i = 0; i < in->numPolygonRefs; i++ ) {
+		if ( inPolygonRefs[i] < 0 || inPolygonRefs[i] >= in->numPolygons ) {
+			return false;
+		}
+	}
+	const int *inBrushRefs = (const int *) ( data + in->brushRefOfs );
+	for ( i = 0; i < in->numBrushRefs; i++ ) {
+		if ( inBrushRefs[i] < 0 || inBrushRefs[i] >= in->numBrushes ) {
+			return false;
+		}
+	}
+
+	// nodes, every node except the head has exactly one parent that comes before it
+	const cmbNode_t *inNodes = (const cmbNode_t *) ( data + in->nodeOfs );
+	hasParent = (byte *) Mem_ClearedAlloc( in->numNodes );
+	valid = true;
+	for ( i = 0; i < in->numNodes && valid; i++ ) {
+		const cmbNode_t &inn = inNodes[i];
+		if ( inn.planeType < -1 || inn.planeType > 2 ||
+				inn.numPolygonRefs < 0 || inn.firstPolygonRef < 0 || inn.firstPolygonRef > in->numPolygonRefs ||
+				inn.numPolygonRefs > in->numPolygonRefs - inn.firstPolygonRef ||
+				inn.numBrushRefs < 0 || inn.firstBrushRef < 0 || inn.firstBrushRef > in->numBrushRefs ||
+				inn.numBrushRefs > in->numBrushRefs - inn.firstBrushRef ) {
+			valid = false;
+			break;
+		}
+		if ( inn.planeType == -1 ) {
+			continue;
+		}
+		for ( j = 0; j < 2; j++ ) {
+			int child = inn.children[j];
+			if ( child <= i || child >= in->numNodes || hasParent[child] ) {
+				valid = false;
+				break;
+			}
+			hasParent[child] = 1;
+		}
+	}
+	Mem_Free( hasParent );
+
+	return valid;
+}
+
+/*
+================
+idCollisionModelManagerLocal::ReadBinaryCollisionModel
+================
+*/
+bool idCollisionModelManagerLocal::ReadBinaryCollisionModel( const byte *data, int size ) {
+	int i, j;
+	const cmbModel_t *in;
+	cm_model_t *model;
+	cm_node_t **nodes;
+	cm_polygon_t **polygons;
+	cm_brush_t **brushes;
+	const idMaterial **materials;
+
+	in = (const cmbModel_t *) data;
+
+	if ( !CMB_ValidateModel( data, size ) ) {
+		return false;
+	}
+
+	if ( numModels >= MAX_SUBMODELS ) {
+		common->Error( "LoadModel: no free slots" );
+		return false;
+	}
+	model = AllocModel();
+	models[numModels] = model;
+	numModels++;
+
+	model->name = (const char *) ( data + in->nameOfs );
+	//HUMANHEAD rww
+#if _HH_INLINED_PROC_CLIPMODELS
+	if (anyInlinedProcClipMats) {
+		if (model->name.Cmpn(PROC_CLIPMODEL_STRING_PRFX, strlen(PROC_CLIPMODEL_STRING_PRFX)) == 0) {
+			numInlinedProcClipModels++;
+		}
+	}
+#endif
+	//HUMANHEAD END
+	model->bounds = in->bounds;
+	model->contents = in->contents;
+	model->numInternalEdges = in->numInternalEdges;
+	model->numSharpEdges = in->numSharpEdges;
+
+	// vertices
+	const idVec3 *inVertices = (const idVec3 *) ( data + in->vertexOfs );
+	model->numVertices = model->maxVertices = in->numVertices;
+	model->vertices = (cm_vertex_t *) Mem_Alloc( model->maxVertices * sizeof( cm_vertex_t ) );
+	for ( i = 0; i < model->numVertices; i++ ) {
+		model->vertices[i].p = inVertices[i];
+		model->vertices[i].checkcount = 0;
+	}
+
+	// edges with the normals already calculated
+	const cmbEdge_t *inEdges = (const cmbEdge_t *) ( data + in->edgeOfs );
+	model->numEdges = model->maxEdges = in->numEdges;
+	model->edges = (cm_edge_t *) Mem_Alloc( model->maxEdges * sizeof( cm_edge_t ) );
+	for ( i = 0; i < model->numEdges; i++ ) {
+		model->edges[i].vertexNum[0] = inEdges[i].vertexNum[0];
+		model->edges[i].vertexNum[1] = inEdges[i].vertexNum[1];
+		model->edges[i].internal = inEdges[i].internal;
+		model->edges[i].numUsers = inEdges[i].numUsers;
+		model->edges[i].normal = inEdges[i].normal;
+		model->edges[i].checkcount = 0;
+	}
+
+	// materials
+	const int *materialNames = (const int *) ( data + in->materialOfs );
+	materials = (const idMaterial **) Mem_Alloc( ( in->numMaterials + 1 ) * sizeof( materials[0] ) );
+	for ( i = 0; i < in->numMaterials; i++ ) {
+		materials[i] = declManager->FindMaterial( (const char *) ( data + materialNames[i] ) );
+	}
+
+	// polygons, all in one block
+	const cmbPolygon_t *inPolygons = (const cmbPolygon_t *) ( data + in->polygonOfs );
+	const int *inPolygonEdges = (const int *) ( data + in->polygonEdgeOfs );
+	polygons = (cm_polygon_t **) Mem_Alloc( ( in->numPolygons + 1 ) * sizeof( polygons[0] ) );
+	if ( in->numPolygons ) {
+		int polygonMemory = in->numPolygons * sizeof( cm_polygon_t ) + ( in->numPolygonEdges - in->numPolygons ) * sizeof( int );
+		model->polygonBlock = (cm_polygonBlock_t *) Mem_Alloc( sizeof( cm_polygonBlock_t ) + polygonMemory );
+		model->polygonBlock->bytesRemaining = polygonMemory;
+		model->polygonBlock->next = ( (byte *) model->polygonBlock ) + sizeof( cm_polygonBlock_t );
+	}
+	for ( i = 0; i < in->numPolygons; i++ ) {
+		const cmbPolygon_t &inp = inPolygons[i];
+		cm_polygon_t *p = AllocPolygon( model, inp.numEdges );
+		p->numEdges = inp.numEdges;
+		memcpy( p->edges, inPolygonEdges + inp.firstEdge, inp.numEdges * sizeof( int ) );
+		p->plane = inp.plane;
+		p->bounds = inp.bounds;
+		p->material = materials[inp.material];
+		p->contents = p->material->GetContentFlags();
+		p->checkcount = 0;
+		polygons[i] = p;
+	}
+
+	// brushes, all in one block
+	const cmbBrush_t *inBrushes = (const cmbBrush_t *) ( data + in->brushOfs );
+	const idPlane *inBrushPlanes = (const idPlane *) ( data + in->brushPlaneOfs );
+	brushes = (cm_brush_t **) Mem_Alloc( ( in->numBrushes + 1 ) * sizeof( brushes[0] ) );
+	if ( in->numBrushes ) {
+		int brushMemory = in->numBrushes * sizeof( cm_brush_t ) + ( in->numBrushPlanes - in->numBrushes ) * sizeof( idPlane );
+		model->brushBlock = (cm_brushBlock_t *) Mem_Alloc( sizeof( cm_brushBlock_t ) + brushMemory );
+		model->brushBlock->bytesRemaining = brushMemory;
+		model->brushBlock->next = ( (byte *) model->brushBlock ) + sizeof( cm_brushBlock_t );
+	}
+	for ( i = 0; i < in->numBrushes; i++ ) {
+		const cmbBrush_t &inb = inBrushes[i];
+		cm_brush_t *b = AllocBrush( model, inb.numPlanes );
+		b->numPlanes = inb.numPlanes;
+		memcpy( b->planes, inBrushPlanes + inb.firstPlane, inb.numPlanes * sizeof( idPlane ) );
+		b->bounds = inb.bounds;
+		b->contents = inb.contents;
+		b->checkcount = 0;
+		b->primitiveNum = 0;
+		brushes[i] = b;
+	}
+
+	// nodes, all in one block
+	const cmbNode_t *inNodes = (const cmbNode_t *) ( data + in->nodeOfs );
+	const int *inPolygonRefs = (const int *) ( data + in->polygonRefOfs );
+	const int *inBrushRefs = (const int *) ( data + in->brushRefOfs );
+	nodes = (cm_node_t **) Mem_Alloc( in->numNodes * sizeof( nodes[0] ) );
+	for ( i = 0; i < in->numNodes; i++ ) {
+		nodes[i] = AllocNode( model, in->numNodes );
+	}
+	model->numNodes = in->numNodes;
+	model->node = nodes[0];
+	for ( i = 0; i < in->numNodes; i++ ) {
+		const cmbNode_t &inn = inNodes[i];
+		cm_node_t *node = nodes[i];
+		node->planeType = inn.planeType;
+		node->planeDist = inn.planeDist;
+		node->polygons = NULL;
+		node->brushes = NULL;
+		if ( inn.planeType != -1 ) {
+			node->children[0] = nodes[inn.children[0]];
+			node->children[1] = nodes[inn.children[1]];
+			node->children[0]->parent = node;
+			node->children[1]->parent = node;
+		}
+		// references are added to the front of the lists
+		for ( j = inn.numPolygonRefs - 1; j >= 0; j-- ) {
+			AddPolygonToNode( model, node, polygons[inPolygonRefs[inn.firstPolygonRef + j]] );
+		}
+		for ( j = inn.numBrushRefs - 1; j >= 0; j-- ) {
+			AddBrushToNode( model, node, brushes[inBrushRefs[inn.firstBrushRef + j]] );
+		}
+	}
+
+	Mem_Free( nodes );
+	Mem_Free( brushes );
+	Mem_Free( polygons );
+	Mem_Free( materials );
+
+	// total memory used by this model
+	model->usedMemory = model->numVertices * sizeof(cm_vertex_t) +
+						model->numEdges * sizeof(cm_edge_t) +
+						model->polygonMemory +
+						model->brushMemory +
+						model->numNodes * sizeof(cm_node_t) +
+						model->numPolygonRefs * sizeof(cm_polygonRef_t) +
+						model->numBrushRefs * sizeof(cm_brushRef_t);
+
+	return true;
+}
+
+/*
+================
+idCollisionModelManagerLocal::LoadBinaryCollisionModelFile
+================
+*/
+bool idCollisionModelManagerLocal::LoadBinaryCollisionModelFile( const char *name, unsigned int mapFileCRC ) {
+	idStr fileName, textFileName;
+	ID_TIME_T binaryTime, textTime;
+	const cmbHeader_t *header;
+	const byte *data;
+	void *buffer;
+	int i, length, ofs, firstModel;
+
+	if ( !cm_binaryCache.GetBool() ) {
+		return false;
+	}
+
+	fileName = name;
+	fileName.SetFileExtension( CMB_FILE_EXT );
+	length = fileSystem->ReadFile( fileName, &buffer, &binaryTime );
+	if ( !buffer ) {
+		return false;
+	}
+
+	// a text file that is newer than the cache was edited or written again
+	textFileName = name;
+	textFileName.SetFileExtension( CM_FILE_EXT );
+	if ( fileSystem->ReadFile( textFileName, NULL, &textTime ) >= 0 && textTime > binaryTime ) {
+		common->Printf( "%s is older than %s\n", fileName.c_str(), textFileName.c_str() );
+		fileSystem->FreeFile( buffer );
+		return false;
+	}
+
+	header = (const cmbHeader_t *) buffer;
+	data = (const byte *) buffer + sizeof( cmbHeader_t );
+
+	if ( length < (int)sizeof( cmbHeader_t ) || header->ident != CMB_IDENT || header->version != CMB_VERSION ||
+			header->dataSize != length - (int)sizeof( cmbHeader_t ) ) {
+		common->Printf( "%s is not a valid CMB file\n", fileName.c_str() );
+		fileSystem->FreeFile( buffer );
+		return false;
+	}
+
+	if ( mapFileCRC && header->mapFileCRC != mapFileCRC ) {
+		common->Printf( "%s is out of date\n", fileName.c_str() );
+		fileSystem->FreeFile( buffer );
+		return false;
+	}
+
+	if ( CRC32_BlockChecksum( data, header->dataSize ) != header->dataCRC ) {
+		common->Printf( "%s has a bad CRC\n", fileName.c_str() );
+		fileSystem->FreeFile( buffer );
+		return false;
+	}
+
+	firstModel = numModels;
+	for ( ofs = 0, i = 0; i < header->numModels; i++ ) {
+		const cmbModel_t *in = (const cmbModel_t *) ( data + ofs );
+		if ( header->dataSize - ofs < (int)sizeof( cmbModel_t ) || !ReadBinaryCollisionModel( data + ofs, header->dataSize - ofs ) ) {
+			common->Warning( "%s is corrupt", fileName.c_str() );
+			// remove the models read so far so the text file can be parsed instead
+			while ( numModels > firstModel ) {
+				numModels--;
+				FreeModel( models[numModels] );
+				models[numModels] = NULL;
+			}
+			fileSystem->FreeFile( buffer );
+			return false;
+		}
+		ofs += in->size;
+	}
+
+	fileSystem->FreeFile( buffer );
+
 	return true;
 }
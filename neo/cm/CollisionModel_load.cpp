@@ -371,15 +371,10 @@ void idCollisionModelManagerLocal::Clear( void ) {
 	maxModels = 0;
 	numModels = 0;
 	models = NULL;
-	memset( trmPolygons, 0, sizeof( trmPolygons ) );
-	trmBrushes[0] = NULL;
 	trmMaterial = NULL;
 	numProcNodes = 0;
 	procNodes = NULL;
-	getContacts = false;
-	contacts = NULL;
-	maxContacts = 0;
-	numContacts = 0;
+	traceContexts = NULL;
 	//HUMANHEAD rww
 #if _HH_INLINED_PROC_CLIPMODELS
 	inlinedProcClipModelMats.Clear();
@@ -626,24 +621,118 @@ void idCollisionModelManagerLocal::FreeMap( void ) {
 /*
 ================
 idCollisionModelManagerLocal::FreeTrmModelStructure
+
+  frees the trm models and check stamps of all trace contexts
 ================
 */
 void idCollisionModelManagerLocal::FreeTrmModelStructure( void ) {
-	int i;
+	int i, j;
+	cm_traceContext_t *context;
 
 	assert( models );
-	if ( !models[MAX_SUBMODELS] ) {
+	if ( !traceContexts ) {
 		return;
 	}
 
-	for ( i = 0; i < MAX_TRACEMODEL_POLYS; i++ ) {
-		FreePolygon( models[MAX_SUBMODELS], trmPolygons[i]->p );
+	for ( i = 0; i < CM_MAX_TRACE_CONTEXTS; i++ ) {
+		context = &traceContexts[i];
+
+		for ( j = 0; j <= MAX_SUBMODELS; j++ ) {
+			if ( context->modelChecks[j] ) {
+				FreeModelChecks( context->modelChecks[j] );
+			}
+		}
+
+		if ( !context->trmModel ) {
+			continue;
+		}
+		for ( j = 0; j < MAX_TRACEMODEL_POLYS; j++ ) {
+			FreePolygon( context->trmModel, context->trmPolygons[j]->p );
+		}
+		FreeBrush( context->trmModel, context->trmBrushes[0]->b );
+
+		context->trmModel->node->polygons = NULL;
+		context->trmModel->node->brushes = NULL;
+		FreeModel( context->trmModel );
 	}
-	FreeBrush( models[MAX_SUBMODELS], trmBrushes[0]->b );
 
-	models[MAX_SUBMODELS]->node->polygons = NULL;
-	models[MAX_SUBMODELS]->node->brushes = NULL;
-	FreeModel( models[MAX_SUBMODELS] );
+	Mem_Free16( traceContexts );
+	traceContexts = NULL;
+	models[MAX_SUBMODELS] = NULL;
+}
+
+/*
+================
+idCollisionModelManagerLocal::FreeModelChecks
+================
+*/
+void idCollisionModelManagerLocal::FreeModelChecks( cm_modelChecks_t *checks ) {
+	Mem_Free( checks->vertices );
+	Mem_Free( checks->edges );
+	Mem_Free( checks->polygons );
+	Mem_Free( checks->brushes );
+	Mem_Free( checks );
+}
+
+/*
+================
+idCollisionModelManagerLocal::GetTraceContext
+
+  every thread that can run jobs traces with its own context
+================
+*/
+cm_traceContext_t *idCollisionModelManagerLocal::GetTraceContext( void ) {
+	int index = jobSystem->GetThreadIndex();
+
+	assert( index >= 0 && index < CM_MAX_TRACE_CONTEXTS );
+	return &traceContexts[index];
+}
+
+/*
+================
+idCollisionModelManagerLocal::GetTraceModel
+
+  the trace model handle refers to the trm model of the context
+================
+*/
+cm_model_t *idCollisionModelManagerLocal::GetTraceModel( cm_traceContext_t *context, cmHandle_t model ) {
+	if ( model == TRACE_MODEL_HANDLE ) {
+		return context->trmModel;
+	}
+	return models[model];
+}
+
+/*
+================
+idCollisionModelManagerLocal::SetupTraceChecks
+
+  tw->model should be set, gets the check stamps of the context for the model and starts a new check
+================
+*/
+void idCollisionModelManagerLocal::SetupTraceChecks( cm_traceWork_t *tw, cm_traceContext_t *context, cmHandle_t model ) {
+	cm_modelChecks_t *checks;
+	const cm_model_t *cm = tw->model;
+
+	checks = context->modelChecks[model];
+	if ( !checks || checks->maxVertices < cm->maxVertices || checks->maxEdges < cm->maxEdges ||
+			checks->maxPolygons < cm->numPolygonChecks || checks->maxBrushes < cm->numBrushChecks ) {
+		if ( checks ) {
+			FreeModelChecks( checks );
+		}
+		checks = (cm_modelChecks_t *) Mem_Alloc( sizeof( cm_modelChecks_t ) );
+		checks->maxVertices = cm->maxVertices;
+		checks->maxEdges = cm->maxEdges;
+		checks->maxPolygons = cm->numPolygonChecks;
+		checks->maxBrushes = cm->numBrushChecks;
+		checks->vertices = (cm_sideCheck_t *) Mem_ClearedAlloc( ( checks->maxVertices + 1 ) * sizeof( cm_sideCheck_t ) );
+		checks->edges = (cm_sideCheck_t *) Mem_ClearedAlloc( ( checks->maxEdges + 1 ) * sizeof( cm_sideCheck_t ) );
+		checks->polygons = (int *) Mem_ClearedAlloc( ( checks->maxPolygons + 1 ) * sizeof( int ) );
+		checks->brushes = (int *) Mem_ClearedAlloc( ( checks->maxBrushes + 1 ) * sizeof( int ) );
+		context->modelChecks[model] = checks;
+	}
+
+	tw->checks = checks;
+	tw->checkCount = ++context->checkCount;
 }
 
 
@@ -748,6 +837,7 @@ cm_model_t *idCollisionModelManagerLocal::AllocModel( void ) {
 	model->brushRefBlocks = NULL;
 	model->polygonBlock = NULL;
 	model->brushBlock = NULL;
+	model->numPolygonChecks = model->numBrushChecks = 0;
 	model->numPolygons = model->polygonMemory =
 	model->numBrushes = model->brushMemory =
 	model->numNodes = model->numBrushRefs =
@@ -865,6 +955,7 @@ cm_polygon_t *idCollisionModelManagerLocal::AllocPolygon( cm_model_t *model, int
 	} else {
 		poly = (cm_polygon_t *) Mem_Alloc( size );
 	}
+	poly->checkNum = model->numPolygonChecks++;
 	return poly;
 }
 
@@ -887,6 +978,7 @@ cm_brush_t *idCollisionModelManagerLocal::AllocBrush( cm_model_t *model, int num
 	} else {
 		brush = (cm_brush_t *) Mem_Alloc( size );
 	}
+	brush->checkNum = model->numBrushChecks++;
 	return brush;
 }
 
@@ -925,16 +1017,17 @@ void idCollisionModelManagerLocal::AddBrushToNode( cm_model_t *model, cm_node_t
 idCollisionModelManagerLocal::SetupTrmModelStructure
 ================
 */
-void idCollisionModelManagerLocal::SetupTrmModelStructure( void ) {
+void idCollisionModelManagerLocal::SetupTrmModelStructure( cm_traceContext_t *context ) {
 	int i;
 	cm_node_t *node;
 	cm_model_t *model;
+	cm_polygonRef_t **trmPolygons = context->trmPolygons;
+	cm_brushRef_t **trmBrushes = context->trmBrushes;
 
 	// setup model
 	model = AllocModel();
 
-	assert( models );
-	models[MAX_SUBMODELS] = model;
+	context->trmModel = model;
 	// create node to hold the collision data
 	node = (cm_node_t *) AllocNode( model, 1 );
 	node->planeType = -1;
@@ -946,11 +1039,6 @@ void idCollisionModelManagerLocal::SetupTrmModelStructure( void ) {
 	model->numEdges = 0;
 	model->maxEdges = MAX_TRACEMODEL_EDGES+1;
 	model->edges = (cm_edge_t *) Mem_ClearedAlloc( model->maxEdges * sizeof(cm_edge_t) );
-	// create a material for the trace model polygons
-	trmMaterial = declManager->FindMaterial( "_tracemodel", false );
-	if ( !trmMaterial ) {
-		common->FatalError( "_tracemodel material not found" );
-	}
 
 	// allocate polygons
 	for ( i = 0; i < MAX_TRACEMODEL_POLYS; i++ ) {
@@ -978,8 +1066,8 @@ void idCollisionModelManagerLocal::SetupTrmModelStructure( void ) {
 ================
 idCollisionModelManagerLocal::SetupTrmModel
 
-Trace models (item boxes, etc) are converted to collision models on the fly, using the last model slot
-as a reusable temporary buffer
+Trace models (item boxes, etc) are converted to collision models on the fly, using the trm model
+of the trace context as a reusable temporary buffer.  The handle is only valid on the calling thread.
 ================
 */
 cmHandle_t idCollisionModelManagerLocal::SetupTrmModel( const idTraceModel &trm, const idMaterial *material ) {
@@ -998,7 +1086,11 @@ cmHandle_t idCollisionModelManagerLocal::SetupTrmModel( const idTraceModel &trm,
 		material = trmMaterial;
 	}
 
-	model = models[MAX_SUBMODELS];
+	cm_traceContext_t *context = GetTraceContext();
+	cm_polygonRef_t **trmPolygons = context->trmPolygons;
+	cm_brushRef_t **trmBrushes = context->trmBrushes;
+
+	model = context->trmModel;
 	model->node->brushes = NULL;
 	model->node->polygons = NULL;
 	// if not a valid trace model
@@ -1011,7 +1103,6 @@ cmHandle_t idCollisionModelManagerLocal::SetupTrmModel( const idTraceModel &trm,
 	trmVert = trm.verts;
 	for ( i = 0; i < trm.numVerts; i++, vertex++, trmVert++ ) {
 		vertex->p = *trmVert;
-		vertex->sideSet = 0;
 	}
 	// edges
 	model->numEdges = trm.numEdges;
@@ -1022,7 +1113,6 @@ cmHandle_t idCollisionModelManagerLocal::SetupTrmModel( const idTraceModel &trm,
 		edge->vertexNum[1] = trmEdge->v[1];
 		edge->normal = trmEdge->normal;
 		edge->internal = false;
-		edge->sideSet = 0;
 	}
 	// polygons
 	model->numPolygons = trm.numPolys;
@@ -1646,10 +1736,12 @@ cm_polygon_t *idCollisionModelManagerLocal::TryMergePolygons( cm_model_t *model,
 	}
 
 	newp = AllocPolygon( model, newNumEdges );
+	i = newp->checkNum;
 	memcpy( newp, p1, sizeof(cm_polygon_t) );
 	memcpy( newp->edges, newEdges, newNumEdges * sizeof(int) );
 	newp->numEdges = newNumEdges;
 	newp->checkcount = 0;
+	newp->checkNum = i;
 	// increase usage count for the edges of this polygon
 	for ( i = 0; i < newp->numEdges; i++ ) {
 		if ( !keep1 && newp->edges[i] == newEdgeNum1 ) {
@@ -3631,8 +3723,20 @@ void idCollisionModelManagerLocal::LoadMap( const idMapFile *mapFile ) {
 	// setup hash to speed up finding shared vertices and edges
 	SetupHash();
 
-	// setup trace model structure
-	SetupTrmModelStructure();
+	// create a material for the trace model polygons
+	trmMaterial = declManager->FindMaterial( "_tracemodel", false );
+	if ( !trmMaterial ) {
+		common->FatalError( "_tracemodel material not found" );
+	}
+
+	// setup trace contexts with their trace model structure
+	traceContexts = (cm_traceContext_t *) Mem_Alloc16( CM_MAX_TRACE_CONTEXTS * sizeof( cm_traceContext_t ) );
+	memset( traceContexts, 0, CM_MAX_TRACE_CONTEXTS * sizeof( cm_traceContext_t ) );
+	for ( int i = 0; i < CM_MAX_TRACE_CONTEXTS; i++ ) {
+		SetupTrmModelStructure( &traceContexts[i] );
+	}
+	// the trace model slot shows the trm model of the main thread
+	models[MAX_SUBMODELS] = traceContexts[0].trmModel;
 
 	// build collision models
 	BuildModels( mapFile );
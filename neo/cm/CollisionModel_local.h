@@ -44,6 +44,8 @@ If you have questions concerning this license or the applicable additional terms
 #define	MAX_SUBMODELS						2048
 #define	TRACE_MODEL_HANDLE					MAX_SUBMODELS
 
+#define CM_MAX_TRACE_CONTEXTS				( MAX_JOB_WORKERS + 1 )	// one for every thread that can trace
+
 #define VERTEX_HASH_BOXSIZE					(1<<6)	// must be power of 2
 #define VERTEX_HASH_SIZE					(VERTEX_HASH_BOXSIZE*VERTEX_HASH_BOXSIZE)
 #define EDGE_HASH_SIZE						(1<<14)
@@ -80,17 +82,13 @@ Collision model
 
 typedef struct cm_vertex_s {
 	idVec3					p;					// vertex point
-	int						checkcount;			// for multi-check avoidance
-	unsigned int			side;				// each bit tells at which side this vertex passes one of the trace model edges
-	unsigned int			sideSet;			// each bit tells if sidedness for the trace model edge has been calculated yet
+	int						checkcount;			// for multi-check avoidance while loading and writing
 } cm_vertex_t;
 
 typedef struct cm_edge_s {
-	int						checkcount;			// for multi-check avoidance
+	int						checkcount;			// for multi-check avoidance while loading and writing
 	unsigned short			internal;			// a trace model can never collide with internal edges
 	unsigned short			numUsers;			// number of polygons using this edge
-	unsigned int			side;				// each bit tells at which side of this edge one of the trace model vertices passes
-	unsigned int			sideSet;			// each bit tells if sidedness for the trace model vertex has been calculated yet
 	int						vertexNum[2];		// start and end point of edge
 	idVec3					normal;				// edge normal
 } cm_edge_t;
@@ -102,7 +100,8 @@ typedef struct cm_polygonBlock_s {
 
 typedef struct cm_polygon_s {
 	idBounds				bounds;				// polygon bounds
-	int						checkcount;			// for multi-check avoidance
+	int						checkcount;			// for multi-check avoidance while loading and writing
+	int						checkNum;			// index into the check stamps of the trace contexts
 	int						contents;			// contents behind polygon
 	const idMaterial *		material;			// material
 	idPlane					plane;				// polygon plane
@@ -126,7 +125,8 @@ typedef struct cm_brushBlock_s {
 } cm_brushBlock_t;
 
 typedef struct cm_brush_s {
-	int						checkcount;			// for multi-check avoidance
+	int						checkcount;			// for multi-check avoidance while loading and writing
+	int						checkNum;			// index into the check stamps of the trace contexts
 	idBounds				bounds;				// brush bounds
 	int						contents;			// contents of brush
 	const idMaterial *		material;			// material
@@ -178,6 +178,8 @@ typedef struct cm_model_s {
 	cm_brushRefBlock_t *	brushRefBlocks;		// list with blocks of brush references
 	cm_polygonBlock_t *		polygonBlock;		// memory block with all polygons
 	cm_brushBlock_t *		brushBlock;			// memory block with all brushes
+	int						numPolygonChecks;	// check stamps handed out to polygons, never decreases
+	int						numBrushChecks;		// check stamps handed out to brushes, never decreases
 	// statistics
 	int						numPolygons;
 	int						polygonMemory;
@@ -231,6 +233,24 @@ typedef struct cm_trmPolygon_s {
 	idBounds rotationBounds;						// rotation bounds for this polygon
 } cm_trmPolygon_t;
 
+typedef struct cm_sideCheck_s {
+	int checkcount;									// for multi-check avoidance
+	unsigned int side;								// vertex: each bit tells at which side this vertex passes one of the trace model edges
+													// edge: each bit tells at which side of this edge one of the trace model vertices passes
+	unsigned int sideSet;							// each bit tells if sidedness for the trace model edge or vertex has been calculated yet
+} cm_sideCheck_t;
+
+typedef struct cm_modelChecks_s {
+	int maxVertices;								// sizes of the arrays
+	int maxEdges;
+	int maxPolygons;
+	int maxBrushes;
+	cm_sideCheck_t *vertices;						// indexed like cm_model_t->vertices
+	cm_sideCheck_t *edges;							// indexed like cm_model_t->edges
+	int *polygons;									// indexed with cm_polygon_t->checkNum
+	int *brushes;									// indexed with cm_brush_t->checkNum
+} cm_modelChecks_t;
+
 typedef struct cm_traceWork_s {
 	int numVerts;
 	cm_trmVertex_t vertices[MAX_TRACEMODEL_VERTS];	// trm vertices
@@ -239,6 +259,8 @@ typedef struct cm_traceWork_s {
 	int numPolys;
 	cm_trmPolygon_t polys[MAX_TRACEMODEL_POLYS];	// trm polygons
 	cm_model_t *model;								// model colliding with
+	cm_modelChecks_t *checks;						// check stamps of the trace context for the model
+	int checkCount;									// check stamp of this trace
 	idVec3 start;									// start of trace
 	idVec3 end;										// end of trace
 	idVec3 dir;										// trace direction
@@ -277,6 +299,55 @@ typedef struct cm_traceWork_s {
 	idVec3 polygonRotationOriginCache[CM_MAX_POLYGON_EDGES];
 } cm_traceWork_t;
 
+/*
+================
+CM_VertexCheck, CM_EdgeCheck, CM_PolygonCheck, CM_BrushCheck
+
+  the multi-check avoidance stamps and sidedness caches of the model elements
+  are kept by the trace context, so traces on different threads don't share them
+================
+*/
+ID_INLINE cm_sideCheck_t *CM_VertexCheck( const cm_traceWork_t *tw, const cm_vertex_t *v ) {
+	return &tw->checks->vertices[ v - tw->model->vertices ];
+}
+
+ID_INLINE cm_sideCheck_t *CM_EdgeCheck( const cm_traceWork_t *tw, const cm_edge_t *e ) {
+	return &tw->checks->edges[ e - tw->model->edges ];
+}
+
+ID_INLINE int &CM_PolygonCheck( const cm_traceWork_t *tw, const cm_polygon_t *p ) {
+	return tw->checks->polygons[ p->checkNum ];
+}
+
+ID_INLINE int &CM_BrushCheck( const cm_traceWork_t *tw, const cm_brush_t *b ) {
+	return tw->checks->brushes[ b->checkNum ];
+}
+
+/*
+===============================================================================
+
+Trace context
+
+	Everything a trace writes to, one for every thread that can trace.
+	Contexts are picked with the job system thread index.
+
+===============================================================================
+*/
+
+typedef struct cm_traceContext_s {
+	int						checkCount;						// for multi-check avoidance
+	cm_modelChecks_t *		modelChecks[MAX_SUBMODELS+1];	// allocated on the first trace through the model
+	cm_model_t *			trmModel;						// trace model converted to a collision model
+	cm_polygonRef_t *		trmPolygons[MAX_TRACEMODEL_POLYS];
+	cm_brushRef_t *			trmBrushes[1];
+	bool					getContacts;					// for retrieving contact points
+	contactInfo_t *			contacts;
+	int						maxContacts;
+	int						numContacts;
+	cm_traceWork_t			translationWork;
+	cm_traceWork_t			rotationWork;
+} cm_traceContext_t;
+
 /*
 ===============================================================================
 
@@ -417,6 +488,11 @@ private:			// CollisionMap_trace.cpp
 private:			// CollisionMap_load.cpp
 	void			Clear( void );
 	void			FreeTrmModelStructure( void );
+					// trace contexts
+	cm_traceContext_t *GetTraceContext( void );
+	cm_model_t *	GetTraceModel( cm_traceContext_t *context, cmHandle_t model );
+	void			SetupTraceChecks( cm_traceWork_t *tw, cm_traceContext_t *context, cmHandle_t model );
+	void			FreeModelChecks( cm_modelChecks_t *checks );
 					// model deallocation
 	void			RemovePolygonReferences_r( cm_node_t *node, cm_polygon_t *p );
 	void			RemoveBrushReferences_r( cm_node_t *node, cm_brush_t *b );
@@ -461,7 +537,7 @@ private:			// CollisionMap_load.cpp
 	cm_brush_t *	AllocBrush( cm_model_t *model, int numPlanes );
 	void			AddPolygonToNode( cm_model_t *model, cm_node_t *node, cm_polygon_t *p );
 	void			AddBrushToNode( cm_model_t *model, cm_node_t *node, cm_brush_t *b );
-	void			SetupTrmModelStructure( void );
+	void			SetupTrmModelStructure( cm_traceContext_t *context );
 	void			R_FilterPolygonIntoTree( cm_model_t *model, cm_node_t *node, cm_polygonRef_t *pref, cm_polygon_t *p );
 	void			R_FilterBrushIntoTree( cm_model_t *model, cm_node_t *node, cm_brushRef_t *pref, cm_brush_t *b );
 	cm_node_t *		R_CreateAxialBSPTree( cm_model_t *model, cm_node_t *node, const idBounds &bounds );
@@ -509,6 +585,11 @@ private:			// CollisionMap_files.cpp
 	void			ParseBrushes( idLexer *src, cm_model_t *model );
 	bool			ParseCollisionModel( idLexer *src );
 	bool			LoadCollisionModelFile( const char *name, unsigned int mapFileCRC );
+					// binary cache
+	byte *			WriteBinaryCollisionModel( cm_model_t *model, int &size );
+	void			WriteBinaryCollisionModelsToFile( const char *filename, int firstModel, int lastModel, unsigned int mapFileCRC );
+	bool			ReadBinaryCollisionModel( const byte *data, int size );
+	bool			LoadBinaryCollisionModelFile( const char *name, unsigned int mapFileCRC );
 
 private:			// CollisionMap_debug
 	int				ContentsFromString( const char *string ) const;
@@ -523,24 +604,19 @@ private:			// collision map data
 	idStr			mapName;
 	ID_TIME_T			mapFileTime;
 	int				loaded;
-					// for multi-check avoidance
+					// for multi-check avoidance while loading and writing
 	int				checkCount;
 					// models
 	int				maxModels;
 	int				numModels;
 	cm_model_t **	models;
-					// polygons and brush for trm model
-	cm_polygonRef_t*trmPolygons[MAX_TRACEMODEL_POLYS];
-	cm_brushRef_t *	trmBrushes[1];
+					// material for trm model polygons
 	const idMaterial *trmMaterial;
 					// for data pruning
 	int				numProcNodes;
 	cm_procNode_t *	procNodes;
-					// for retrieving contact points
-	bool			getContacts;
-	contactInfo_t *	contacts;
-	int				maxContacts;
-	int				numContacts;
+					// check stamps, trm model and contacts of every tracing thread
+	cm_traceContext_t *traceContexts;
 	//HUMANHEAD rww
 #if _HH_INLINED_PROC_CLIPMODELS
 	idList<const char *>	inlinedProcClipModelMats;
@@ -190,4 +190,4 @@ prey (2006)		43
 
 // threads
 
-#define MAX_THREADS				(10)
+#define MAX_THREADS				(16)
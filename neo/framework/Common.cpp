@@ -2686,6 +2686,7 @@ void idCommonLocal::LoadGameDLL( void ) {
 	gameImport.declManager				= ::declManager;
 	gameImport.AASFileManager			= ::AASFileManager;
 	gameImport.collisionModelManager	= ::collisionModelManager;
+	gameImport.jobSystem				= ::jobSystem;
 
 	gameExport							= *GetGameAPI( &gameImport);
 
@@ -3016,6 +3017,9 @@ void idCommonLocal::Init( int argc, char **argv ) {
 		// initialize processor specific SIMD implementation
 		InitSIMD();
 
+		// start the worker threads
+		jobSystem->Init();
+
 		// init commands
 		InitCommands();
 
@@ -3079,6 +3083,9 @@ void idCommonLocal::Shutdown( void ) {
 	// game specific shut down
 	ShutdownGame( false );
 
+	// stop the worker threads
+	jobSystem->Shutdown();
+
 	// shut down non-portable system services
 	Sys_Shutdown();
 
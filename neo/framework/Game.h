@@ -360,7 +360,8 @@ extern idGameEdit *				gameEdit;
 // v11 - Remove Game Callbacks system
 // v12 - Make us very different from Dhewm3
 // v13 - Prey (2006) changes to the game API
-const int GAME_API_VERSION		= 13;
+// v14 - idJobSystem
+const int GAME_API_VERSION		= 14;
 
 typedef struct {
 
@@ -378,6 +379,7 @@ typedef struct {
 	idDeclManager *				declManager;			// declaration manager
 	idAASFileManager *			AASFileManager;			// AAS file manager
 	idCollisionModelManager *	collisionModelManager;	// collision model manager
+	idJobSystem *				jobSystem;				// worker thread pool
 
 	// HUMANHEAD pdm
 #if INGAME_PROFILER_ENABLED
@@ -869,6 +869,10 @@ void idSessionLocal::StopPlayingRenderDemo() {
 		idStr	message = va( "%i frames rendered in %3.1f seconds = %3.1f fps\n", numDemoFrames, demoSeconds, demoFPS );
 
 		common->Printf( "%s", message.c_str() );
+		if ( cvarSystem->GetCVarBool( "r_nullBackend" ) ) {
+			// with no GPU involved this measures the render front end only
+			cmdSystem->BufferCommandText( CMD_EXEC_NOW, "nullBackEndStats\n" );
+		}
 		if ( timeDemo == TD_YES_THEN_QUIT ) {
 			cmdSystem->BufferCommandText( CMD_EXEC_APPEND, "quit\n" );
 		} else {
@@ -985,6 +989,10 @@ void idSessionLocal::TimeRenderDemo( const char *demoName, bool twice ) {
 		return;
 	}
 
+	if ( cvarSystem->GetCVarBool( "r_nullBackend" ) ) {
+		cmdSystem->BufferCommandText( CMD_EXEC_NOW, "nullBackEndStats reset\n" );
+	}
+
 	timeDemo = TD_YES;
 }
 
@@ -1648,6 +1648,82 @@ bool idActor::CanSee( idEntity *ent, bool useFov ) const {
 	return false;
 }
 
+/*
+=====================
+idActor::TraceSightBatch
+
+Traces from the eye to every entity that passes the CanSee tests, the traces
+that are blocked by something other than the entity get blockedResult
+=====================
+*/
+void idActor::TraceSightBatch( idEntity * const *ents, int numEnts, bool useFOV, bool lookAtVehicles,
+								const idEntity *passEntity, int blockedResult, int *results ) const {
+	const int	MAX_SIGHT_BATCH = 32;
+	int			i, j, num, last;
+	idVec3		eye, toPos;
+	idEntity *	ent;
+	idEntity *	targets[MAX_SIGHT_BATCH];
+	int			targetNums[MAX_SIGHT_BATCH];
+	clipTrace_t	traces[MAX_SIGHT_BATCH];
+
+	eye = GetEyePosition();
+
+	for ( i = 0; i < numEnts; i = last ) {
+		last = Min( i + MAX_SIGHT_BATCH, numEnts );
+
+		num = 0;
+		for ( j = i; j < last; j++ ) {
+			results[j] = SIGHT_BLOCKED;
+
+			ent = ents[j];
+			if ( ent->IsHidden() ) {
+				continue;
+			}
+
+			// look at the vehicle, not the actor driving it
+			if ( lookAtVehicles && ent->IsType( idActor::Type ) && static_cast<idActor *>( ent )->InVehicle() ) {
+				ent = static_cast<idActor *>( ent )->GetVehicleInterface()->GetVehicle();
+			}
+
+			if ( ent->IsType( idActor::Type ) ) {
+				toPos = static_cast<idActor *>( ent )->GetEyePosition();
+			} else {
+				toPos = ent->GetPhysics()->GetOrigin();
+			}
+
+			if ( useFOV && !CheckFOV( toPos ) ) {
+				continue;
+			}
+
+			traces[num].start = eye;
+			traces[num].end = toPos;
+			targets[num] = ent;
+			targetNums[num] = j;
+			num++;
+		}
+
+		gameLocal.clip.TracePointBatch( traces, num, MASK_SHOT_BOUNDINGBOX, passEntity );
+
+		for ( j = 0; j < num; j++ ) {
+			const trace_t &tr = traces[j].results;
+			if ( tr.fraction >= 1.0f || ( gameLocal.GetTraceEntity( tr ) == targets[j] ) ) {
+				results[targetNums[j]] = SIGHT_VISIBLE;
+			} else {
+				results[targetNums[j]] = blockedResult;
+			}
+		}
+	}
+}
+
+/*
+=====================
+idActor::CanSeeBatch
+=====================
+*/
+void idActor::CanSeeBatch( idEntity * const *ents, int numEnts, bool useFOV, int *results ) {
+	TraceSightBatch( ents, numEnts, useFOV, false, this, SIGHT_BLOCKED, results );
+}
+
 /*
 =====================
 idActor::PointVisible
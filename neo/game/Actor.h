@@ -115,6 +115,13 @@ typedef struct {
 	jointHandle_t			to;
 } copyJoints_t;
 
+// results of idActor::CanSeeBatch
+enum {
+	SIGHT_BLOCKED,
+	SIGHT_VISIBLE,
+	SIGHT_CHECK					// the batch couldn't tell, call CanSee
+};
+
 class idActor : public idAFEntity_Gibbable {
 public:
 	CLASS_PROTOTYPE( idActor );
@@ -189,6 +196,9 @@ public:
 #else
 	bool					CanSee( idEntity *ent, bool useFOV ) const;
 #endif
+							// CanSee for several entities with the line of sight traces done in one batch,
+							// entities marked SIGHT_CHECK still need a CanSee call
+	virtual void			CanSeeBatch( idEntity * const *ents, int numEnts, bool useFOV, int *results );
 	bool					PointVisible( const idVec3 &point ) const;
 	virtual void			GetAIAimTargets( const idVec3 &lastSightPos, idVec3 &headPos, idVec3 &chestPos );
 
@@ -362,6 +372,10 @@ protected:
 							// copies animation from body to head joints
 	void					CopyJointsFromBodyToHead( void );
 
+							// batched line of sight traces for CanSeeBatch
+	void					TraceSightBatch( idEntity * const *ents, int numEnts, bool useFOV, bool lookAtVehicles,
+										const idEntity *passEntity, int blockedResult, int *results ) const;
+
 private:
 protected:			// nla - Added so we can access.
 	void					SyncAnimChannels( int channel, int syncToChannel, int blendFrames );
@@ -50,6 +50,7 @@ idUserInterfaceManager *	uiManager = NULL;
 idDeclManager *				declManager = NULL;
 idAASFileManager *			AASFileManager = NULL;
 idCollisionModelManager *	collisionModelManager = NULL;
+idJobSystem *				jobSystem = NULL;
 idCVar *					idCVar::staticVars = NULL;
 
 // HUMANHEAD pdm
@@ -115,6 +116,7 @@ extern "C" ID_GAME_API gameExport_t *GetGameAPI( gameImport_t *import ) {
 		declManager					= import->declManager;
 		AASFileManager				= import->AASFileManager;
 		collisionModelManager		= import->collisionModelManager;
+		jobSystem					= import->jobSystem;
 
 		// HUMANHEAD pdm
 #if INGAME_PROFILER_ENABLED
@@ -159,6 +161,7 @@ void TestGameAPI( void ) {
 	testImport.declManager				= ::declManager;
 	testImport.AASFileManager			= ::AASFileManager;
 	testImport.collisionModelManager	= ::collisionModelManager;
+	testImport.jobSystem				= ::jobSystem;
 
 	// HUMANHEAD pdm
 #if INGAME_PROFILER_ENABLED
@@ -1328,6 +1331,9 @@ void idGameLocal::MapPopulate( void ) {
 	Printf( "==== Processing events ====\n" );
 	idEvent::ServiceEvents();
 
+	// build the routing cache towards the spots monsters path to before the first frame
+	PrewarmAASRoutingCache();
+
 	//HUMANHEAD rww - keep track of layered spawning
 #if !GOLD
 	if (layeredSpawn) {
@@ -3357,6 +3363,30 @@ void idGameLocal::RunDebugInfo( void ) {
 		}
 	}
 
+	// debug tool to draw bounding boxes around awake and sleeping rigid bodies
+	if ( rb_showSleeping.GetBool() ) {
+		static int lastNumAwake = -1, lastNumSleeping = -1;
+		int numAwake = 0, numSleeping = 0;
+		for( ent = spawnedEntities.Next(); ent != NULL; ent = ent->spawnNode.Next() ) {
+			idPhysics *phys = ent->GetPhysics();
+			if ( !phys->IsType( idPhysics_RigidBody::Type ) ) {
+				continue;
+			}
+			if ( phys->IsAtRest() ) {
+				gameRenderWorld->DebugBounds( colorBlue, phys->GetAbsBounds() );
+				numSleeping++;
+			} else {
+				gameRenderWorld->DebugBounds( colorRed, phys->GetAbsBounds() );
+				numAwake++;
+			}
+		}
+		if ( numAwake != lastNumAwake || numSleeping != lastNumSleeping ) {
+			Printf( "%d: rigid bodies %d awake, %d sleeping\n", time, numAwake, numSleeping );
+			lastNumAwake = numAwake;
+			lastNumSleeping = numSleeping;
+		}
+	}
+
 	if ( g_showTargets.GetBool() ) {
 		ShowTargets();
 	}
@@ -3558,6 +3588,53 @@ void idGameLocal::RemoveAllAASObstacles( void ) {
 	}
 }
 
+/*
+==================
+idGameLocal::PrewarmAASRoutingCache
+
+  builds the routing cache towards player starts, path corners and entities marked with
+  "aas_prewarm" so the first path requests don't all build their cache in the same frame
+==================
+*/
+void idGameLocal::PrewarmAASRoutingCache( void ) {
+	int i, areaNum;
+	idEntity *ent;
+	idAAS *aas;
+	idVec3 size;
+	idBounds bounds;
+	idList<int> goalAreas;
+
+	if ( aas_prewarmGoals.GetInteger() <= 0 ) {
+		return;
+	}
+
+	for( i = 0; i < aasList.Num(); i++ ) {
+		aas = aasList[ i ];
+		if ( !aas->GetSettings() ) {
+			continue;
+		}
+
+		// same bounds the AI uses to find its reachable area
+		size = aas->GetSettings()->boundingBoxes[0][1] * 2.0f;
+		bounds[0] = -size;
+		size.z = 32.0f;
+		bounds[1] = size;
+
+		goalAreas.Clear();
+		for( ent = spawnedEntities.Next(); ent != NULL && goalAreas.Num() < aas_prewarmGoals.GetInteger(); ent = ent->spawnNode.Next() ) {
+			if ( !ent->IsType( idPlayerStart::Type ) && !ent->IsType( idPathCorner::Type ) && !ent->spawnArgs.GetBool( "aas_prewarm" ) ) {
+				continue;
+			}
+			areaNum = aas->PointReachableAreaNum( ent->GetPhysics()->GetOrigin(), bounds, AREA_REACHABLE_WALK );
+			if ( areaNum ) {
+				goalAreas.AddUnique( areaNum );
+			}
+		}
+
+		aas->PrewarmRoutingCache( goalAreas.Ptr(), goalAreas.Num(), TFL_WALK|TFL_AIR );
+	}
+}
+
 /*
 ==================
 idGameLocal::CheatsOk
@@ -94,8 +94,12 @@ void gameError( const char *fmt, ... );
 
 #include "aas/AAS.h"
 
+#include "physics/ClipTree.h"
 #include "physics/Clip.h"
 #include "physics/Push.h"
+#include "physics/Islands.h"
+
+#include "ThinkScheduler.h"
 
 #include "Pvs.h"
 #include "MultiplayerGame.h"
@@ -319,6 +323,8 @@ public:
 
 	idClip					clip;					// collision detection
 	idPush					push;					// geometric pushing
+	idPhysicsIslands		physicsIslands;			// independent groups of physics objects
+	idThinkScheduler		thinkScheduler;			// work done for the thinking entities on the job workers
 	idPVS					pvs;					// potential visible set
 
 	idTestModel *			testmodel;				// for development testing of models
@@ -712,6 +718,7 @@ protected:	// HUMANHEAD
 							// commons used by init, shutdown, and restart
 	void					MapPopulate( void );
 	void					MapClear( bool clearClients );
+	void					PrewarmAASRoutingCache( void );
 
 	pvsHandle_t				GetClientPVS( idPlayer *player, pvsType_t type );
 	void					SetupPlayerPVS( void );
@@ -958,6 +965,7 @@ const int	CINEMATIC_SKIP_DELAY	= SEC2MS( 2.0f );
 #include "script/Script_Compiler.h"
 #include "script/Script_Interpreter.h"
 #include "script/Script_Thread.h"
+#include "script/Script_Profiler.h"
 
 //HUMANHEAD: aob - must be after Script_Thread.h
 #include "../Prey/prey_script_thread.h"
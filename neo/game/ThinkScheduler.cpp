@@ -0,0 +1,142 @@
+/*
+===========================================================================
+
+Doom 3 GPL Source Code
+Copyright (C) 1999-2011 id Software LLC, a ZeniMax Media company.
+
+This file is part of the Doom 3 GPL Source Code ("Doom 3 Source Code").
+
+Doom 3 Source Code is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Doom 3 Source Code is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Doom 3 Source Code.  If not, see <http://www.gnu.org/licenses/>.
+
+In addition, the Doom 3 Source Code is also subject to certain additional terms. You should have received a copy of these additional terms immediately following the terms and conditions of the GNU General Public License which accompanied the Doom 3 Source Code.  If not, please request a copy in writing from id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+
+===========================================================================
+*/
+
+
+#include "precompiled.h"
+#pragma hdrstop
+
+#include "Game_local.h"
+
+/*
+================
+idThinkScheduler::idThinkScheduler
+================
+*/
+idThinkScheduler::idThinkScheduler( void ) {
+	numUsed = 0;
+	numDiscarded = 0;
+	blendMilliseconds = 0.0;
+	frameStartTicks = 0.0;
+}
+
+/*
+================
+idThinkScheduler::BeginFrame
+================
+*/
+void idThinkScheduler::BeginFrame( void ) {
+	animators.SetNum( 0, false );
+	numUsed = 0;
+	numDiscarded = 0;
+	blendMilliseconds = 0.0;
+	frameStartTicks = idLib::sys->GetClockTicks();
+}
+
+/*
+================
+idThinkScheduler::BlendFramesJob
+================
+*/
+void idThinkScheduler::BlendFramesJob( void *data, int first, int last ) {
+	idThinkScheduler *scheduler = static_cast<idThinkScheduler *>( data );
+
+	for ( int i = first; i < last; i++ ) {
+		scheduler->animators[i]->BlendParallelFrame();
+	}
+}
+
+/*
+================
+idThinkScheduler::BlendAnimations
+================
+*/
+void idThinkScheduler::BlendAnimations( void ) {
+	idEntity *ent;
+	idAnimator *animator;
+	double startTicks;
+
+	if ( !g_parallelAnimation.GetBool() || gameLocal.isClient || jobSystem->GetNumWorkers() <= 0 ) {
+		return;
+	}
+
+	// the debug output is printed while blending
+	if ( g_debugAnim.GetInteger() != -1 ) {
+		return;
+	}
+
+	startTicks = idLib::sys->GetClockTicks();
+
+	for ( ent = gameLocal.activeEntities.Next(); ent != NULL; ent = ent->activeNode.Next() ) {
+		if ( !( ent->thinkFlags & TH_ANIMATE ) ) {
+			continue;
+		}
+		animator = ent->GetAnimator();
+		if ( animator == NULL ) {
+			continue;
+		}
+		if ( animator->PrepareParallelFrame( gameLocal.time ) ) {
+			animators.Append( animator );
+		}
+	}
+
+	if ( animators.Num() ) {
+		jobSystem->ParallelFor( animators.Num(), 1, BlendFramesJob, this );
+	}
+
+	blendMilliseconds = ( idLib::sys->GetClockTicks() - startTicks ) * 1000.0 / idLib::sys->ClockTicksPerSecond();
+}
+
+/*
+================
+idThinkScheduler::ParallelFrameUsed
+================
+*/
+void idThinkScheduler::ParallelFrameUsed( bool used ) {
+	if ( used ) {
+		numUsed++;
+	} else {
+		numDiscarded++;
+	}
+}
+
+/*
+================
+idThinkScheduler::EndFrame
+================
+*/
+void idThinkScheduler::EndFrame( void ) {
+	double thinkMilliseconds;
+
+	// also printed without g_parallelAnimation so the serial think time can be compared
+	if ( g_showParallelThink.GetBool() ) {
+		thinkMilliseconds = ( idLib::sys->GetClockTicks() - frameStartTicks ) * 1000.0 / idLib::sys->ClockTicksPerSecond();
+		gameLocal.Printf( "%d: think %1.3f ms, blended %d frames in %1.3f ms, %d used, %d discarded\n", gameLocal.framenum,
+							thinkMilliseconds, animators.Num(), blendMilliseconds, numUsed, numDiscarded );
+	}
+	animators.SetNum( 0, false );
+}
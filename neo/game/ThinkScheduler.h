@@ -0,0 +1,86 @@
+/*
+===========================================================================
+
+Doom 3 GPL Source Code
+Copyright (C) 1999-2011 id Software LLC, a ZeniMax Media company.
+
+This file is part of the Doom 3 GPL Source Code ("Doom 3 Source Code").
+
+Doom 3 Source Code is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Doom 3 Source Code is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Doom 3 Source Code.  If not, see <http://www.gnu.org/licenses/>.
+
+In addition, the Doom 3 Source Code is also subject to certain additional terms. You should have received a copy of these additional terms immediately following the terms and conditions of the GNU General Public License which accompanied the Doom 3 Source Code.  If not, please request a copy in writing from id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+
+===========================================================================
+*/
+
+
+#ifndef __THINKSCHEDULER_H__
+#define __THINKSCHEDULER_H__
+
+/*
+===============================================================================
+
+	Think scheduler.
+
+	Most of what an entity does while it thinks touches state shared with
+	other entities: the clip world, the AAS, the script threads and the event
+	queue. That part runs serially in the usual entity order. The animation
+	frames however only depend on the animator of the entity itself.
+
+	Before the think loop the animators that are going to create a new frame
+	are given a copy of their blend state and the frames are blended on the
+	job workers. When the entity later creates its frame while thinking, the
+	blended frame is only used if the blend state is still exactly the same
+	as the copy, otherwise the frame is blended again as usual. The frames
+	are therefore always the same as without the scheduler and don't depend
+	on the number of workers.
+
+	AI perception is not scheduled. The sight traces can run on the workers
+	with idClip::TraceBatch, but every entity that moves while thinking changes
+	what the entities after it see, so the results could only be reused if no
+	clip model moved in between. The perception of a single AI is batched in
+	idActor::CanSeeBatch instead.
+
+===============================================================================
+*/
+
+class idAnimator;
+
+class idThinkScheduler {
+public:
+							idThinkScheduler( void );
+
+							// called before the think loop
+	void					BeginFrame( void );
+							// blend the animation frames of the active entities on the job workers
+	void					BlendAnimations( void );
+							// called when an animator creates its frame
+	void					ParallelFrameUsed( bool used );
+							// called after the think loop, reports the statistics of the frame
+	void					EndFrame( void );
+
+private:
+	idList<idAnimator *>	animators;				// animators blended on the workers
+	int						numUsed;				// frames used this game frame
+	int						numDiscarded;			// frames blended again this game frame
+	double					blendMilliseconds;		// time spent waiting for the workers
+	double					frameStartTicks;		// clock ticks at the start of the think loop
+
+private:
+	static void				BlendFramesJob( void *data, int first, int last );
+};
+
+#endif /* !__THINKSCHEDULER_H__ */
@@ -2915,18 +2915,24 @@ void idWeapon::Event_LaunchProjectiles( int num_projectiles, float spread, float
 
 	if ( gameLocal.isClient ) {
 
-		// predict instant hit projectiles
-		if ( projectileDict.GetBool( "net_instanthit" ) ) {
+		// predict instant hit projectiles, the pellets are traced in one batch
+		if ( projectileDict.GetBool( "net_instanthit" ) && num_projectiles > 0 ) {
+			idList<clipTrace_t> pellets;
 			float spreadRad = DEG2RAD( spread );
 			muzzle_pos = muzzleOrigin + playerViewAxis[ 0 ] * 2.0f;
+			pellets.SetNum( num_projectiles );
 			for( i = 0; i < num_projectiles; i++ ) {
 				ang = idMath::Sin( spreadRad * gameLocal.random.RandomFloat() );
 				spin = (float)DEG2RAD( 360.0f ) * gameLocal.random.RandomFloat();
 				dir = playerViewAxis[ 0 ] + playerViewAxis[ 2 ] * ( ang * idMath::Sin( spin ) ) - playerViewAxis[ 1 ] * ( ang * idMath::Cos( spin ) );
 				dir.Normalize();
-				gameLocal.clip.Translation( tr, muzzle_pos, muzzle_pos + dir * 4096.0f, NULL, mat3_identity, MASK_SHOT_RENDERMODEL, owner );
-				if ( tr.fraction < 1.0f ) {
-					idProjectile::ClientPredictionCollide( this, projectileDict, tr, vec3_origin, true );
+				pellets[i].start = muzzle_pos;
+				pellets[i].end = muzzle_pos + dir * 4096.0f;
+			}
+			gameLocal.clip.TracePointBatch( pellets.Ptr(), num_projectiles, MASK_SHOT_RENDERMODEL, owner );
+			for( i = 0; i < num_projectiles; i++ ) {
+				if ( pellets[i].results.fraction < 1.0f ) {
+					idProjectile::ClientPredictionCollide( this, projectileDict, pellets[i].results, vec3_origin, true );
 				}
 			}
 		}
@@ -120,6 +120,10 @@ public:
 	virtual void				RemoveObstacle( const aasHandle_t handle ) = 0;
 								// Remove all obstacles from the routing system.
 	virtual void				RemoveAllObstacles( void ) = 0;
+								// Rebuild the routing cache flushed by area state and obstacle changes, spending at most the given time.
+	virtual void				UpdateRoutingCache( float maxMilliseconds ) = 0;
+								// Build the routing cache towards the goal areas ahead of the first path requests.
+	virtual void				PrewarmRoutingCache( const int *goalAreaNums, int numGoalAreas, int travelFlags ) = 0;
 								// Returns the travel time towards the goal area in 100th of a second.
 	virtual int					TravelTimeToGoalArea( int areaNum, const idVec3 &origin, int goalAreaNum, int travelFlags ) const = 0;
 								// Get the travel time and first reachability to be used towards the goal, returns true if there is a path.
@@ -73,6 +73,17 @@ private:
 };
 
 
+class idRoutingRebuild {
+	friend class idAASLocal;
+
+private:
+	int							type;					// portal or area cache
+	int							cluster;				// cluster of the cache
+	int							areaNum;				// area of the cache
+	int							travelFlags;			// combinations of the travel flags
+};
+
+
 class idRoutingObstacle {
 	friend class idAASLocal;
 								idRoutingObstacle( void ) { }
@@ -164,6 +175,8 @@ public:
 	virtual aasHandle_t			AddObstacle( const idBounds &bounds );
 	virtual void				RemoveObstacle( const aasHandle_t handle );
 	virtual void				RemoveAllObstacles( void );
+	virtual void				UpdateRoutingCache( float maxMilliseconds );
+	virtual void				PrewarmRoutingCache( const int *goalAreaNums, int numGoalAreas, int travelFlags );
 	virtual int					TravelTimeToGoalArea( int areaNum, const idVec3 &origin, int goalAreaNum, int travelFlags ) const;
 	virtual bool				RouteToGoalArea( int areaNum, const idVec3 origin, int goalAreaNum, int travelFlags, int &travelTime, idReachability **reach ) const;
 	virtual bool				WalkPathToGoal( aasPath_t &path, int areaNum, const idVec3 &origin, int goalAreaNum, const idVec3 &goalOrigin, int travelFlags ) const;
@@ -193,6 +206,9 @@ private:	// routing data
 	mutable idRoutingCache *	cacheListEnd;			// end of list with cache sorted from oldest to newest
 	mutable int					totalCacheMemory;		// total cache memory used
 	idList<idRoutingObstacle *>	obstacleList;			// list with obstacles
+	idList<idRoutingRebuild>	rebuildList;			// flushed cache to rebuild over the next frames
+	idHashIndex					rebuildHash;			// rebuild list entries hashed by area
+	int							rebuildNext;			// next rebuild list entry
 
 private:	// routing
 	bool						SetupRouting( void );
@@ -201,8 +217,10 @@ private:	// routing
 	void						CalculateAreaTravelTimes( void );
 	void						DeleteAreaTravelTimes( void );
 	void						SetupRoutingCache( void );
-	void						DeleteClusterCache( int clusterNum );
-	void						DeletePortalCache( void );
+	void						DeleteClusterCache( int clusterNum, bool rebuild );
+	void						DeletePortalCache( bool rebuild );
+	void						RebuildCache( const idRoutingCache *cache );
+	void						ClearRebuildList( void );
 	void						ShutdownRoutingCache( void );
 	void						RoutingStats( void ) const;
 	void						LinkCache( idRoutingCache *cache ) const;
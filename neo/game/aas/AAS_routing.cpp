@@ -39,6 +39,9 @@ If you have questions concerning this license or the applicable additional terms
 
 #define LEDGE_TRAVELTIME_PANALTY	250
 
+#define REBUILD_HASH_SIZE			1024
+#define REBUILD_COMPACT_SIZE		256
+
 /*
 ============
 idRoutingCache::idRoutingCache
@@ -212,6 +215,51 @@ void idAASLocal::SetupRoutingCache( void ) {
 
 	cacheListStart = cacheListEnd = NULL;
 	totalCacheMemory = 0;
+
+	ClearRebuildList();
+}
+
+/*
+============
+idAASLocal::RebuildCache
+
+  remember a cache that is about to be deleted so it can be rebuilt over the next frames
+============
+*/
+void idAASLocal::RebuildCache( const idRoutingCache *cache ) {
+	int i, hashKey;
+
+	hashKey = rebuildHash.GenerateKey( cache->areaNum, cache->travelFlags );
+
+	// skip the cache if a rebuild is already pending
+	for ( i = rebuildHash.First( hashKey ); i != -1; i = rebuildHash.Next( i ) ) {
+		if ( i < rebuildNext ) {
+			continue;
+		}
+		const idRoutingRebuild &rebuild = rebuildList[i];
+		if ( rebuild.type == cache->type && rebuild.cluster == cache->cluster &&
+				rebuild.areaNum == cache->areaNum && rebuild.travelFlags == cache->travelFlags ) {
+			return;
+		}
+	}
+
+	idRoutingRebuild &rebuild = rebuildList.Alloc();
+	rebuild.type = cache->type;
+	rebuild.cluster = cache->cluster;
+	rebuild.areaNum = cache->areaNum;
+	rebuild.travelFlags = cache->travelFlags;
+	rebuildHash.Add( hashKey, rebuildList.Num() - 1 );
+}
+
+/*
+============
+idAASLocal::ClearRebuildList
+============
+*/
+void idAASLocal::ClearRebuildList( void ) {
+	rebuildList.Clear();
+	rebuildHash.Clear( REBUILD_HASH_SIZE, REBUILD_HASH_SIZE );
+	rebuildNext = 0;
 }
 
 /*
@@ -219,13 +267,16 @@ void idAASLocal::SetupRoutingCache( void ) {
 idAASLocal::DeleteClusterCache
 ============
 */
-void idAASLocal::DeleteClusterCache( int clusterNum ) {
+void idAASLocal::DeleteClusterCache( int clusterNum, bool rebuild ) {
 	int i;
 	idRoutingCache *cache;
 
 	for ( i = 0; i < file->GetCluster( clusterNum ).numReachableAreas; i++ ) {
 		for ( cache = areaCacheIndex[clusterNum][i]; cache; cache = areaCacheIndex[clusterNum][i] ) {
 			areaCacheIndex[clusterNum][i] = cache->next;
+			if ( rebuild ) {
+				RebuildCache( cache );
+			}
 			UnlinkCache( cache );
 			delete cache;
 		}
@@ -237,13 +288,16 @@ void idAASLocal::DeleteClusterCache( int clusterNum ) {
 idAASLocal::DeletePortalCache
 ============
 */
-void idAASLocal::DeletePortalCache( void ) {
+void idAASLocal::DeletePortalCache( bool rebuild ) {
 	int i;
 	idRoutingCache *cache;
 
 	for ( i = 0; i < file->GetNumAreas(); i++ ) {
 		for ( cache = portalCacheIndex[i]; cache; cache = portalCacheIndex[i] ) {
 			portalCacheIndex[i] = cache->next;
+			if ( rebuild ) {
+				RebuildCache( cache );
+			}
 			UnlinkCache( cache );
 			delete cache;
 		}
@@ -259,10 +313,12 @@ void idAASLocal::ShutdownRoutingCache( void ) {
 	int i;
 
 	for ( i = 0; i < file->GetNumClusters(); i++ ) {
-		DeleteClusterCache( i );
+		DeleteClusterCache( i, false );
 	}
 
-	DeletePortalCache();
+	DeletePortalCache( false );
+
+	ClearRebuildList();
 
 	Mem_Free( areaCacheIndex );
 	areaCacheIndex = NULL;
@@ -343,14 +399,119 @@ void idAASLocal::RemoveRoutingCacheUsingArea( int areaNum ) {
 	clusterNum = file->GetArea( areaNum ).cluster;
 	if ( clusterNum > 0 ) {
 		// remove all the cache in the cluster the area is in
-		DeleteClusterCache( clusterNum );
+		DeleteClusterCache( clusterNum, true );
 	}
 	else {
 		// if this is a portal remove all cache in both the front and back cluster
-		DeleteClusterCache( file->GetPortal( -clusterNum ).clusters[0] );
-		DeleteClusterCache( file->GetPortal( -clusterNum ).clusters[1] );
+		DeleteClusterCache( file->GetPortal( -clusterNum ).clusters[0], true );
+		DeleteClusterCache( file->GetPortal( -clusterNum ).clusters[1], true );
+	}
+	DeletePortalCache( true );
+}
+
+/*
+============
+idAASLocal::UpdateRoutingCache
+
+  rebuild the cache deleted by area and obstacle changes in the order it was removed,
+  spreading the work over several frames instead of stalling the first path query
+============
+*/
+void idAASLocal::UpdateRoutingCache( float maxMilliseconds ) {
+	int i, j;
+	double startTicks, maxTicks;
+
+	if ( !file || rebuildNext >= rebuildList.Num() ) {
+		return;
+	}
+
+	// don't rebuild cache that would only push out the cache in use
+	if ( maxMilliseconds <= 0.0f || totalCacheMemory > MAX_ROUTING_CACHE_MEMORY ) {
+		ClearRebuildList();
+		return;
+	}
+
+	startTicks = idLib::sys->GetClockTicks();
+	maxTicks = maxMilliseconds * idLib::sys->ClockTicksPerSecond() / 1000.0;
+
+	while( rebuildNext < rebuildList.Num() ) {
+		const idRoutingRebuild &rebuild = rebuildList[rebuildNext++];
+
+		// a path query may already have rebuilt the cache
+		if ( rebuild.type == CACHETYPE_AREA ) {
+			GetAreaRoutingCache( rebuild.cluster, rebuild.areaNum, rebuild.travelFlags );
+		} else {
+			GetPortalRoutingCache( rebuild.cluster, rebuild.areaNum, rebuild.travelFlags );
+		}
+
+		if ( idLib::sys->GetClockTicks() - startTicks >= maxTicks ) {
+			break;
+		}
+	}
+
+	if ( rebuildNext >= rebuildList.Num() ) {
+		ClearRebuildList();
+		return;
+	}
+
+	// drop the entries already rebuilt when the list keeps growing
+	if ( rebuildNext >= REBUILD_COMPACT_SIZE && rebuildNext * 2 >= rebuildList.Num() ) {
+		rebuildHash.Clear();
+		for ( i = rebuildNext, j = 0; i < rebuildList.Num(); i++, j++ ) {
+			rebuildList[j] = rebuildList[i];
+			rebuildHash.Add( rebuildHash.GenerateKey( rebuildList[j].areaNum, rebuildList[j].travelFlags ), j );
+		}
+		rebuildList.SetNum( j, false );
+		rebuildNext = 0;
+	}
+}
+
+/*
+============
+idAASLocal::PrewarmRoutingCache
+
+  build the area and portal cache towards likely goal areas while the map is loading
+============
+*/
+void idAASLocal::PrewarmRoutingCache( const int *goalAreaNums, int numGoalAreas, int travelFlags ) {
+	int i, goalAreaNum, clusterNum, numPrewarmed;
+	idTimer timer;
+
+	if ( !file ) {
+		return;
+	}
+
+	timer.Start();
+	numPrewarmed = 0;
+
+	for ( i = 0; i < numGoalAreas; i++ ) {
+		goalAreaNum = goalAreaNums[i];
+		if ( goalAreaNum <= 0 || goalAreaNum >= file->GetNumAreas() ) {
+			continue;
+		}
+
+		// leave room for the cache built during play
+		if ( totalCacheMemory > MAX_ROUTING_CACHE_MEMORY / 2 ) {
+			break;
+		}
+
+		// just assume a portal goal area is part of the front cluster like RouteToGoalArea does
+		clusterNum = file->GetArea( goalAreaNum ).cluster;
+		if ( clusterNum < 0 ) {
+			clusterNum = file->GetPortal( -clusterNum ).clusters[0];
+		}
+
+		GetAreaRoutingCache( clusterNum, goalAreaNum, travelFlags );
+		GetPortalRoutingCache( clusterNum, goalAreaNum, travelFlags );
+		numPrewarmed++;
+	}
+
+	timer.Stop();
+
+	if ( numPrewarmed ) {
+		gameLocal.Printf( "%s: prewarmed routing cache for %d goal areas (%d KB) in %u msec\n", file->GetName(),
+							numPrewarmed, totalCacheMemory >> 10, timer.Milliseconds() );
 	}
-	DeletePortalCache();
 }
 
 /*
@@ -319,11 +319,14 @@ idAI::Event_FindEnemy
 =====================
 */
 void idAI::Event_FindEnemy( int useFOV ) {
-	int			i;
+	int			i, numActors;
 	idEntity	*ent;
 	idActor		*actor;
+	idEntity	*actors[MAX_CLIENTS];
+	int			sight[MAX_CLIENTS];
 
 	if ( gameLocal.InPlayerPVS( this ) ) {
+		numActors = 0;
 		for ( i = 0; i < gameLocal.numClients ; i++ ) {
 			ent = gameLocal.entities[ i ];
 
@@ -336,8 +339,15 @@ void idAI::Event_FindEnemy( int useFOV ) {
 				continue;
 			}
 
-			if ( CanSee( actor, useFOV != 0 ) ) {
-				idThread::ReturnEntity( actor );
+			actors[numActors++] = actor;
+		}
+
+		// trace to all the clients at once and return the first one seen
+		CanSeeBatch( actors, numActors, useFOV != 0, sight );
+
+		for ( i = 0; i < numActors; i++ ) {
+			if ( sight[i] == SIGHT_VISIBLE || ( sight[i] == SIGHT_CHECK && CanSee( actors[i], useFOV != 0 ) ) ) {
+				idThread::ReturnEntity( actors[i] );
 				return;
 			}
 		}
@@ -352,6 +362,7 @@ idAI::Event_FindEnemyAI
 =====================
 */
 void idAI::Event_FindEnemyAI( int useFOV ) {
+	int			i, numActors;
 	idEntity	*ent;
 	idActor		*actor;
 	idActor		*bestEnemy;
@@ -359,11 +370,13 @@ void idAI::Event_FindEnemyAI( int useFOV ) {
 	float		dist;
 	idVec3		delta;
 	pvsHandle_t pvs;
+	idEntity	*actors[MAX_GENTITIES];
+	float		actorDist[MAX_GENTITIES];
+	int			sight[MAX_GENTITIES];
 
 	pvs = gameLocal.pvs.SetupCurrentPVS( GetPVSAreas(), GetNumPVSAreas() );
 
-	bestDist = idMath::INFINITY;
-	bestEnemy = NULL;
+	numActors = 0;
 	for ( ent = gameLocal.activeEntities.Next(); ent != NULL; ent = ent->activeNode.Next() ) {
 		if ( ent->fl.hidden || ent->fl.isDormant || !ent->IsType( idActor::Type ) ) {
 			continue;
@@ -379,14 +392,25 @@ void idAI::Event_FindEnemyAI( int useFOV ) {
 		}
 
 		delta = physicsObj.GetOrigin() - actor->GetPhysics()->GetOrigin();
-		dist = delta.LengthSqr();
-		if ( ( dist < bestDist ) && CanSee( actor, useFOV != 0 ) ) {
+		actorDist[numActors] = delta.LengthSqr();
+		actors[numActors++] = actor;
+	}
+
+	gameLocal.pvs.FreeCurrentPVS( pvs );
+
+	// trace to all the candidates at once and take the closest one seen
+	CanSeeBatch( actors, numActors, useFOV != 0, sight );
+
+	bestDist = idMath::INFINITY;
+	bestEnemy = NULL;
+	for ( i = 0; i < numActors; i++ ) {
+		dist = actorDist[i];
+		if ( ( dist < bestDist ) && ( sight[i] == SIGHT_VISIBLE || ( sight[i] == SIGHT_CHECK && CanSee( actors[i], useFOV != 0 ) ) ) ) {
 			bestDist = dist;
-			bestEnemy = actor;
+			bestEnemy = static_cast<idActor *>( actors[i] );
 		}
 	}
 
-	gameLocal.pvs.FreeCurrentPVS( pvs );
 	idThread::ReturnEntity( bestEnemy );
 }
 
@@ -563,6 +563,10 @@ public:
 	void						ForceUpdate( void );
 	void						ClearForceUpdate( void );
 	bool						CreateFrame( int animtime, bool force );
+								// the frame can be blended on a job worker ahead of the think loop, CreateFrame
+								// uses it only if nothing the frame depends on changed in the mean time
+	bool						PrepareParallelFrame( int currentTime );
+	void						BlendParallelFrame( void );
 	virtual		// HUMANHEAD nla
 	bool						FrameHasChanged( int animtime ) const;
 	void						GetDelta( int fromtime, int totime, idVec3 &delta ) const;
@@ -611,6 +615,8 @@ public:
 private:
 	void						FreeData( void );
 	void						PushAnims( int channel, int currentTime, int blendTime );
+	bool						BlendFrame( int currentTime, idJointMat *frameJoints, bool debugInfo ) const;
+	bool						ParallelFrameValid( int currentTime ) const;
 
 protected:		// HUMANEAD nla - For access in hhAnimator
 	const idDeclModelDef *		modelDef;
@@ -638,6 +644,16 @@ protected:		// HUMANEAD nla - For access in hhAnimator
 	idList<idJointQuat>			AFPoseJointFrame;
 	idBounds					AFPoseBounds;
 	int							AFPoseTime;
+
+								// frame blended ahead of the think loop and the input it was blended from
+	int							parallelFrameTime;
+	bool						parallelFrameResult;
+	int							parallelNumJoints;
+	idJointMat *				parallelJoints;
+	byte *						parallelChannels;
+	idList<jointMod_t>			parallelJointMods;
+	const idDeclModelDef *		parallelModelDef;
+	bool						parallelRemoveOriginOffset;
 };
 
 /*
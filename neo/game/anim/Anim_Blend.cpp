@@ -2159,6 +2159,14 @@ idAnimator::idAnimator() {
 
 	ClearAFPose();
 
+	parallelFrameTime			= -1;
+	parallelFrameResult			= false;
+	parallelNumJoints			= 0;
+	parallelJoints				= NULL;
+	parallelChannels			= NULL;
+	parallelModelDef			= NULL;
+	parallelRemoveOriginOffset	= false;
+
 	for( i = ANIMCHANNEL_ALL; i < ANIM_NumAnimChannels; i++ ) {
 		for( j = 0; j < ANIM_MaxAnimsPerChannel; j++ ) {
 			channels[ i ][ j ].Reset( NULL );
@@ -2364,6 +2372,14 @@ void idAnimator::FreeData( void ) {
 	joints = NULL;
 	numJoints = 0;
 
+	Mem_Free16( parallelJoints );
+	parallelJoints = NULL;
+	parallelNumJoints = 0;
+	Mem_Free( parallelChannels );
+	parallelChannels = NULL;
+	parallelJointMods.Clear();
+	parallelFrameTime = -1;
+
 	modelDef = NULL;
 
 	ForceUpdate();
@@ -3318,17 +3334,8 @@ idAnimator::CreateFrame
 =====================
 */
 bool idAnimator::CreateFrame( int currentTime, bool force ) {
-	int					i, j;
-	int					numJoints;
-	int					parentNum;
-	bool				hasAnim;
 	bool				debugInfo;
-	float				baseBlend;
-	float				blendWeight;
-	const idAnimBlend *	blend;
-	const int *			jointParent;
-	const jointMod_t *	jointMod;
-	const idJointQuat *	defaultPose;
+	bool				parallelFrameValid;
 
 	static idCVar		r_showSkel( "r_showSkel", "0", CVAR_RENDERER | CVAR_INTEGER, "", 0, 2, idCmdSystem::ArgCompletion_Integer<0,2> );
 
@@ -3364,6 +3371,41 @@ bool idAnimator::CreateFrame( int currentTime, bool force ) {
 		debugInfo = false;
 	}
 
+	// use the frame blended on a job worker if it was blended from the same input
+	if ( parallelFrameTime != -1 ) {
+		parallelFrameValid = !debugInfo && ParallelFrameValid( currentTime );
+		parallelFrameTime = -1;
+		gameLocal.thinkScheduler.ParallelFrameUsed( parallelFrameValid );
+		if ( parallelFrameValid ) {
+			if ( parallelFrameResult ) {
+				SIMDProcessor->Memcpy( joints, parallelJoints, parallelNumJoints * sizeof( joints[0] ) );
+			}
+			return parallelFrameResult;
+		}
+	}
+
+	return BlendFrame( currentTime, joints, debugInfo );
+}
+
+/*
+=====================
+idAnimator::BlendFrame
+
+  blends all animations, the articulated figure pose and the joint modifiers into frameJoints
+=====================
+*/
+bool idAnimator::BlendFrame( int currentTime, idJointMat *frameJoints, bool debugInfo ) const {
+	int					i, j;
+	int					numJoints;
+	int					parentNum;
+	bool				hasAnim;
+	float				baseBlend;
+	float				blendWeight;
+	const idAnimBlend *	blend;
+	const int *			jointParent;
+	const jointMod_t *	jointMod;
+	const idJointQuat *	defaultPose;
+
 	// init the joint buffer
 	if ( AFPoseJoints.Num() ) {
 		// initialize with AF pose anim for the case where there are no other animations and no AF pose joint modifications
@@ -3449,7 +3491,7 @@ bool idAnimator::CreateFrame( int currentTime, bool force ) {
 	}
 
 	// convert the joint quaternions to rotation matrices
-	SIMDProcessor->ConvertJointQuatsToJointMats( joints, jointFrame, numJoints );
+	SIMDProcessor->ConvertJointQuatsToJointMats( frameJoints, jointFrame, numJoints );
 
 	// check if we need to modify the origin
 	if ( jointMods.Num() && ( jointMods[0]->jointnum == 0 ) ) {
@@ -3460,16 +3502,16 @@ bool idAnimator::CreateFrame( int currentTime, bool force ) {
 				break;
 
 			case JOINTMOD_LOCAL:
-				joints[0].SetRotation( jointMod->mat * joints[0].ToMat3() );
+				frameJoints[0].SetRotation( jointMod->mat * frameJoints[0].ToMat3() );
 				break;
 
 			case JOINTMOD_WORLD:
-				joints[0].SetRotation( joints[0].ToMat3() * jointMod->mat );
+				frameJoints[0].SetRotation( frameJoints[0].ToMat3() * jointMod->mat );
 				break;
 
 			case JOINTMOD_LOCAL_OVERRIDE:
 			case JOINTMOD_WORLD_OVERRIDE:
-				joints[0].SetRotation( jointMod->mat );
+				frameJoints[0].SetRotation( jointMod->mat );
 				break;
 		}
 
@@ -3478,13 +3520,13 @@ bool idAnimator::CreateFrame( int currentTime, bool force ) {
 				break;
 
 			case JOINTMOD_LOCAL:
-				joints[0].SetTranslation( joints[0].ToVec3() + jointMod->pos );
+				frameJoints[0].SetTranslation( frameJoints[0].ToVec3() + jointMod->pos );
 				break;
 
 			case JOINTMOD_LOCAL_OVERRIDE:
 			case JOINTMOD_WORLD:
 			case JOINTMOD_WORLD_OVERRIDE:
-				joints[0].SetTranslation( jointMod->pos );
+				frameJoints[0].SetTranslation( jointMod->pos );
 				break;
 		}
 		j = 1;
@@ -3493,7 +3535,7 @@ bool idAnimator::CreateFrame( int currentTime, bool force ) {
 	}
 
 	// add in the model offset
-	joints[0].SetTranslation( joints[0].ToVec3() + modelDef->GetVisualOffset() );
+	frameJoints[0].SetTranslation( frameJoints[0].ToVec3() + modelDef->GetVisualOffset() );
 
 	// pointer to joint info
 	jointParent = modelDef->JointParents();
@@ -3503,7 +3545,7 @@ bool idAnimator::CreateFrame( int currentTime, bool force ) {
 		jointMod = jointMods[j];
 
 		// transform any joints preceding the joint modifier
-		SIMDProcessor->TransformJoints( joints, jointParent, i, jointMod->jointnum - 1 );
+		SIMDProcessor->TransformJoints( frameJoints, jointParent, i, jointMod->jointnum - 1 );
 		i = jointMod->jointnum;
 
 		parentNum = jointParent[i];
@@ -3511,53 +3553,154 @@ bool idAnimator::CreateFrame( int currentTime, bool force ) {
 		// modify the axis
 		switch( jointMod->transform_axis ) {
 			case JOINTMOD_NONE:
-				joints[i].SetRotation( joints[i].ToMat3() * joints[ parentNum ].ToMat3() );
+				frameJoints[i].SetRotation( frameJoints[i].ToMat3() * frameJoints[ parentNum ].ToMat3() );
 				break;
 
 			case JOINTMOD_LOCAL:
-				joints[i].SetRotation( jointMod->mat * ( joints[i].ToMat3() * joints[parentNum].ToMat3() ) );
+				frameJoints[i].SetRotation( jointMod->mat * ( frameJoints[i].ToMat3() * frameJoints[parentNum].ToMat3() ) );
 				break;
 
 			case JOINTMOD_LOCAL_OVERRIDE:
-				joints[i].SetRotation( jointMod->mat * joints[parentNum].ToMat3() );
+				frameJoints[i].SetRotation( jointMod->mat * frameJoints[parentNum].ToMat3() );
 				break;
 
 			case JOINTMOD_WORLD:
-				joints[i].SetRotation( ( joints[i].ToMat3() * joints[parentNum].ToMat3() ) * jointMod->mat );
+				frameJoints[i].SetRotation( ( frameJoints[i].ToMat3() * frameJoints[parentNum].ToMat3() ) * jointMod->mat );
 				break;
 
 			case JOINTMOD_WORLD_OVERRIDE:
-				joints[i].SetRotation( jointMod->mat );
+				frameJoints[i].SetRotation( jointMod->mat );
 				break;
 		}
 
 		// modify the position
 		switch( jointMod->transform_pos ) {
 			case JOINTMOD_NONE:
-				joints[i].SetTranslation( joints[parentNum].ToVec3() + joints[i].ToVec3() * joints[parentNum].ToMat3() );
+				frameJoints[i].SetTranslation( frameJoints[parentNum].ToVec3() + frameJoints[i].ToVec3() * frameJoints[parentNum].ToMat3() );
 				break;
 
 			case JOINTMOD_LOCAL:
-				joints[i].SetTranslation( joints[parentNum].ToVec3() + ( joints[i].ToVec3() + jointMod->pos ) * joints[parentNum].ToMat3() );
+				frameJoints[i].SetTranslation( frameJoints[parentNum].ToVec3() + ( frameJoints[i].ToVec3() + jointMod->pos ) * frameJoints[parentNum].ToMat3() );
 				break;
 
 			case JOINTMOD_LOCAL_OVERRIDE:
-				joints[i].SetTranslation( joints[parentNum].ToVec3() + jointMod->pos * joints[parentNum].ToMat3() );
+				frameJoints[i].SetTranslation( frameJoints[parentNum].ToVec3() + jointMod->pos * frameJoints[parentNum].ToMat3() );
 				break;
 
 			case JOINTMOD_WORLD:
-				joints[i].SetTranslation( joints[parentNum].ToVec3() + joints[i].ToVec3() * joints[parentNum].ToMat3() + jointMod->pos );
+				frameJoints[i].SetTranslation( frameJoints[parentNum].ToVec3() + frameJoints[i].ToVec3() * frameJoints[parentNum].ToMat3() + jointMod->pos );
 				break;
 
 			case JOINTMOD_WORLD_OVERRIDE:
-				joints[i].SetTranslation( jointMod->pos );
+				frameJoints[i].SetTranslation( jointMod->pos );
 				break;
 		}
 	}
 
 	// transform the rest of the hierarchy
-	SIMDProcessor->TransformJoints( joints, jointParent, i, numJoints - 1 );
+	SIMDProcessor->TransformJoints( frameJoints, jointParent, i, numJoints - 1 );
+
+	return true;
+}
+
+/*
+=====================
+idAnimator::PrepareParallelFrame
+
+  Called from the main thread before the entity thinks. Returns true if CreateFrame is
+  going to blend a new frame for the current time and the frame can be blended on a job
+  worker. The input of the blend is copied so CreateFrame can tell if it changed.
+=====================
+*/
+bool idAnimator::PrepareParallelFrame( int currentTime ) {
+	int i, n;
+	const idAnimBlend *blend;
+
+	parallelFrameTime = -1;
+
+	if ( !modelDef || !modelDef->ModelHandle() || !modelDef->GetDefaultPose() ) {
+		return false;
+	}
 
+	// articulated figure poses are set while the entity thinks
+	if ( AFPoseJoints.Num() ) {
+		return false;
+	}
+
+	// frozen anims update their times while blending
+	blend = channels[ 0 ];
+	for( i = 0; i < ANIM_NumAnimChannels * ANIM_MaxAnimsPerChannel; i++, blend++ ) {
+		if ( blend->frozen ) {
+			return false;
+		}
+	}
+
+	// same tests as CreateFrame
+	if ( lastTransformTime == currentTime ) {
+		return false;
+	}
+	if ( lastTransformTime != -1 && !stoppedAnimatingUpdate && !IsAnimating( currentTime ) ) {
+		return false;
+	}
+
+	n = modelDef->Joints().Num();
+	if ( parallelNumJoints != n ) {
+		Mem_Free16( parallelJoints );
+		parallelJoints = ( idJointMat * )Mem_Alloc16( n * sizeof( parallelJoints[0] ) );
+		parallelNumJoints = n;
+	}
+	if ( !parallelChannels ) {
+		parallelChannels = ( byte * )Mem_Alloc( sizeof( channels ) );
+	}
+
+	memcpy( parallelChannels, ( const void * )channels, sizeof( channels ) );
+	parallelJointMods.SetNum( jointMods.Num(), false );
+	for( i = 0; i < jointMods.Num(); i++ ) {
+		parallelJointMods[i] = *jointMods[i];
+	}
+	parallelModelDef = modelDef;
+	parallelRemoveOriginOffset = removeOriginOffset;
+	parallelFrameTime = currentTime;
+
+	return true;
+}
+
+/*
+=====================
+idAnimator::BlendParallelFrame
+
+  Called from a job worker, only touches the parallel frame.
+=====================
+*/
+void idAnimator::BlendParallelFrame( void ) {
+	parallelFrameResult = BlendFrame( parallelFrameTime, parallelJoints, false );
+}
+
+/*
+=====================
+idAnimator::ParallelFrameValid
+=====================
+*/
+bool idAnimator::ParallelFrameValid( int currentTime ) const {
+	int i;
+
+	if ( parallelFrameTime != currentTime || parallelModelDef != modelDef || parallelRemoveOriginOffset != removeOriginOffset ) {
+		return false;
+	}
+	if ( AFPoseJoints.Num() || parallelNumJoints != modelDef->Joints().Num() ) {
+		return false;
+	}
+	if ( memcmp( parallelChannels, ( const void * )channels, sizeof( channels ) ) != 0 ) {
+		return false;
+	}
+	if ( parallelJointMods.Num() != jointMods.Num() ) {
+		return false;
+	}
+	for( i = 0; i < jointMods.Num(); i++ ) {
+		if ( memcmp( &parallelJointMods[i], jointMods[i], sizeof( jointMod_t ) ) != 0 ) {
+			return false;
+		}
+	}
 	return true;
 }
 
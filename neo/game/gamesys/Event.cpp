@@ -232,12 +232,61 @@ const idEventDef *idEventDef::FindEvent( int eventId ) {
 
 ***********************************************************************/
 
+#define EVENT_NEAR_BITS				10
+#define EVENT_NEAR_SIZE				( 1 << EVENT_NEAR_BITS )
+#define EVENT_NEAR_MASK				( EVENT_NEAR_SIZE - 1 )
+#define EVENT_FAR_BITS				8
+#define EVENT_FAR_SIZE				( 1 << EVENT_FAR_BITS )
+#define EVENT_FAR_MASK				( EVENT_FAR_SIZE - 1 )
+#define EVENT_SPAN_BITS				( EVENT_NEAR_BITS + EVENT_FAR_BITS )
+#define EVENT_SPAN_MASK				( ( 1 << EVENT_SPAN_BITS ) - 1 )
+#define EVENT_OBJECT_HASH_SIZE		1024
+
+typedef enum {
+	EVENT_QUEUE_NONE,
+	EVENT_QUEUE_LATE,
+	EVENT_QUEUE_NEAR,
+	EVENT_QUEUE_FAR,
+	EVENT_QUEUE_OVERFLOW,
+	EVENT_QUEUE_NUM
+} eventQueue_t;
+
+typedef struct eventStats_s {
+	int						scheduled;
+	int						canceled;
+	int						serviced;
+	int						late;				// events scheduled before the wheel time
+	int						maxQueued;
+	int						maxServicedFrame;
+	int						lastServicedFrame;
+	double					totalDelay;			// milliseconds between the event time and servicing it
+	int						maxDelay;
+} eventStats_t;
+
 static idLinkList<idEvent> FreeEvents;
-static idLinkList<idEvent> EventQueue;
+static idLinkList<idEvent> LateEvents;
+static idLinkList<idEvent> NearEvents[ EVENT_NEAR_SIZE ];
+static idLinkList<idEvent> FarEvents[ EVENT_FAR_SIZE ];
+static idLinkList<idEvent> OverflowEvents;
+static idHashIndex ObjectEvents;
 static idEvent EventPool[ MAX_EVENTS ];
 
+static int eventWheelTime = 0;					// time of the near wheel list serviced next
+static int eventsQueued[ EVENT_QUEUE_NUM ];
+static eventStats_t eventStats;
+
 bool idEvent::initialized = false;
 
+/*
+================
+EventObjectKey
+================
+*/
+static ID_INLINE int EventObjectKey( const idClass *obj ) {
+	uintptr_t p = reinterpret_cast<uintptr_t>( obj );
+	return ObjectEvents.GenerateKey( (int)( p >> 4 ), (int)( p >> 14 ) );
+}
+
 idDynamicBlockAlloc<byte, 16 * 1024, 256>	idEvent::eventDataAllocator;
 
 /*
@@ -387,6 +436,8 @@ idEvent::Free
 ================
 */
 void idEvent::Free( void ) {
+	Unqueue();
+
 	if ( data ) {
 		eventDataAllocator.Free( data );
 		data = NULL;
@@ -403,35 +454,170 @@ void idEvent::Free( void ) {
 
 /*
 ================
-idEvent::Schedule
+idEvent::NumQueued
 ================
 */
-void idEvent::Schedule( idClass *obj, const idTypeInfo *type, int time ) {
+int idEvent::NumQueued( void ) {
+	return eventsQueued[ EVENT_QUEUE_LATE ] + eventsQueued[ EVENT_QUEUE_NEAR ] + eventsQueued[ EVENT_QUEUE_FAR ] + eventsQueued[ EVENT_QUEUE_OVERFLOW ];
+}
+
+/*
+================
+idEvent::InsertSorted
+================
+*/
+void idEvent::InsertSorted( idLinkList<idEvent> &list ) {
+	idEvent *event;
+
+	event = list.Next();
+	while( ( event != NULL ) && ( time >= event->time ) ) {
+		event = event->eventNode.Next();
+	}
+
+	if ( event ) {
+		eventNode.InsertBefore( event->eventNode );
+	} else {
+		eventNode.AddToEnd( list );
+	}
+}
+
+/*
+================
+idEvent::Insert
+
+Adds the event to the list for its time, behind the events with the same time.
+================
+*/
+void idEvent::Insert( void ) {
+	if ( time < eventWheelTime ) {
+		if ( !NumQueued() ) {
+			eventWheelTime = time;
+		} else {
+			InsertSorted( LateEvents );
+			queue = EVENT_QUEUE_LATE;
+			eventsQueued[ queue ]++;
+			return;
+		}
+	}
+
+	if ( ( time >> EVENT_NEAR_BITS ) == ( eventWheelTime >> EVENT_NEAR_BITS ) ) {
+		eventNode.AddToEnd( NearEvents[ time & EVENT_NEAR_MASK ] );
+		queue = EVENT_QUEUE_NEAR;
+	} else if ( ( time >> EVENT_SPAN_BITS ) == ( eventWheelTime >> EVENT_SPAN_BITS ) ) {
+		eventNode.AddToEnd( FarEvents[ ( time >> EVENT_NEAR_BITS ) & EVENT_FAR_MASK ] );
+		queue = EVENT_QUEUE_FAR;
+	} else {
+		InsertSorted( OverflowEvents );
+		queue = EVENT_QUEUE_OVERFLOW;
+	}
+	eventsQueued[ queue ]++;
+}
+
+/*
+================
+idEvent::Unqueue
+================
+*/
+void idEvent::Unqueue( void ) {
+	if ( queue == EVENT_QUEUE_NONE ) {
+		return;
+	}
+
+	eventsQueued[ queue ]--;
+	queue = EVENT_QUEUE_NONE;
+	eventNode.Remove();
+	ObjectEvents.Remove( EventObjectKey( object ), this - EventPool );
+}
+
+/*
+================
+idEvent::MoveEvents
+
+Inserts the events of the list again after the wheel time entered a new block or span.
+================
+*/
+void idEvent::MoveEvents( idLinkList<idEvent> &list ) {
 	idEvent *event;
 
+	while( !list.IsListEmpty() ) {
+		event = list.Next();
+		if ( ( event->time >> EVENT_SPAN_BITS ) != ( eventWheelTime >> EVENT_SPAN_BITS ) ) {
+			// the overflow list is sorted so the rest is in a later span
+			break;
+		}
+		eventsQueued[ event->queue ]--;
+		event->eventNode.Remove();
+		event->Insert();
+	}
+}
+
+/*
+================
+idEvent::AdvanceQueue
+
+Moves the wheel time forward, skipping the parts of the wheel without events, but not past toTime.
+================
+*/
+void idEvent::AdvanceQueue( int toTime ) {
+	int next;
+
+	if ( eventsQueued[ EVENT_QUEUE_NEAR ] ) {
+		next = eventWheelTime + 1;
+	} else if ( eventsQueued[ EVENT_QUEUE_FAR ] ) {
+		next = ( eventWheelTime | EVENT_NEAR_MASK ) + 1;
+	} else if ( eventsQueued[ EVENT_QUEUE_OVERFLOW ] ) {
+		next = ( eventWheelTime | EVENT_SPAN_MASK ) + 1;
+	} else {
+		next = toTime;
+	}
+
+	if ( next > toTime ) {
+		// there are no events in the blocks entered before toTime
+		eventWheelTime = toTime;
+		return;
+	}
+
+	eventWheelTime = next;
+	if ( eventWheelTime & EVENT_NEAR_MASK ) {
+		return;
+	}
+	if ( !( eventWheelTime & EVENT_SPAN_MASK ) ) {
+		MoveEvents( OverflowEvents );
+	}
+	MoveEvents( FarEvents[ ( eventWheelTime >> EVENT_NEAR_BITS ) & EVENT_FAR_MASK ] );
+}
+
+/*
+================
+idEvent::Schedule
+================
+*/
+void idEvent::Schedule( idClass *obj, const idTypeInfo *type, int time ) {
 	assert( initialized );
 	if ( !initialized ) {
 		return;
 	}
 
+	Unqueue();
+
 	object = obj;
 	typeinfo = type;
 
 	// wraps after 24 days...like I care. ;)
 	this->time = gameLocal.time + time;
 
-	eventNode.Remove();
-
-	event = EventQueue.Next();
-	while( ( event != NULL ) && ( this->time >= event->time ) ) {
-		event = event->eventNode.Next();
+	if ( !NumQueued() ) {
+		eventWheelTime = Min( this->time, gameLocal.time );
 	}
 
-	if ( event ) {
-		eventNode.InsertBefore( event->eventNode );
-	} else {
-		eventNode.AddToEnd( EventQueue );
+	Insert();
+	ObjectEvents.Add( EventObjectKey( object ), this - EventPool );
+
+	eventStats.scheduled++;
+	if ( queue == EVENT_QUEUE_LATE ) {
+		eventStats.late++;
 	}
+	eventStats.maxQueued = Max( eventStats.maxQueued, NumQueued() );
 }
 
 /*
@@ -441,17 +627,19 @@ idEvent::CancelEvents
 */
 void idEvent::CancelEvents( const idClass *obj, const idEventDef *evdef ) {
 	idEvent *event;
-	idEvent *next;
+	int i, next;
 
 	if ( !initialized ) {
 		return;
 	}
 
-	for( event = EventQueue.Next(); event != NULL; event = next ) {
-		next = event->eventNode.Next();
+	for( i = ObjectEvents.First( EventObjectKey( obj ) ); i != -1; i = next ) {
+		next = ObjectEvents.Next( i );
+		event = &EventPool[ i ];
 		if ( event->object == obj ) {
 			if ( !evdef || ( evdef == event->eventdef ) ) {
 				event->Free();
+				eventStats.canceled++;
 			}
 		}
 	}
@@ -469,16 +657,80 @@ void idEvent::ClearEventList( void ) {
 	// initialize lists
 	//
 	FreeEvents.Clear();
-	EventQueue.Clear();
+	LateEvents.Clear();
+	for( i = 0; i < EVENT_NEAR_SIZE; i++ ) {
+		NearEvents[ i ].Clear();
+	}
+	for( i = 0; i < EVENT_FAR_SIZE; i++ ) {
+		FarEvents[ i ].Clear();
+	}
+	OverflowEvents.Clear();
+	ObjectEvents.Clear( EVENT_OBJECT_HASH_SIZE, MAX_EVENTS );
+	memset( eventsQueued, 0, sizeof( eventsQueued ) );
+	eventWheelTime = 0;
 
 	//
 	// add the events to the free list
 	//
 	for( i = 0; i < MAX_EVENTS; i++ ) {
+		EventPool[ i ].queue = EVENT_QUEUE_NONE;
 		EventPool[ i ].Free();
 	}
 }
 
+/*
+================
+idEvent::ClearStats
+================
+*/
+void idEvent::ClearStats( void ) {
+	memset( &eventStats, 0, sizeof( eventStats ) );
+}
+
+/*
+================
+idEvent::PrintStats
+================
+*/
+void idEvent::PrintStats( int count ) {
+	idList<int>	numEvents;
+	idList<int>	sorted;
+	int			i, j, num;
+
+	if ( !initialized ) {
+		gameLocal.Printf( "event system not initialized\n" );
+		return;
+	}
+
+	gameLocal.Printf( "%d queued events, %d peak, wheel time %d\n", NumQueued(), eventStats.maxQueued, eventWheelTime );
+	gameLocal.Printf( "%5d late\n%5d near\n%5d far\n%5d overflow\n", eventsQueued[ EVENT_QUEUE_LATE ], eventsQueued[ EVENT_QUEUE_NEAR ],
+						eventsQueued[ EVENT_QUEUE_FAR ], eventsQueued[ EVENT_QUEUE_OVERFLOW ] );
+	gameLocal.Printf( "%d scheduled (%d late), %d canceled, %d serviced\n", eventStats.scheduled, eventStats.late, eventStats.canceled, eventStats.serviced );
+	gameLocal.Printf( "%d serviced last frame, %d peak\n", eventStats.lastServicedFrame, eventStats.maxServicedFrame );
+	gameLocal.Printf( "service delay %1.2f ms average, %d ms max\n", eventStats.serviced ? eventStats.totalDelay / eventStats.serviced : 0.0, eventStats.maxDelay );
+
+	// queued events per event definition
+	numEvents.AssureSize( idEventDef::NumEventCommands(), 0 );
+	for( i = 0; i < MAX_EVENTS; i++ ) {
+		if ( EventPool[ i ].queue != EVENT_QUEUE_NONE ) {
+			numEvents[ EventPool[ i ].eventdef->GetEventNum() ]++;
+		}
+	}
+	for( i = 0; i < numEvents.Num(); i++ ) {
+		if ( !numEvents[ i ] ) {
+			continue;
+		}
+		for( j = 0; j < sorted.Num() && numEvents[ sorted[ j ] ] >= numEvents[ i ]; j++ ) {
+		}
+		sorted.Insert( i, j );
+	}
+
+	num = Min( count, sorted.Num() );
+	for( i = 0; i < num; i++ ) {
+		gameLocal.Printf( "%5d %s\n", numEvents[ sorted[ i ] ], idEventDef::GetEventCommand( sorted[ i ] )->GetName() );
+	}
+}
+
 /*
 ================
 idEvent::ServiceEvents
@@ -498,13 +750,27 @@ void idEvent::ServiceEvents( void ) {
 	const char  *materialName;
 
 	num = 0;
-	while( !EventQueue.IsListEmpty() ) {
-		event = EventQueue.Next();
-		assert( event );
-
-		if ( event->time > gameLocal.time ) {
-			break;
+	while( 1 ) {
+		if ( !LateEvents.IsListEmpty() ) {
+			// the late events are before all events in the wheel
+			event = LateEvents.Next();
+			if ( event->time > gameLocal.time ) {
+				break;
+			}
+		} else {
+			if ( eventWheelTime > gameLocal.time ) {
+				break;
+			}
+			event = NearEvents[ eventWheelTime & EVENT_NEAR_MASK ].Next();
+			if ( !event ) {
+				if ( eventWheelTime == gameLocal.time ) {
+					break;
+				}
+				AdvanceQueue( gameLocal.time );
+				continue;
+			}
 		}
+		assert( event->time <= gameLocal.time );
 
 		// copy the data into the local args array and set up pointers
 		ev = event->eventdef;
@@ -556,9 +822,13 @@ void idEvent::ServiceEvents( void ) {
 			}
 		}
 
+		eventStats.serviced++;
+		eventStats.totalDelay += gameLocal.time - event->time;
+		eventStats.maxDelay = Max( eventStats.maxDelay, gameLocal.time - event->time );
+
 		// the event is removed from its list so that if then object
 		// is deleted, the event won't be freed twice
-		event->eventNode.Remove();
+		event->Unqueue();
 		assert( event->object );
 		event->object->ProcessEventArgPtr( ev, args );
 
@@ -572,6 +842,9 @@ void idEvent::ServiceEvents( void ) {
 			gameLocal.Error( "Event overflow.  Possible infinite loop in script." );
 		}
 	}
+
+	eventStats.lastServicedFrame = num;
+	eventStats.maxServicedFrame = Max( eventStats.maxServicedFrame, num );
 }
 
 /*
@@ -632,15 +905,15 @@ void idEvent::Shutdown( void ) {
 // HUMANHEAD pdm
 int idEvent::NumQueuedEvents( const idClass *obj, const idEventDef *evdef ) {
 	idEvent *event;
-	idEvent *next;
+	int i;
 	int count=0;
 
 	if ( !initialized ) {
 		return 0;
 	}
 
-	for( event = EventQueue.Next(); event != NULL; event = next ) {
-		next = event->eventNode.Next();
+	for( i = ObjectEvents.First( EventObjectKey( obj ) ); i != -1; i = ObjectEvents.Next( i ) ) {
+		event = &EventPool[ i ];
 		if ( event->object == obj ) {
 			if ( !evdef || ( evdef == event->eventdef ) ) {
 				count++;
@@ -658,17 +931,41 @@ idEvent::Save
 */
 void idEvent::Save( idSaveGame *savefile ) {
 	char *str;
-	int i, size;
+	int i, j, size;
 	idEvent	*event;
 	byte *dataPtr;
 	bool validTrace;
 	const char	*format;
 	idStr s;
+	idList<idEvent *> events;
+
+	// collect the events in the order they are serviced
+	events.SetGranularity( 256 );
+	for( event = LateEvents.Next(); event != NULL; event = event->eventNode.Next() ) {
+		events.Append( event );
+	}
+	for( i = eventWheelTime & EVENT_NEAR_MASK; i < EVENT_NEAR_SIZE; i++ ) {
+		for( event = NearEvents[ i ].Next(); event != NULL; event = event->eventNode.Next() ) {
+			events.Append( event );
+		}
+	}
+	for( i = ( ( eventWheelTime >> EVENT_NEAR_BITS ) & EVENT_FAR_MASK ) + 1; i < EVENT_FAR_SIZE; i++ ) {
+		for( event = FarEvents[ i ].Next(); event != NULL; event = event->eventNode.Next() ) {
+			// the far lists are in the order the events were scheduled
+			for( j = events.Num(); j > 0 && events[ j - 1 ]->time > event->time; j-- ) {
+			}
+			events.Insert( event, j );
+		}
+	}
+	for( event = OverflowEvents.Next(); event != NULL; event = event->eventNode.Next() ) {
+		events.Append( event );
+	}
+	assert( events.Num() == NumQueued() );
 
-	savefile->WriteInt( EventQueue.Num() );
+	savefile->WriteInt( events.Num() );
 
-	event = EventQueue.Next();
-	while( event != NULL ) {
+	for( j = 0; j < events.Num(); j++ ) {
+		event = events[ j ];
 		savefile->WriteInt( event->time );
 		savefile->WriteString( event->eventdef->GetName() );
 		savefile->WriteString( event->typeinfo->classname );
@@ -721,7 +1018,6 @@ void idEvent::Save( idSaveGame *savefile ) {
 			}
 		}
 		assert( size == event->eventdef->GetArgSize() );
-		event = event->eventNode.Next();
 	}
 }
 
@@ -748,7 +1044,6 @@ void idEvent::Restore( idRestoreGame *savefile ) {
 
 		event = FreeEvents.Next();
 		event->eventNode.Remove();
-		event->eventNode.AddToEnd( EventQueue );
 
 		savefile->ReadInt( event->time );
 
@@ -768,6 +1063,12 @@ void idEvent::Restore( idRestoreGame *savefile ) {
 
 		savefile->ReadObject( event->object );
 
+		if ( !NumQueued() ) {
+			eventWheelTime = Min( event->time, gameLocal.time );
+		}
+		event->Insert();
+		ObjectEvents.Add( EventObjectKey( event->object ), event - EventPool );
+
 		// read the args
 		savefile->ReadInt( argsize );
 		if ( argsize != event->eventdef->GetArgSize() ) {
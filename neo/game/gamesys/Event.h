@@ -95,6 +95,16 @@ public:
 class idSaveGame;
 class idRestoreGame;
 
+/*
+	The scheduled events are kept in a two level timer wheel. The near wheel has a list
+	for every millisecond of the current 1024 millisecond block, the far wheel a list for
+	every block of the current 256 block span. Events further in the future are kept in a
+	sorted overflow list and events before the wheel time in a sorted late list. When the
+	wheel time enters a new block or span, the events of that block or span are moved down
+	in the order they were scheduled, so events with the same time are still serviced in
+	the order they were scheduled. The queued events are also hashed by their object, so
+	canceling and counting the events of an object doesn't walk the whole queue.
+*/
 class idEvent {
 private:
 	const idEventDef			*eventdef;
@@ -102,11 +112,19 @@ private:
 	int							time;
 	idClass						*object;
 	const idTypeInfo			*typeinfo;
+	int							queue;				// eventQueue_t
 
 	idLinkList<idEvent>			eventNode;
 
 	static idDynamicBlockAlloc<byte, 16 * 1024, 256> eventDataAllocator;
 
+	void						Insert( void );
+	void						Unqueue( void );
+	void						InsertSorted( idLinkList<idEvent> &list );
+	static void					MoveEvents( idLinkList<idEvent> &list );
+	static void					AdvanceQueue( int toTime );
+	static int					NumQueued( void );
+
 
 public:
 	static bool					initialized;
@@ -126,6 +144,8 @@ public:
 
 	static void					CancelEvents( const idClass *obj, const idEventDef *evdef = NULL );
 	static void					ClearEventList( void );
+	static void					PrintStats( int count );
+	static void					ClearStats( void );
 	static void					ServiceEvents( void );
 	static void					Init( void );
 	static void					Shutdown( void );
@@ -190,6 +190,218 @@ void Cmd_Script_f( const idCmdArgs &args ) {
 	}
 }
 
+/*
+===================
+Cmd_EventStats_f
+===================
+*/
+void Cmd_EventStats_f( const idCmdArgs &args ) {
+	if ( !idStr::Icmp( args.Argv( 1 ), "clear" ) ) {
+		idEvent::ClearStats();
+		return;
+	}
+	idEvent::PrintStats( ( args.Argc() > 1 ) ? atoi( args.Argv( 1 ) ) : 10 );
+}
+
+/*
+===================
+Cmd_TestTraceBatch_f
+
+Traces a spread of rays from the player's eye with idClip::TraceBatch and one at a time
+with idClip::Translation, and reports the traces whose results differ.
+===================
+*/
+static bool TraceResultsMatch( const trace_t &a, const trace_t &b ) {
+	return ( a.fraction == b.fraction && a.endpos.Compare( b.endpos ) && a.c.entityNum == b.c.entityNum && a.c.id == b.c.id );
+}
+
+void Cmd_TestTraceBatch_f( const idCmdArgs &args ) {
+	int					i, pass, numRays, numMismatches;
+	float				spread, ang, spin;
+	idPlayer *			player;
+	idVec3				eye, dir;
+	idMat3				axis;
+	idRandom			random;
+	double				start, batchTicks, serialTicks;
+	trace_t				tr;
+	idList<clipTrace_t>	traces;
+	const idBounds		bounds( idVec3( -8.0f, -8.0f, -8.0f ), idVec3( 8.0f, 8.0f, 8.0f ) );
+
+	player = gameLocal.GetLocalPlayer();
+	if ( !player || !gameLocal.CheatsOk() ) {
+		return;
+	}
+
+	numRays = ( args.Argc() > 1 ) ? idMath::ClampInt( 1, 4096, atoi( args.Argv( 1 ) ) ) : 64;
+	spread = ( args.Argc() > 2 ) ? atof( args.Argv( 2 ) ) : 30.0f;
+
+	player->GetViewPos( eye, axis );
+
+	traces.SetNum( numRays );
+	random.SetSeed( 0 );
+	for ( i = 0; i < numRays; i++ ) {
+		ang = idMath::Sin( DEG2RAD( spread ) * random.RandomFloat() );
+		spin = DEG2RAD( 360.0f ) * random.RandomFloat();
+		dir = axis[0] + axis[2] * ( ang * idMath::Sin( spin ) ) - axis[1] * ( ang * idMath::Cos( spin ) );
+		dir.Normalize();
+		traces[i].start = eye;
+		traces[i].end = eye + dir * 4096.0f;
+	}
+
+	// once with points and once with bounds
+	for ( pass = 0; pass < 2; pass++ ) {
+		start = idLib::sys->GetClockTicks();
+		if ( pass == 0 ) {
+			gameLocal.clip.TracePointBatch( traces.Ptr(), numRays, MASK_SHOT_RENDERMODEL, player );
+		} else {
+			gameLocal.clip.TraceBoundsBatch( traces.Ptr(), numRays, bounds, MASK_SHOT_BOUNDINGBOX, player );
+		}
+		batchTicks = idLib::sys->GetClockTicks() - start;
+
+		numMismatches = 0;
+		serialTicks = 0.0;
+		for ( i = 0; i < numRays; i++ ) {
+			start = idLib::sys->GetClockTicks();
+			if ( pass == 0 ) {
+				gameLocal.clip.TracePoint( tr, traces[i].start, traces[i].end, MASK_SHOT_RENDERMODEL, player );
+			} else {
+				gameLocal.clip.TraceBounds( tr, traces[i].start, traces[i].end, bounds, MASK_SHOT_BOUNDINGBOX, player );
+			}
+			serialTicks += idLib::sys->GetClockTicks() - start;
+
+			if ( !TraceResultsMatch( tr, traces[i].results ) ) {
+				if ( numMismatches < 10 ) {
+					gameLocal.Printf( "trace %d: batch %f ent %d id %d, serial %f ent %d id %d\n", i,
+						traces[i].results.fraction, traces[i].results.c.entityNum, traces[i].results.c.id,
+						tr.fraction, tr.c.entityNum, tr.c.id );
+				}
+				numMismatches++;
+			}
+		}
+
+		gameLocal.Printf( "%s: %d traces, %d mismatches, batch %.2f ms, serial %.2f ms\n", pass == 0 ? "points" : "bounds",
+							numRays, numMismatches, batchTicks * 1000.0 / idLib::sys->ClockTicksPerSecond(),
+							serialTicks * 1000.0 / idLib::sys->ClockTicksPerSecond() );
+	}
+}
+
+/*
+===================
+Cmd_ScriptBenchmark_f
+
+Runs a small script loop and reports how many statements per second the interpreter executes,
+once with every statement on its own and once with the superinstructions.
+===================
+*/
+static const char *scriptBenchmarkText =
+	"float ScriptBenchmark_Add( float a, float b ) {\n"
+	"	return a + b;\n"
+	"}\n"
+	"void ScriptBenchmark_Run() {\n"
+	"	float i;\n"
+	"	float j;\n"
+	"	vector v;\n"
+	"	j = 0;\n"
+	"	for( i = 0; i < 20000; i++ ) {\n"
+	"		if ( i < 10000 ) {\n"
+	"			j = ScriptBenchmark_Add( j, i );\n"
+	"		} else if ( i != j ) {\n"
+	"			j = j - i * 0.5;\n"
+	"		}\n"
+	"		v = v + '1 0 0' * j;\n"
+	"	}\n"
+	"}\n";
+
+void Cmd_ScriptBenchmark_f( const idCmdArgs &args ) {
+	int					i, pass, runs, statements;
+	bool				superInstructions;
+	idThread *			thread;
+	idTimer				timer;
+	const function_t *	func;
+
+	if ( !gameLocal.CheatsOk() ) {
+		return;
+	}
+
+	runs = 10;
+	if ( args.Argc() > 1 ) {
+		runs = Max( atoi( args.Argv( 1 ) ), 1 );
+	}
+
+	func = gameLocal.program.FindFunction( "ScriptBenchmark_Run" );
+	if ( !func ) {
+		if ( !gameLocal.program.CompileText( "console", scriptBenchmarkText, true ) ) {
+			return;
+		}
+		func = gameLocal.program.FindFunction( "ScriptBenchmark_Run" );
+		if ( !func ) {
+			return;
+		}
+	}
+
+	superInstructions = g_scriptSuperInstructions.GetBool();
+
+	for ( pass = 0; pass < 2; pass++ ) {
+		g_scriptSuperInstructions.SetBool( pass != 0 );
+
+		statements = 0;
+		timer.Clear();
+		timer.Start();
+		for ( i = 0; i < runs; i++ ) {
+			thread = new idThread( func );
+			thread->ManualDelete();
+			thread->Start();
+			statements += thread->GetStatementCount();
+			delete thread;
+		}
+		timer.Stop();
+
+		gameLocal.Printf( "%-18s %d statements in %u ms, %1.0f statements/sec\n", pass ? "superinstructions:" : "single statements:",
+							statements, timer.Milliseconds(), statements * 1000.0f / Max( (float)timer.Milliseconds(), 1.0f ) );
+	}
+
+	g_scriptSuperInstructions.SetBool( superInstructions );
+}
+
+/*
+===================
+Cmd_ScriptProfile_f
+===================
+*/
+void Cmd_ScriptProfile_f( const idCmdArgs &args ) {
+	const char *cmd;
+	int			count;
+	bool		inclusive;
+
+	cmd = args.Argv( 1 );
+	if ( !idStr::Icmp( cmd, "start" ) ) {
+		scriptProfiler.Start();
+		gameLocal.Printf( "script profiler started\n" );
+	} else if ( !idStr::Icmp( cmd, "stop" ) ) {
+		scriptProfiler.Stop();
+		gameLocal.Printf( "script profiler stopped\n" );
+	} else if ( !idStr::Icmp( cmd, "clear" ) ) {
+		scriptProfiler.Clear();
+	} else if ( !idStr::Icmp( cmd, "functions" ) || !idStr::Icmp( cmd, "events" ) ) {
+		count = ( args.Argc() > 2 ) ? atoi( args.Argv( 2 ) ) : 30;
+		inclusive = ( args.Argc() > 3 ) && !idStr::Icmp( args.Argv( 3 ), "inclusive" );
+		if ( !idStr::Icmp( cmd, "functions" ) ) {
+			scriptProfiler.PrintFunctions( count, inclusive );
+		} else {
+			scriptProfiler.PrintEvents( count, inclusive );
+		}
+	} else if ( !idStr::Icmp( cmd, "graph" ) && args.Argc() > 2 ) {
+		scriptProfiler.PrintCallGraph( args.Argv( 2 ) );
+	} else if ( !idStr::Icmp( cmd, "write" ) ) {
+		scriptProfiler.WriteCollapsedStacks( ( args.Argc() > 2 ) ? args.Argv( 2 ) : "scriptprofile.folded" );
+	} else {
+		gameLocal.Printf( "usage: scriptProfile start | stop | clear\n"
+							"       scriptProfile functions|events [count] [inclusive]\n"
+							"       scriptProfile graph <function or event>\n"
+							"       scriptProfile write [filename]\n" );
+	}
+}
+
 /*
 ==================
 KillEntities
@@ -2603,6 +2815,10 @@ void idGameLocal::InitConsoleCommands( void ) {
 	cmdSystem->AddCommand( "testBlend",				idTestModel::TestBlend_f,			CMD_FL_GAME|CMD_FL_CHEAT,	"tests animation blending" );
 	cmdSystem->AddCommand( "reloadScript",			Cmd_ReloadScript_f,			CMD_FL_GAME|CMD_FL_CHEAT,	"reloads scripts" );
 	cmdSystem->AddCommand( "script",				Cmd_Script_f,				CMD_FL_GAME|CMD_FL_CHEAT,	"executes a line of script" );
+	cmdSystem->AddCommand( "testTraceBatch",		Cmd_TestTraceBatch_f,		CMD_FL_GAME|CMD_FL_CHEAT,	"compares idClip::TraceBatch with single traces, usage: testTraceBatch [numRays] [spread]" );
+	cmdSystem->AddCommand( "scriptBenchmark",		Cmd_ScriptBenchmark_f,		CMD_FL_GAME|CMD_FL_CHEAT,	"reports how many script statements per second the interpreter executes" );
+	cmdSystem->AddCommand( "eventStats",			Cmd_EventStats_f,			CMD_FL_GAME,				"shows the queued events and event service stats, 'eventStats clear' resets the stats" );
+	cmdSystem->AddCommand( "scriptProfile",			Cmd_ScriptProfile_f,		CMD_FL_GAME,				"profiles the script functions and events" );
 	cmdSystem->AddCommand( "listCollisionModels",	Cmd_ListCollisionModels_f,	CMD_FL_GAME,				"lists collision models" );
 	cmdSystem->AddCommand( "collisionModelInfo",	Cmd_CollisionModelInfo_f,	CMD_FL_GAME,				"shows collision model info" );
 #ifdef ID_MAYA_IMPORT_TOOL
@@ -219,6 +219,16 @@ idCVar g_showTriggers(				"g_showTriggers",			"0",			CVAR_GAME | CVAR_BOOL, "dra
 idCVar g_showCollisionWorld(		"g_showCollisionWorld",		"0",			CVAR_GAME | CVAR_BOOL, "" );
 idCVar g_showCollisionModels(		"g_showCollisionModels",	"0",			CVAR_GAME | CVAR_BOOL, "" );
 idCVar g_showCollisionTraces(		"g_showCollisionTraces",	"0",			CVAR_GAME | CVAR_BOOL, "" );
+idCVar g_clipTree(					"g_clipTree",				"0",			CVAR_GAME | CVAR_BOOL | CVAR_ARCHIVE, "use a dynamic bounding volume tree instead of the clip sectors, takes effect on map load" );
+idCVar g_parallelTraceBatch(		"g_parallelTraceBatch",		"0",			CVAR_GAME | CVAR_BOOL | CVAR_ARCHIVE, "run the traces of idClip::TraceBatch on the job workers" );
+idCVar g_contactCache(				"g_contactCache",			"0",			CVAR_GAME | CVAR_BOOL | CVAR_ARCHIVE, "reuse the contacts between two clip models as long as neither of them moves" );
+idCVar g_pushCulling(				"g_pushCulling",			"0",			CVAR_GAME | CVAR_BOOL | CVAR_ARCHIVE, "skip the push traces for entities a mover provably can't reach, tested in the space of the mover" );
+idCVar g_showPushTimes(				"g_showPushTimes",			"0",			CVAR_GAME | CVAR_BOOL, "print the time spent pushing entities for every mover each frame" );
+idCVar g_parallelAnimation(			"g_parallelAnimation",		"0",			CVAR_GAME | CVAR_BOOL | CVAR_ARCHIVE, "blend the animation frames of the thinking entities on the job workers ahead of the think loop" );
+idCVar g_showParallelThink(			"g_showParallelThink",		"0",			CVAR_GAME | CVAR_BOOL, "print the think time of each frame and how many animation frames were blended on the job workers and used" );
+idCVar g_scriptCache(				"g_scriptCache",			"0",			CVAR_GAME | CVAR_BOOL | CVAR_ARCHIVE, "load the compiled scripts from a program image instead of compiling them when none of the script files changed" );
+idCVar g_scriptSuperInstructions(	"g_scriptSuperInstructions", "1",			CVAR_GAME | CVAR_BOOL, "let the script interpreter execute common pairs of statements as one instruction" );
+idCVar g_physicsIslands(			"g_physicsIslands",			"0",			CVAR_GAME | CVAR_BOOL | CVAR_ARCHIVE, "solve articulated figures that can't interact with anything else on the job workers" );
 idCVar g_maxShowDistance(			"g_maxShowDistance",		"128",			CVAR_GAME | CVAR_FLOAT, "" );
 idCVar g_showEntityInfo(			"g_showEntityInfo",			"0",			CVAR_GAME | CVAR_BOOL, "" );
 idCVar g_showviewpos(				"g_showviewpos",			"0",			CVAR_GAME | CVAR_BOOL, "" );
@@ -314,6 +324,8 @@ idCVar rb_showMass(					"rb_showMass",				"0",			CVAR_GAME | CVAR_BOOL, "show th
 idCVar rb_showInertia(				"rb_showInertia",			"0",			CVAR_GAME | CVAR_BOOL, "show the inertia tensor of each rigid body" );
 idCVar rb_showVelocity(				"rb_showVelocity",			"0",			CVAR_GAME | CVAR_BOOL, "show the velocity of each rigid body" );
 idCVar rb_showActive(				"rb_showActive",			"0",			CVAR_GAME | CVAR_BOOL, "show rigid bodies that are not at rest" );
+idCVar rb_showSleeping(			"rb_showSleeping",			"0",			CVAR_GAME | CVAR_BOOL, "draws boxes around rigid bodies, awake ones red and sleeping ones blue, and prints how many there are" );
+idCVar rb_sleepTime(				"rb_sleepTime",				"1000",			CVAR_GAME | CVAR_INTEGER, "put rigid bodies in contact with something to sleep when they hardly moved for this many milliseconds and almost stand still, 0 = only when at rest" );
 
 // The default values for player movement cvars are set in def/player.def
 idCVar pm_jumpheight(				"pm_jumpheight",			"48",			CVAR_GAME | CVAR_NETWORKSYNC | CVAR_FLOAT, "approximate height the player can jump" );
@@ -398,6 +410,8 @@ idCVar aas_pullPlayer(				"aas_pullPlayer",			"0",			CVAR_GAME | CVAR_INTEGER, "
 idCVar aas_randomPullPlayer(		"aas_randomPullPlayer",		"0",			CVAR_GAME | CVAR_BOOL, "" );
 idCVar aas_goalArea(				"aas_goalArea",				"0",			CVAR_GAME | CVAR_INTEGER, "" );
 idCVar aas_showPushIntoArea(		"aas_showPushIntoArea",		"0",			CVAR_GAME | CVAR_BOOL, "" );
+idCVar aas_routingCacheMsec(		"aas_routingCacheMsec",		"1",			CVAR_GAME | CVAR_FLOAT, "milliseconds per frame spent rebuilding the routing cache flushed by doors and obstacles, 0 = rebuild on demand only", 0.0f, 100.0f );
+idCVar aas_prewarmGoals(			"aas_prewarmGoals",			"32",			CVAR_GAME | CVAR_INTEGER, "number of goal areas the routing cache is built for at map load", 0, 1024 );
 
 idCVar g_password(					"g_password",				"",				CVAR_GAME | CVAR_ARCHIVE, "game password" );
 idCVar password(					"password",					"",				CVAR_GAME | CVAR_NOCHEAT, "client password used when connecting" );
@@ -134,6 +134,16 @@ extern idCVar	g_showTriggers;
 extern idCVar	g_showCollisionWorld;
 extern idCVar	g_showCollisionModels;
 extern idCVar	g_showCollisionTraces;
+extern idCVar	g_parallelTraceBatch;
+extern idCVar	g_clipTree;
+extern idCVar	g_contactCache;
+extern idCVar	g_pushCulling;
+extern idCVar	g_showPushTimes;
+extern idCVar	g_scriptCache;
+extern idCVar	g_scriptSuperInstructions;
+extern idCVar	g_physicsIslands;
+extern idCVar	g_parallelAnimation;
+extern idCVar	g_showParallelThink;
 extern idCVar	g_maxShowDistance;
 extern idCVar	g_showEntityInfo;
 extern idCVar	g_showviewpos;
@@ -222,6 +232,8 @@ extern idCVar	rb_showMass;
 extern idCVar	rb_showInertia;
 extern idCVar	rb_showVelocity;
 extern idCVar	rb_showActive;
+extern idCVar	rb_showSleeping;
+extern idCVar	rb_sleepTime;
 
 extern idCVar	pm_jumpheight;
 extern idCVar	pm_stepsize;
@@ -298,6 +310,8 @@ extern idCVar	aas_pullPlayer;
 extern idCVar	aas_randomPullPlayer;
 extern idCVar	aas_goalArea;
 extern idCVar	aas_showPushIntoArea;
+extern idCVar	aas_routingCacheMsec;
+extern idCVar	aas_prewarmGoals;
 
 extern idCVar	net_clientPredictGUI;
 
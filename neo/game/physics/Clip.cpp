@@ -57,6 +57,34 @@ typedef struct clipLink_s {
 	struct clipLink_s *		nextLink;
 } clipLink_t;
 
+#define CONTACT_CACHE_SIZE				1024		// must be a power of two
+#define CONTACT_CACHE_MAX_CONTACTS		8
+#define CONTACT_CACHE_ORIGIN_EPSILON	0.01f
+#define CONTACT_CACHE_AXIS_EPSILON		1e-4f
+
+// contacts of a trace model with a single collision model, the contacts are reused as long as
+// neither of the two models moved more than the epsilons and the query is the same otherwise
+typedef struct contactCache_s {
+	const idClipModel *		mdl;		// model the contacts are generated for
+	const idClipModel *		touch;		// model touched, NULL for the world
+	int						mdlCacheId;
+	int						touchCacheId;
+	int						traceModelIndex;
+	int						touchTraceModelIndex;
+	const idMaterial *		touchMaterial;
+	int						touchContents;
+	cmHandle_t				model;
+	int						contentMask;
+	float					depth;
+	idVec6					dir;
+	idVec3					start;
+	idMat3					trmAxis;
+	idVec3					modelOrigin;
+	idMat3					modelAxis;
+	int						numContacts;
+	contactInfo_t			contacts[CONTACT_CACHE_MAX_CONTACTS];
+} contactCache_t;
+
 typedef struct trmCache_s {
 	idTraceModel			trm;
 	int						refCount;
@@ -81,6 +109,8 @@ idBlockAlloc<clipLink_t, 1024>	clipLinkAllocator;
 static idList<trmCache_s*>		traceModelCache;
 static idHashIndex				traceModelHash;
 
+static int						numContactCacheIds = 0;
+
 /*
 ===============
 idClipModel::ClearTraceModelCache
@@ -232,6 +262,7 @@ idClipModel::LoadModel
 ================
 */
 bool idClipModel::LoadModel( const char *name ) {
+	FlushContactCache();
 	renderModelHandle = -1;
 	if ( traceModelIndex != -1 ) {
 		FreeTraceModel( traceModelIndex );
@@ -254,6 +285,7 @@ idClipModel::LoadModel
 ================
 */
 void idClipModel::LoadModel( const idTraceModel &trm ) {
+	FlushContactCache();
 	collisionModelHandle = 0;
 	renderModelHandle = -1;
 	if ( traceModelIndex != -1 ) {
@@ -269,6 +301,7 @@ idClipModel::LoadModel
 ================
 */
 void idClipModel::LoadModel( const int renderModelHandle ) {
+	FlushContactCache();
 	collisionModelHandle = 0;
 	this->renderModelHandle = renderModelHandle;
 	if ( renderModelHandle != -1 ) {
@@ -306,11 +339,26 @@ void idClipModel::Init( void ) {
 	traceModelIndex = -1;
 	clipLinks = NULL;
 	touchCount = -1;
+	clipTree = NULL;
+	clipTreeLeaf = -1;
+	clipTreeLinked = false;
+	FlushContactCache();
 #if _HH_CLIP_FASTSECTORS //HUMANHEAD rww
 	checked = false;
 #endif //HUMANHEAD END
 }
 
+/*
+================
+idClipModel::FlushContactCache
+
+  contacts cached with the old id are never used again
+================
+*/
+void idClipModel::FlushContactCache( void ) {
+	contactCacheId = ++numContactCacheIds;
+}
+
 /*
 ================
 idClipModel::idClipModel
@@ -369,12 +417,16 @@ idClipModel::idClipModel( const idClipModel *model ) {
 	contents = model->contents;
 	collisionModelHandle = model->collisionModelHandle;
 	traceModelIndex = -1;
+	FlushContactCache();
 	if ( model->traceModelIndex != -1 ) {
 		LoadModel( *GetCachedTraceModel( model->traceModelIndex ) );
 	}
 	renderModelHandle = model->renderModelHandle;
 	clipLinks = NULL;
 	touchCount = -1;
+	clipTree = NULL;
+	clipTreeLeaf = -1;
+	clipTreeLinked = false;
 #if _HH_CLIP_FASTSECTORS //HUMANHEAD rww
 	checked = false;
 #endif //HUMANHEAD END
@@ -388,6 +440,9 @@ idClipModel::~idClipModel
 idClipModel::~idClipModel( void ) {
 	// make sure the clip model is no longer linked
 	Unlink();
+	if ( clipTree ) {
+		clipTree->FreeLeaf( clipTreeLeaf );
+	}
 	if ( traceModelIndex != -1 ) {
 		FreeTraceModel( traceModelIndex );
 	}
@@ -416,7 +471,7 @@ void idClipModel::Save( idSaveGame *savefile ) const {
 	}
 	savefile->WriteInt( traceModelIndex );
 	savefile->WriteInt( renderModelHandle );
-	savefile->WriteBool( clipLinks != NULL );
+	savefile->WriteBool( IsLinked() );
 	savefile->WriteInt( touchCount );
 
 #if _HH_CLIP_FASTSECTORS //HUMANHEAD rww
@@ -465,6 +520,10 @@ void idClipModel::Restore( idRestoreGame *savefile ) {
 	renderModelHandle = -1;
 	clipLinks = NULL;
 	touchCount = -1;
+	clipTree = NULL;
+	clipTreeLeaf = -1;
+	clipTreeLinked = false;
+	FlushContactCache();
 
 	if ( linked ) {
 		Link( gameLocal.clip, entity, id, origin, axis, renderModelHandle );
@@ -477,8 +536,8 @@ idClipModel::SetPosition
 ================
 */
 void idClipModel::SetPosition( const idVec3 &newOrigin, const idMat3 &newAxis ) {
-	if ( clipLinks ) {
-		Unlink();	// unlink from old position
+	if ( IsLinked() ) {
+		UnlinkClipLinks();	// unlink from old position
 	}
 	origin = newOrigin;
 	axis = newAxis;
@@ -524,8 +583,24 @@ idClipModel::Unlink
 ===============
 */
 void idClipModel::Unlink( void ) {
+	UnlinkClipLinks();
+	// the model may be freed or changed while it is not in the world
+	FlushContactCache();
+}
+
+/*
+===============
+idClipModel::UnlinkClipLinks
+
+  unlinks without flushing the cached contacts, the cache already tests the position
+===============
+*/
+void idClipModel::UnlinkClipLinks( void ) {
 	clipLink_t *link;
 
+	// the leaf stays in the clip tree so linking again can reuse it
+	clipTreeLinked = false;
+
 	for ( link = clipLinks; link; link = clipLinks ) {
 		clipLinks = link->nextLink;
 		if ( link->prevInSector ) {
@@ -575,6 +650,7 @@ void idClipModel::Link_r( struct clipSector_s *node ) {
 	node->clipLinks = link;
 	link->nextLink = clipLinks;
 	clipLinks = link;
+	gameLocal.clip.numSectorLinks++;
 }
 #endif //HUMANHEAD END
 
@@ -590,14 +666,16 @@ void idClipModel::Link( idClip &clp ) {
 		return;
 	}
 
-	if ( clipLinks ) {
-		Unlink();	// unlink from old position
+	if ( IsLinked() ) {
+		UnlinkClipLinks();	// unlink from old position
 	}
 
 	if ( bounds.IsCleared() ) {
 		return;
 	}
 
+	idVec3 oldCenter = absBounds.GetCenter();
+
 	// set the abs box
 	if ( axis.IsRotated() ) {
 		// expand for rotation
@@ -613,6 +691,22 @@ void idClipModel::Link( idClip &clp ) {
 	absBounds[0] -= vec3_boxEpsilon;
 	absBounds[1] += vec3_boxEpsilon;
 
+	if ( clp.useClipTree ) {
+		if ( clipTree && clipTree != &clp.clipTree ) {
+			clipTree->FreeLeaf( clipTreeLeaf );
+			clipTree = NULL;
+			clipTreeLeaf = -1;
+		}
+		if ( !clipTree ) {
+			clipTree = &clp.clipTree;
+			clipTreeLeaf = clipTree->CreateLeaf( this, absBounds );
+		} else {
+			clipTree->MoveLeaf( clipTreeLeaf, absBounds, absBounds.GetCenter() - oldCenter );
+		}
+		clipTreeLinked = true;
+		return;
+	}
+
 #if _HH_CLIP_FASTSECTORS //HUMANHEAD rww
 	int coords[ 4 ];
 	clp.CoordsForBounds( coords, absBounds );
@@ -635,6 +729,7 @@ void idClipModel::Link( idClip &clp ) {
 			sector->clipLinks = link;
 			link->nextLink = clipLinks;
 			clipLinks = link;
+			clp.numSectorLinks++;
 		}
 	}
 #else
@@ -690,7 +785,11 @@ idClip::idClip( void ) {
 	numClipSectors = 0;
 	clipSectors = NULL;
 	worldBounds.Zero();
+	useClipTree = false;
+	contactCache = NULL;
 	numRotations = numTranslations = numMotions = numRenderModelTraces = numContents = numContacts = 0;
+	numSectorLinks = numSectorQueries = numSectorTests = numSectorModelTests = 0;
+	numContactCacheHits = numContactCacheMisses = 0;
 }
 
 /*
@@ -802,11 +901,24 @@ void idClip::Init( void ) {
 	gameLocal.Printf( "map bounds are (%1.1f, %1.1f, %1.1f)\n", size[0], size[1], size[2] );
 	gameLocal.Printf( "max clip sector is (%1.1f, %1.1f, %1.1f)\n", maxSector[0], maxSector[1], maxSector[2] );
 
+	// the clip sectors are still created so the broadphase can be compared
+	useClipTree = g_clipTree.GetBool();
+	clipTree.Init();
+	if ( useClipTree ) {
+		gameLocal.Printf( "using the dynamic clip tree\n" );
+	}
+
+	// clear the contact cache
+	contactCache = new contactCache_t[CONTACT_CACHE_SIZE];
+	memset( contactCache, 0, CONTACT_CACHE_SIZE * sizeof( contactCache_t ) );
+
 	// initialize a default clip model
 	defaultClipModel.LoadModel( idTraceModel( idBounds( idVec3( 0, 0, 0 ) ).Expand( 8 ) ) );
 
 	// set counters to zero
 	numRotations = numTranslations = numMotions = numRenderModelTraces = numContents = numContacts = 0;
+	numSectorLinks = numSectorQueries = numSectorTests = numSectorModelTests = 0;
+	numContactCacheHits = numContactCacheMisses = 0;
 }
 
 /*
@@ -818,6 +930,12 @@ void idClip::Shutdown( void ) {
 	delete[] clipSectors;
 	clipSectors = NULL;
 
+	clipTree.Shutdown();
+	useClipTree = false;
+
+	delete[] contactCache;
+	contactCache = NULL;
+
 	// free the trace model used for the temporaryClipModel
 	if ( temporaryClipModel.traceModelIndex != -1 ) {
 		idClipModel::FreeTraceModel( temporaryClipModel.traceModelIndex );
@@ -860,9 +978,13 @@ void idClip::ClipModelsTouchingBounds_r( const struct clipSector_s *node, listPa
 		}
 	}
 
+	numSectorTests++;
+
 	for ( clipLink_t *link = node->clipLinks; link; link = link->nextInSector ) {
 		idClipModel	*check = link->clipModel;
 
+		numSectorModelTests++;
+
 		// if the clip model is enabled
 		if ( !check->enabled ) {
 			continue;
@@ -971,6 +1093,12 @@ int idClip::ClipModelsTouchingBounds( const idBounds &bounds, int contentMask, i
 	parms.count = 0;
 	parms.maxCount = maxCount;
 
+	if ( useClipTree ) {
+		return clipTree.ClipModelsTouchingBounds( parms.bounds, contentMask, clipModelList, maxCount );
+	}
+
+	numSectorQueries++;
+
 #if _HH_CLIP_FASTSECTORS //HUMANHEAD rww
 	int coords[ 4 ];
 	CoordsForBounds( coords, parms.bounds );
@@ -980,6 +1108,7 @@ int idClip::ClipModelsTouchingBounds( const idBounds &bounds, int contentMask, i
 		for( y = coords[ 1 ]; y < coords[ 3 ]; y++ ) {
 			clipSector_t* sector = &clipSectors[ x + ( y << CLIPSECTOR_DEPTH ) ];
 
+			numSectorTests++;
 			if( !( sector->dynamicContents & contentMask ) ) {
 				continue;
 			}
@@ -987,6 +1116,8 @@ int idClip::ClipModelsTouchingBounds( const idBounds &bounds, int contentMask, i
 			for ( clipLink_t* link = sector->clipLinks; link && clipCount < MAX_GENTITIES; link = link->nextInSector ) {
 				idClipModel* model = link->clipModel;
 
+				numSectorModelTests++;
+
 				if( model->checked || !model->enabled || !( model->GetContents() & contentMask ) ) {
 					continue;
 				}
@@ -1393,6 +1524,278 @@ bool idClip::Translation( trace_t &results, const idVec3 &start, const idVec3 &e
 	return ( results.fraction < 1.0f );
 }
 
+/*
+===============================================================================
+
+	Batched traces
+
+	The traces of a batch share a single clip model gather over their combined
+	bounds. Every candidate clip model keeps a bit for each trace it may touch, and
+	the candidates are walked in gather order so each trace sees the same models in
+	the same order as idClip::Translation would give it. Collision model traces are
+	reentrant, so with g_parallelTraceBatch the traces are split over the job workers.
+	Render model traces and the portal callbacks are not, a batch that touches a
+	render model runs on the calling thread and the portals are told afterwards.
+
+===============================================================================
+*/
+
+const int CLIP_TRACE_BATCH		= 32;			// one bit per trace in clipTraceBatch_t::touchRays
+
+typedef struct clipTraceBatch_s {
+	const idClip *			clip;
+	clipTrace_t *			traces;
+	const idTraceModel *	trm;
+	idMat3					trmAxis;
+	float					radius;
+	int						contentMask;
+	bool					testWorld;
+	unsigned int			skip;							// traces that were already finished
+	int						numTouch;
+	idClipModel **			touch;
+	unsigned int *			touchRays;						// traces that may touch each clip model
+	bool *					touchPortal;					// clip model entity is a portal for these traces
+	idEntity *				portal[CLIP_TRACE_BATCH];		// closest portal passed by each trace
+	int						numTranslations[CLIP_TRACE_BATCH];
+	int						numRenderModelTraces[CLIP_TRACE_BATCH];
+} clipTraceBatch_t;
+
+/*
+============
+idClip::TraceBatchRange
+============
+*/
+void idClip::TraceBatchRange( clipTraceBatch_t &batch, int first, int last ) const {
+	int i, j;
+	unsigned int active, rays;
+	idClipModel *touch;
+	cmHandle_t handle;
+	trace_t trace;
+	idBounds traceBounds[CLIP_TRACE_BATCH];
+	float portalFraction[CLIP_TRACE_BATCH];
+
+	active = 0;
+	for ( i = first; i < last; i++ ) {
+		if ( batch.skip & ( 1u << i ) ) {
+			continue;
+		}
+
+		clipTrace_t &t = batch.traces[i];
+
+		batch.portal[i] = NULL;
+		portalFraction[i] = 1.0f;
+
+		if ( batch.testWorld ) {
+			batch.numTranslations[i]++;
+			collisionModelManager->Translation( &t.results, t.start, t.end, batch.trm, batch.trmAxis, batch.contentMask, 0, vec3_origin, mat3_default );
+			t.results.c.entityNum = t.results.fraction != 1.0f ? ENTITYNUM_WORLD : ENTITYNUM_NONE;
+			if ( t.results.fraction == 0.0f ) {
+				continue;		// blocked immediately by the world
+			}
+		} else {
+			memset( &t.results, 0, sizeof( t.results ) );
+			t.results.fraction = 1.0f;
+			t.results.endpos = t.end;
+			t.results.endAxis = batch.trmAxis;
+		}
+
+		// only clip models up to the world impact can be hit
+		if ( !batch.trm ) {
+			traceBounds[i].FromPointTranslation( t.start, t.results.endpos - t.start );
+		} else {
+			traceBounds[i].FromBoundsTranslation( batch.trm->bounds, t.start, batch.trmAxis, t.results.endpos - t.start );
+		}
+		traceBounds[i][0] -= vec3_boxEpsilon;
+		traceBounds[i][1] += vec3_boxEpsilon;
+
+		active |= 1u << i;
+	}
+
+	for ( j = 0; j < batch.numTouch && active; j++ ) {
+		rays = batch.touchRays[j] & active;
+		if ( !rays ) {
+			continue;
+		}
+
+		touch = batch.touch[j];
+		handle = ( touch->renderModelHandle == -1 ) ? touch->Handle() : 0;
+
+		for ( i = first; i < last; i++ ) {
+			if ( !( rays & ( 1u << i ) ) ) {
+				continue;
+			}
+			if ( !touch->absBounds.IntersectsBounds( traceBounds[i] ) ) {
+				continue;
+			}
+
+			clipTrace_t &t = batch.traces[i];
+
+			if ( touch->renderModelHandle != -1 ) {
+				batch.numRenderModelTraces[i]++;
+				TraceRenderModel( trace, t.start, t.end, batch.radius, batch.trmAxis, touch );
+			} else {
+				batch.numTranslations[i]++;
+				collisionModelManager->Translation( &trace, t.start, t.end, batch.trm, batch.trmAxis, batch.contentMask,
+										handle, touch->origin, touch->axis );
+			}
+
+			if ( trace.fraction < t.results.fraction ) {
+				if ( batch.touchPortal[j] ) {
+					if ( trace.fraction < portalFraction[i] ) {
+						portalFraction[i] = trace.fraction;
+						batch.portal[i] = touch->entity;
+					}
+					continue; // Don't collide with portals
+				}
+
+				t.results = trace;
+				t.results.c.entityNum = touch->entity->entityNumber;
+				t.results.c.id = touch->id;
+				if ( t.results.fraction == 0.0f ) {
+					active &= ~( 1u << i );
+				}
+			}
+		}
+	}
+}
+
+/*
+============
+idClip::TraceBatchJob
+============
+*/
+void idClip::TraceBatchJob( void *data, int first, int last ) {
+	clipTraceBatch_t *batch = (clipTraceBatch_t *)data;
+	batch->clip->TraceBatchRange( *batch, first, last );
+}
+
+/*
+============
+idClip::TraceBatchChunk
+============
+*/
+int idClip::TraceBatchChunk( clipTrace_t *traces, int numTraces,
+						const idClipModel *mdl, const idMat3 &trmAxis, int contentMask, const idEntity *passEntity ) {
+	int i, j, num, numHits;
+	idClipModel *touch, *clipModelList[MAX_GENTITIES];
+	unsigned int touchRays[MAX_GENTITIES];
+	bool touchPortal[MAX_GENTITIES];
+	idBounds traceBounds[CLIP_TRACE_BATCH], totalBounds;
+	bool renderModels;
+	clipTraceBatch_t batch;
+
+	assert( numTraces <= CLIP_TRACE_BATCH );
+
+	batch.clip = this;
+	batch.traces = traces;
+	batch.trm = TraceModelForClipModel( mdl );
+	batch.trmAxis = trmAxis;
+	batch.radius = batch.trm ? batch.trm->bounds.GetRadius() : 0.0f;
+	batch.contentMask = contentMask;
+	batch.testWorld = ( !passEntity || passEntity->entityNumber != ENTITYNUM_WORLD );
+	batch.skip = 0;
+	memset( batch.portal, 0, sizeof( batch.portal ) );
+	memset( batch.numTranslations, 0, sizeof( batch.numTranslations ) );
+	memset( batch.numRenderModelTraces, 0, sizeof( batch.numRenderModelTraces ) );
+
+	totalBounds.Clear();
+	for ( i = 0; i < numTraces; i++ ) {
+		clipTrace_t &t = traces[i];
+
+		if ( TestHugeTranslation( t.results, mdl, t.start, t.end, trmAxis ) ) {
+			batch.skip |= 1u << i;
+			continue;
+		}
+
+		if ( !batch.trm ) {
+			traceBounds[i].FromPointTranslation( t.start, t.end - t.start );
+		} else {
+			traceBounds[i].FromBoundsTranslation( batch.trm->bounds, t.start, trmAxis, t.end - t.start );
+		}
+		totalBounds.AddBounds( traceBounds[i] );
+
+		traceBounds[i][0] -= vec3_boxEpsilon;
+		traceBounds[i][1] += vec3_boxEpsilon;
+	}
+
+	// gather the clip models once for all traces and keep the ones touched by any of them
+	num = 0;
+	renderModels = false;
+	if ( !totalBounds.IsCleared() ) {
+		num = GetTraceClipModels( totalBounds, contentMask, passEntity, clipModelList );
+	}
+
+	batch.numTouch = 0;
+	for ( j = 0; j < num; j++ ) {
+		touch = clipModelList[j];
+
+		if ( !touch ) {
+			continue;
+		}
+
+		unsigned int rays = 0;
+		for ( i = 0; i < numTraces; i++ ) {
+			if ( !( batch.skip & ( 1u << i ) ) && touch->absBounds.IntersectsBounds( traceBounds[i] ) ) {
+				rays |= 1u << i;
+			}
+		}
+		if ( !rays ) {
+			continue;
+		}
+
+		clipModelList[batch.numTouch] = touch;
+		touchRays[batch.numTouch] = rays;
+		touchPortal[batch.numTouch] = touch->entity->CheckPortal( mdl, contentMask ); // HUMANHEAD CJR PCF 04/26/06
+		batch.numTouch++;
+
+		if ( touch->renderModelHandle != -1 ) {
+			renderModels = true;
+		}
+	}
+	batch.touch = clipModelList;
+	batch.touchRays = touchRays;
+	batch.touchPortal = touchPortal;
+
+	if ( g_parallelTraceBatch.GetBool() && jobSystem->GetNumWorkers() > 0 && !renderModels && numTraces > 1 ) {
+		jobSystem->ParallelFor( numTraces, 4, TraceBatchJob, &batch );
+	} else {
+		TraceBatchRange( batch, 0, numTraces );
+	}
+
+	numHits = 0;
+	for ( i = 0; i < numTraces; i++ ) {
+		idClip::numTranslations += batch.numTranslations[i];
+		idClip::numRenderModelTraces += batch.numRenderModelTraces[i];
+
+		// HUMANHEAD CJR PCF 04/26/06
+		if ( batch.portal[i] ) {
+			batch.portal[i]->CollideWithPortal( mdl );
+		} // HUMANHEAD CJR PCF 04/26/06
+
+		if ( traces[i].results.fraction < 1.0f ) {
+			numHits++;
+		}
+	}
+
+	return numHits;
+}
+
+/*
+============
+idClip::TraceBatch
+============
+*/
+int idClip::TraceBatch( clipTrace_t *traces, int numTraces,
+						const idClipModel *mdl, const idMat3 &trmAxis, int contentMask, const idEntity *passEntity ) {
+	int i, numHits;
+
+	numHits = 0;
+	for ( i = 0; i < numTraces; i += CLIP_TRACE_BATCH ) {
+		numHits += TraceBatchChunk( traces + i, Min( numTraces - i, CLIP_TRACE_BATCH ), mdl, trmAxis, contentMask, passEntity );
+	}
+	return numHits;
+}
+
 //HUMANHEAD rww
 /*
 ============
@@ -1771,6 +2174,77 @@ bool idClip::Motion( trace_t &results, const idVec3 &start, const idVec3 &end, c
 	return ( translationalTrace.fraction < 1.0f || rotationalTrace.fraction < 1.0f );
 }
 
+/*
+============
+idClip::ContactsCached
+
+  contacts of the trace model with a single collision model, reuses the contacts found
+  for the same pair of clip models during an earlier query if neither of them moved
+============
+*/
+int idClip::ContactsCached( contactInfo_t *contacts, const int maxContacts, const idVec3 &start, const idVec6 &dir, const float depth,
+							const idClipModel *mdl, const idTraceModel *trm, const idMat3 &trmAxis, int contentMask,
+								const idClipModel *touch, cmHandle_t model, const idVec3 &modelOrigin, const idMat3 &modelAxis ) {
+	contactCache_t *cache;
+	int n;
+
+	idClip::numContacts++;
+
+	// the temporary clip model changes its trace model all the time
+	if ( !g_contactCache.GetBool() || !contactCache || !trm || mdl == &temporaryClipModel ) {
+		return collisionModelManager->Contacts( contacts, maxContacts, start, dir, depth, trm, trmAxis, contentMask, model, modelOrigin, modelAxis );
+	}
+
+	cache = &contactCache[ ( ( (uintptr_t) mdl >> 4 ) * 31 + ( (uintptr_t) touch >> 4 ) ) & ( CONTACT_CACHE_SIZE - 1 )];
+
+	if ( cache->mdl == mdl && cache->touch == touch && cache->mdlCacheId == mdl->contactCacheId &&
+			cache->traceModelIndex == mdl->traceModelIndex && cache->model == model &&
+			( !touch || ( cache->touchCacheId == touch->contactCacheId && cache->touchTraceModelIndex == touch->traceModelIndex &&
+				cache->touchMaterial == touch->material && cache->touchContents == touch->contents ) ) &&
+			cache->contentMask == contentMask && cache->depth == depth && cache->numContacts < maxContacts &&
+				cache->dir.Compare( dir ) && cache->start.Compare( start, CONTACT_CACHE_ORIGIN_EPSILON ) &&
+					cache->trmAxis.Compare( trmAxis, CONTACT_CACHE_AXIS_EPSILON ) &&
+						cache->modelOrigin.Compare( modelOrigin, CONTACT_CACHE_ORIGIN_EPSILON ) &&
+							cache->modelAxis.Compare( modelAxis, CONTACT_CACHE_AXIS_EPSILON ) ) {
+		numContactCacheHits++;
+		memcpy( contacts, cache->contacts, cache->numContacts * sizeof( contactInfo_t ) );
+		return cache->numContacts;
+	}
+
+	numContactCacheMisses++;
+
+	n = collisionModelManager->Contacts( contacts, maxContacts, start, dir, depth, trm, trmAxis, contentMask, model, modelOrigin, modelAxis );
+
+	// only store complete contact sets
+	if ( n >= maxContacts || n > CONTACT_CACHE_MAX_CONTACTS ) {
+		cache->mdl = NULL;
+		return n;
+	}
+
+	cache->mdl = mdl;
+	cache->touch = touch;
+	cache->mdlCacheId = mdl->contactCacheId;
+	cache->traceModelIndex = mdl->traceModelIndex;
+	if ( touch ) {
+		cache->touchCacheId = touch->contactCacheId;
+		cache->touchTraceModelIndex = touch->traceModelIndex;
+		cache->touchMaterial = touch->material;
+		cache->touchContents = touch->contents;
+	}
+	cache->model = model;
+	cache->contentMask = contentMask;
+	cache->depth = depth;
+	cache->dir = dir;
+	cache->start = start;
+	cache->trmAxis = trmAxis;
+	cache->modelOrigin = modelOrigin;
+	cache->modelAxis = modelAxis;
+	cache->numContacts = n;
+	memcpy( cache->contacts, contacts, n * sizeof( contactInfo_t ) );
+
+	return n;
+}
+
 /*
 ============
 idClip::Contacts
@@ -1787,8 +2261,7 @@ int idClip::Contacts( contactInfo_t *contacts, const int maxContacts, const idVe
 
 	if ( !passEntity || passEntity->entityNumber != ENTITYNUM_WORLD ) {
 		// test world
-		idClip::numContacts++;
-		numContacts = collisionModelManager->Contacts( contacts, maxContacts, start, dir, depth, trm, trmAxis, contentMask, 0, vec3_origin, mat3_default );
+		numContacts = ContactsCached( contacts, maxContacts, start, dir, depth, mdl, trm, trmAxis, contentMask, NULL, 0, vec3_origin, mat3_default );
 	} else {
 		numContacts = 0;
 	}
@@ -1829,10 +2302,9 @@ int idClip::Contacts( contactInfo_t *contacts, const int maxContacts, const idVe
 			continue;
 		} // HUMANHEAD END
 
-		idClip::numContacts++;
-		n = collisionModelManager->Contacts( contacts + numContacts, maxContacts - numContacts,
-								start, dir, depth, trm, trmAxis, contentMask,
-									touch->Handle(), touch->origin, touch->axis );
+		n = ContactsCached( contacts + numContacts, maxContacts - numContacts,
+								start, dir, depth, mdl, trm, trmAxis, contentMask,
+									touch, touch->Handle(), touch->origin, touch->axis );
 
 		for ( j = 0; j < n; j++ ) {
 			contacts[numContacts].entityNum = touch->entity->entityNumber;
@@ -2040,6 +2512,20 @@ void idClip::PrintStatistics( void ) {
 	gameLocal.Printf( "t = %-3d, r = %-3d, m = %-3d, render = %-3d, contents = %-3d, contacts = %-3d\n",
 					numTranslations, numRotations, numMotions, numRenderModelTraces, numContents, numContacts );
 	numRotations = numTranslations = numMotions = numRenderModelTraces = numContents = numContacts = 0;
+
+	// broadphase costs
+	if ( useClipTree ) {
+		clipTree.PrintStatistics();
+	} else {
+		gameLocal.Printf( "clip sectors: links = %-3d, queries = %-3d, sectors = %-4d, models = %-4d\n",
+						numSectorLinks, numSectorQueries, numSectorTests, numSectorModelTests );
+	}
+	numSectorLinks = numSectorQueries = numSectorTests = numSectorModelTests = 0;
+
+	if ( g_contactCache.GetBool() ) {
+		gameLocal.Printf( "contact cache: hits = %-3d, misses = %-3d\n", numContactCacheHits, numContactCacheMisses );
+	}
+	numContactCacheHits = numContactCacheMisses = 0;
 }
 
 /*
@@ -60,6 +60,7 @@ class idEntity;
 class idClipModel {
 
 	friend class idClip;
+	friend class idClipTree;
 
 public:
 							idClipModel( void );
@@ -82,7 +83,7 @@ public:
 
 	void					Link( idClip &clp );				// must have been linked with an entity and id before
 	void					Link( idClip &clp, idEntity *ent, int newId, const idVec3 &newOrigin, const idMat3 &newAxis, int renderModelHandle = -1 );
-	void					Unlink( void );						// unlink from sectors
+	void					Unlink( void );						// unlink from sectors or the clip tree
 	void					SetPosition( const idVec3 &newOrigin, const idMat3 &newAxis );	// unlinks the clip model
 	void					Translate( const idVec3 &translation );							// unlinks the clip model
 	void					Rotate( const idRotation &rotation );							// unlinks the clip model
@@ -138,8 +139,14 @@ private:
 
 	struct clipLink_s *		clipLinks;				// links into sectors
 	int						touchCount;
+	idClipTree *			clipTree;				// clip tree with the leaf of this clip model
+	int						clipTreeLeaf;			// leaf in the clip tree, kept while unlinked
+	bool					clipTreeLinked;			// true if linked into the clip tree
+	int						contactCacheId;			// changes when the contacts cached for this model can no longer be used
 
 	void					Init( void );			// initialize
+	void					UnlinkClipLinks( void );
+	void					FlushContactCache( void );
 #if !_HH_CLIP_FASTSECTORS //HUMANHEAD rww
 	void					Link_r( struct clipSector_s *node );
 #endif //HUMANHEAD END
@@ -152,12 +159,12 @@ private:
 
 
 ID_INLINE void idClipModel::Translate( const idVec3 &translation ) {
-	Unlink();
+	UnlinkClipLinks();
 	origin += translation;
 }
 
 ID_INLINE void idClipModel::Rotate( const idRotation &rotation ) {
-	Unlink();
+	UnlinkClipLinks();
 	origin *= rotation;
 	axis *= rotation.ToMat3();
 }
@@ -238,7 +245,7 @@ ID_INLINE bool idClipModel::IsTraceModel( void ) const {
 }
 
 ID_INLINE bool idClipModel::IsLinked( void ) const {
-	return ( clipLinks != NULL );
+	return ( clipLinks != NULL || clipTreeLinked );
 }
 
 ID_INLINE bool idClipModel::IsEnabled( void ) const {
@@ -263,6 +270,13 @@ ID_INLINE const idTraceModel *idClipModel::GetTraceModel( void ) const {
 //
 //===============================================================
 
+// a single trace for idClip::TraceBatch
+typedef struct clipTrace_s {
+	idVec3					start;
+	idVec3					end;
+	trace_t					results;
+} clipTrace_t;
+
 class idClip {
 
 	friend class idClipModel;
@@ -295,6 +309,14 @@ public:
 	bool					TraceBounds( trace_t &results, const idVec3 &start, const idVec3 &end, const idBounds &bounds,
 								int contentMask, const idEntity *passEntity );
 
+	// many translations of the same model at once, the traces share one clip model gather so they
+	// should be close together, returns the number of traces that hit something
+	int						TraceBatch( clipTrace_t *traces, int numTraces,
+								const idClipModel *mdl, const idMat3 &trmAxis, int contentMask, const idEntity *passEntity );
+	int						TracePointBatch( clipTrace_t *traces, int numTraces, int contentMask, const idEntity *passEntity );
+	int						TraceBoundsBatch( clipTrace_t *traces, int numTraces, const idBounds &bounds,
+								int contentMask, const idEntity *passEntity );
+
 	// clip versus a specific model
 	void					TranslationModel( trace_t &results, const idVec3 &start, const idVec3 &end,
 								const idClipModel *mdl, const idMat3 &trmAxis, int contentMask,
@@ -323,6 +345,8 @@ public:
 	const idBounds &		GetWorldBounds( void ) const;
 	idClipModel *			DefaultClipModel( void );
 
+	bool					UsesClipTree( void ) const;
+
 							// stats and debug drawing
 	void					PrintStatistics( void );
 	void					DrawClipModels( const idVec3 &eye, const float radius, const idEntity *passEntity );
@@ -354,6 +378,9 @@ private:
 	idClipModel				temporaryClipModel;
 	idClipModel				defaultClipModel;
 	mutable int				touchCount;
+	bool					useClipTree;			// dynamic clip tree instead of the clip sectors
+	idClipTree				clipTree;
+	struct contactCache_s *	contactCache;			// contacts per clip model pair from earlier queries
 							// statistics
 	int						numTranslations;
 	int						numRotations;
@@ -361,6 +388,12 @@ private:
 	int						numRenderModelTraces;
 	int						numContents;
 	int						numContacts;
+	int						numSectorLinks;
+	mutable int				numSectorQueries;
+	mutable int				numSectorTests;
+	mutable int				numSectorModelTests;
+	int						numContactCacheHits;
+	int						numContactCacheMisses;
 
 private:
 	struct clipSector_s *	CreateClipSectors_r( const int depth, const idBounds &bounds, idVec3 &maxSector );
@@ -368,8 +401,15 @@ private:
 	void					ClipModelsTouchingBounds_r( const struct clipSector_s *node, struct listParms_s &parms ) const;
 #endif //HUMANHEAD END
 	const idTraceModel *	TraceModelForClipModel( const idClipModel *mdl ) const;
+	int						ContactsCached( contactInfo_t *contacts, const int maxContacts, const idVec3 &start, const idVec6 &dir, const float depth,
+								const idClipModel *mdl, const idTraceModel *trm, const idMat3 &trmAxis, int contentMask,
+								const idClipModel *touch, cmHandle_t model, const idVec3 &modelOrigin, const idMat3 &modelAxis );
 	int						GetTraceClipModels( const idBounds &bounds, int contentMask, const idEntity *passEntity, idClipModel **clipModelList ) const;
 	void					TraceRenderModel( trace_t &trace, const idVec3 &start, const idVec3 &end, const float radius, const idMat3 &axis, idClipModel *touch ) const;
+	int						TraceBatchChunk( clipTrace_t *traces, int numTraces,
+								const idClipModel *mdl, const idMat3 &trmAxis, int contentMask, const idEntity *passEntity );
+	void					TraceBatchRange( struct clipTraceBatch_s &batch, int first, int last ) const;
+	static void				TraceBatchJob( void *data, int first, int last );
 #if _HH_CLIP_FASTSECTORS //HUMANHEAD rww
 	void					GetClipSectorsStaticContents( void );
 #endif //HUMANHEAD END
@@ -387,6 +427,15 @@ ID_INLINE bool idClip::TraceBounds( trace_t &results, const idVec3 &start, const
 	return ( results.fraction < 1.0f );
 }
 
+ID_INLINE int idClip::TracePointBatch( clipTrace_t *traces, int numTraces, int contentMask, const idEntity *passEntity ) {
+	return TraceBatch( traces, numTraces, NULL, mat3_identity, contentMask, passEntity );
+}
+
+ID_INLINE int idClip::TraceBoundsBatch( clipTrace_t *traces, int numTraces, const idBounds &bounds, int contentMask, const idEntity *passEntity ) {
+	temporaryClipModel.LoadModel( idTraceModel( bounds ) );
+	return TraceBatch( traces, numTraces, &temporaryClipModel, mat3_identity, contentMask, passEntity );
+}
+
 ID_INLINE const idBounds & idClip::GetWorldBounds( void ) const {
 	return worldBounds;
 }
@@ -395,6 +444,10 @@ ID_INLINE idClipModel *idClip::DefaultClipModel( void ) {
 	return &defaultClipModel;
 }
 
+ID_INLINE bool idClip::UsesClipTree( void ) const {
+	return useClipTree;
+}
+
 #if _HH_CLIP_FASTSECTORS //HUMANHEAD rww
 ID_INLINE void idClip::CoordsForBounds( int* coords, idBounds& bounds ) const {
 	float fCoords[ 4 ];
@@ -0,0 +1,524 @@
+/*
+===========================================================================
+
+Doom 3 GPL Source Code
+Copyright (C) 1999-2011 id Software LLC, a ZeniMax Media company.
+
+This file is part of the Doom 3 GPL Source Code ("Doom 3 Source Code").
+
+Doom 3 Source Code is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Doom 3 Source Code is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Doom 3 Source Code.  If not, see <http://www.gnu.org/licenses/>.
+
+In addition, the Doom 3 Source Code is also subject to certain additional terms. You should have received a copy of these additional terms immediately following the terms and conditions of the GNU General Public License which accompanied the Doom 3 Source Code.  If not, please request a copy in writing from id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+
+===========================================================================
+*/
+
+
+#include "precompiled.h"
+#pragma hdrstop
+
+#include "../Game_local.h"
+
+#define CLIPTREE_MARGIN					8.0f		// leaf bounds are this much larger than the clip model
+#define CLIPTREE_DISPLACEMENT_SCALE		2.0f		// leaf bounds are stretched this many times the last movement
+#define CLIPTREE_MAX_STRETCH_SCALE		1.0f		// but at most this many times the size of the clip model
+#define CLIPTREE_MAX_STACK				256
+
+/*
+================
+CT_BoundsCost
+
+  half the surface area of the bounds
+================
+*/
+static ID_INLINE float CT_BoundsCost( const idBounds &bounds ) {
+	idVec3 size = bounds[1] - bounds[0];
+	return size.x * size.y + size.y * size.z + size.z * size.x;
+}
+
+/*
+================
+CT_BoundsContain
+================
+*/
+static ID_INLINE bool CT_BoundsContain( const idBounds &outer, const idBounds &inner ) {
+	return (	outer[0].x <= inner[0].x && outer[0].y <= inner[0].y && outer[0].z <= inner[0].z &&
+				outer[1].x >= inner[1].x && outer[1].y >= inner[1].y && outer[1].z >= inner[1].z );
+}
+
+/*
+================
+idClipTree::idClipTree
+================
+*/
+idClipTree::idClipTree( void ) {
+	root = -1;
+	freeNodes = -1;
+	numLeafs = 0;
+	numInserts = numRefits = numQueries = numNodeTests = numModelTests = 0;
+}
+
+/*
+================
+idClipTree::~idClipTree
+================
+*/
+idClipTree::~idClipTree( void ) {
+	nodes.Clear();
+}
+
+/*
+================
+idClipTree::Init
+================
+*/
+void idClipTree::Init( void ) {
+	Shutdown();
+	nodes.SetGranularity( 1024 );
+}
+
+/*
+================
+idClipTree::Shutdown
+================
+*/
+void idClipTree::Shutdown( void ) {
+	int i;
+
+	// the clip models still in the tree are no longer linked
+	for ( i = 0; i < nodes.Num(); i++ ) {
+		idClipModel *clipModel = nodes[i].clipModel;
+		if ( nodes[i].height == 0 && clipModel ) {
+			clipModel->clipTree = NULL;
+			clipModel->clipTreeLeaf = -1;
+			clipModel->clipTreeLinked = false;
+		}
+	}
+
+	nodes.Clear();
+	root = -1;
+	freeNodes = -1;
+	numLeafs = 0;
+	numInserts = numRefits = numQueries = numNodeTests = numModelTests = 0;
+}
+
+/*
+================
+idClipTree::AllocNode
+================
+*/
+int idClipTree::AllocNode( void ) {
+	clipTreeNode_t n;
+	int node;
+
+	n.bounds.Clear();
+	n.parent = -1;
+	n.children[0] = n.children[1] = -1;
+	n.height = 0;
+	n.clipModel = NULL;
+
+	if ( freeNodes != -1 ) {
+		node = freeNodes;
+		freeNodes = nodes[node].parent;
+		nodes[node] = n;
+	} else {
+		node = nodes.Append( n );
+	}
+
+	return node;
+}
+
+/*
+================
+idClipTree::FreeNode
+================
+*/
+void idClipTree::FreeNode( int node ) {
+	nodes[node].parent = freeNodes;
+	nodes[node].height = -1;
+	nodes[node].clipModel = NULL;
+	freeNodes = node;
+}
+
+/*
+================
+idClipTree::CreateLeaf
+================
+*/
+int idClipTree::CreateLeaf( idClipModel *clipModel, const idBounds &bounds ) {
+	int leaf;
+
+	leaf = AllocNode();
+	nodes[leaf].bounds = bounds.Expand( CLIPTREE_MARGIN );
+	nodes[leaf].clipModel = clipModel;
+	numLeafs++;
+
+	InsertLeaf( leaf );
+
+	return leaf;
+}
+
+/*
+================
+idClipTree::FreeLeaf
+================
+*/
+void idClipTree::FreeLeaf( int leaf ) {
+	assert( leaf >= 0 && leaf < nodes.Num() && nodes[leaf].height == 0 );
+
+	RemoveLeaf( leaf );
+	FreeNode( leaf );
+	numLeafs--;
+}
+
+/*
+================
+idClipTree::MoveLeaf
+================
+*/
+bool idClipTree::MoveLeaf( int leaf, const idBounds &bounds, const idVec3 &displacement ) {
+	int i;
+	float size, maxStretch, stretch;
+	idBounds b;
+
+	assert( leaf >= 0 && leaf < nodes.Num() && nodes[leaf].height == 0 );
+
+	// if the clip model is still inside the leaf bounds only the clip model changed
+	if ( CT_BoundsContain( nodes[leaf].bounds, bounds ) ) {
+		numRefits++;
+		return false;
+	}
+
+	RemoveLeaf( leaf );
+
+	b = bounds.Expand( CLIPTREE_MARGIN );
+
+	// stretch the leaf in the direction of movement so a mover doesn't have to be inserted every frame,
+	// a displacement larger than the clip model is a teleport and is not expected to continue
+	size = Max3( bounds[1][0] - bounds[0][0], bounds[1][1] - bounds[0][1], bounds[1][2] - bounds[0][2] );
+	if ( displacement.LengthSqr() <= Square( size ) ) {
+		maxStretch = CLIPTREE_MAX_STRETCH_SCALE * size;
+		for ( i = 0; i < 3; i++ ) {
+			stretch = idMath::ClampFloat( -maxStretch, maxStretch, CLIPTREE_DISPLACEMENT_SCALE * displacement[i] );
+			if ( stretch < 0.0f ) {
+				b[0][i] += stretch;
+			} else {
+				b[1][i] += stretch;
+			}
+		}
+	}
+	nodes[leaf].bounds = b;
+
+	InsertLeaf( leaf );
+
+	return true;
+}
+
+/*
+================
+idClipTree::InsertLeaf
+================
+*/
+void idClipTree::InsertLeaf( int leaf ) {
+	int node, sibling, oldParent, newParent, child0, child1;
+	float cost, inheritanceCost, cost0, cost1;
+	idBounds combined, leafBounds;
+
+	numInserts++;
+
+	if ( root == -1 ) {
+		root = leaf;
+		nodes[root].parent = -1;
+		return;
+	}
+
+	// find the best sibling, stop where going down the tree costs more than pairing with the node
+	leafBounds = nodes[leaf].bounds;
+	node = root;
+	while ( nodes[node].height > 0 ) {
+		child0 = nodes[node].children[0];
+		child1 = nodes[node].children[1];
+
+		combined = nodes[node].bounds + leafBounds;
+		cost = 2.0f * CT_BoundsCost( combined );
+		inheritanceCost = 2.0f * ( CT_BoundsCost( combined ) - CT_BoundsCost( nodes[node].bounds ) );
+
+		cost0 = CT_BoundsCost( nodes[child0].bounds + leafBounds ) + inheritanceCost;
+		if ( nodes[child0].height > 0 ) {
+			cost0 -= CT_BoundsCost( nodes[child0].bounds );
+		}
+		cost1 = CT_BoundsCost( nodes[child1].bounds + leafBounds ) + inheritanceCost;
+		if ( nodes[child1].height > 0 ) {
+			cost1 -= CT_BoundsCost( nodes[child1].bounds );
+		}
+
+		if ( cost < cost0 && cost < cost1 ) {
+			break;
+		}
+
+		node = ( cost0 < cost1 ) ? child0 : child1;
+	}
+	sibling = node;
+
+	// create a new parent for the sibling and the leaf
+	oldParent = nodes[sibling].parent;
+	newParent = AllocNode();
+	nodes[newParent].parent = oldParent;
+	nodes[newParent].bounds = nodes[sibling].bounds + leafBounds;
+	nodes[newParent].height = nodes[sibling].height + 1;
+	nodes[newParent].children[0] = sibling;
+	nodes[newParent].children[1] = leaf;
+	nodes[sibling].parent = newParent;
+	nodes[leaf].parent = newParent;
+
+	if ( oldParent != -1 ) {
+		if ( nodes[oldParent].children[0] == sibling ) {
+			nodes[oldParent].children[0] = newParent;
+		} else {
+			nodes[oldParent].children[1] = newParent;
+		}
+	} else {
+		root = newParent;
+	}
+
+	// fix the heights and bounds up the tree
+	for ( node = nodes[leaf].parent; node != -1; node = nodes[node].parent ) {
+		node = Balance( node );
+
+		child0 = nodes[node].children[0];
+		child1 = nodes[node].children[1];
+		nodes[node].height = 1 + Max( nodes[child0].height, nodes[child1].height );
+		nodes[node].bounds = nodes[child0].bounds + nodes[child1].bounds;
+	}
+}
+
+/*
+================
+idClipTree::RemoveLeaf
+================
+*/
+void idClipTree::RemoveLeaf( int leaf ) {
+	int node, parent, grandParent, sibling, child0, child1;
+
+	if ( leaf == root ) {
+		root = -1;
+		return;
+	}
+
+	parent = nodes[leaf].parent;
+	grandParent = nodes[parent].parent;
+	sibling = ( nodes[parent].children[0] == leaf ) ? nodes[parent].children[1] : nodes[parent].children[0];
+
+	// the sibling takes the place of the parent
+	if ( grandParent != -1 ) {
+		if ( nodes[grandParent].children[0] == parent ) {
+			nodes[grandParent].children[0] = sibling;
+		} else {
+			nodes[grandParent].children[1] = sibling;
+		}
+		nodes[sibling].parent = grandParent;
+		FreeNode( parent );
+
+		for ( node = grandParent; node != -1; node = nodes[node].parent ) {
+			node = Balance( node );
+
+			child0 = nodes[node].children[0];
+			child1 = nodes[node].children[1];
+			nodes[node].bounds = nodes[child0].bounds + nodes[child1].bounds;
+			nodes[node].height = 1 + Max( nodes[child0].height, nodes[child1].height );
+		}
+	} else {
+		root = sibling;
+		nodes[sibling].parent = -1;
+		FreeNode( parent );
+	}
+
+	nodes[leaf].parent = -1;
+}
+
+/*
+================
+idClipTree::Balance
+
+  rotates the higher child up if the children differ more than one in height, returns the new node at this spot
+================
+*/
+int idClipTree::Balance( int a ) {
+	int b, c, f, g, balance;
+
+	if ( nodes[a].height < 2 ) {
+		return a;
+	}
+
+	b = nodes[a].children[0];
+	c = nodes[a].children[1];
+	balance = nodes[c].height - nodes[b].height;
+
+	if ( balance > 1 ) {
+		// rotate c up
+		f = nodes[c].children[0];
+		g = nodes[c].children[1];
+
+		nodes[c].children[0] = a;
+		nodes[c].parent = nodes[a].parent;
+		nodes[a].parent = c;
+
+		if ( nodes[c].parent != -1 ) {
+			if ( nodes[nodes[c].parent].children[0] == a ) {
+				nodes[nodes[c].parent].children[0] = c;
+			} else {
+				nodes[nodes[c].parent].children[1] = c;
+			}
+		} else {
+			root = c;
+		}
+
+		// the higher child of c stays with c
+		if ( nodes[f].height > nodes[g].height ) {
+			nodes[c].children[1] = f;
+			nodes[a].children[1] = g;
+			nodes[g].parent = a;
+		} else {
+			nodes[c].children[1] = g;
+			nodes[a].children[1] = f;
+			nodes[f].parent = a;
+		}
+		nodes[a].bounds = nodes[b].bounds + nodes[nodes[a].children[1]].bounds;
+		nodes[a].height = 1 + Max( nodes[b].height, nodes[nodes[a].children[1]].height );
+		nodes[c].bounds = nodes[a].bounds + nodes[nodes[c].children[1]].bounds;
+		nodes[c].height = 1 + Max( nodes[a].height, nodes[nodes[c].children[1]].height );
+
+		return c;
+	}
+
+	if ( balance < -1 ) {
+		// rotate b up
+		f = nodes[b].children[0];
+		g = nodes[b].children[1];
+
+		nodes[b].children[0] = a;
+		nodes[b].parent = nodes[a].parent;
+		nodes[a].parent = b;
+
+		if ( nodes[b].parent != -1 ) {
+			if ( nodes[nodes[b].parent].children[0] == a ) {
+				nodes[nodes[b].parent].children[0] = b;
+			} else {
+				nodes[nodes[b].parent].children[1] = b;
+			}
+		} else {
+			root = b;
+		}
+
+		// the higher child of b stays with b
+		if ( nodes[f].height > nodes[g].height ) {
+			nodes[b].children[1] = f;
+			nodes[a].children[0] = g;
+			nodes[g].parent = a;
+		} else {
+			nodes[b].children[1] = g;
+			nodes[a].children[0] = f;
+			nodes[f].parent = a;
+		}
+		nodes[a].bounds = nodes[c].bounds + nodes[nodes[a].children[0]].bounds;
+		nodes[a].height = 1 + Max( nodes[c].height, nodes[nodes[a].children[0]].height );
+		nodes[b].bounds = nodes[a].bounds + nodes[nodes[b].children[1]].bounds;
+		nodes[b].height = 1 + Max( nodes[a].height, nodes[nodes[b].children[1]].height );
+
+		return b;
+	}
+
+	return a;
+}
+
+/*
+================
+idClipTree::ClipModelsTouchingBounds
+================
+*/
+int idClipTree::ClipModelsTouchingBounds( const idBounds &bounds, int contentMask, idClipModel **clipModelList, int maxCount ) const {
+	int stack[CLIPTREE_MAX_STACK];
+	int stackSize, node, count;
+
+	numQueries++;
+
+	if ( root == -1 ) {
+		return 0;
+	}
+
+	count = 0;
+	stackSize = 0;
+	stack[stackSize++] = root;
+
+	while ( stackSize > 0 ) {
+		node = stack[--stackSize];
+		const clipTreeNode_t &n = nodes[node];
+
+		numNodeTests++;
+		if ( !n.bounds.IntersectsBounds( bounds ) ) {
+			continue;
+		}
+
+		if ( n.height > 0 ) {
+			if ( stackSize + 2 > CLIPTREE_MAX_STACK ) {
+				gameLocal.Warning( "idClipTree::ClipModelsTouchingBounds: stack overflow" );
+				break;
+			}
+			stack[stackSize++] = n.children[1];
+			stack[stackSize++] = n.children[0];
+			continue;
+		}
+
+		idClipModel *check = n.clipModel;
+
+		numModelTests++;
+
+		// if the clip model is linked and enabled
+		if ( !check->clipTreeLinked || !check->enabled ) {
+			continue;
+		}
+
+		// if the clip model does not have any contents we are looking for
+		if ( !( check->contents & contentMask ) ) {
+			continue;
+		}
+
+		// if the bounds really do overlap
+		if ( !check->absBounds.IntersectsBounds( bounds ) ) {
+			continue;
+		}
+
+		if ( count >= maxCount ) {
+			gameLocal.Warning( "idClipTree::ClipModelsTouchingBounds: max count" );
+			break;
+		}
+
+		clipModelList[count++] = check;
+	}
+
+	return count;
+}
+
+/*
+================
+idClipTree::PrintStatistics
+================
+*/
+void idClipTree::PrintStatistics( void ) {
+	gameLocal.Printf( "clip tree: leafs = %-4d, height = %-3d, inserts = %-3d, refits = %-3d, queries = %-3d, nodes = %-4d, models = %-4d\n",
+					numLeafs, GetHeight(), numInserts, numRefits, numQueries, numNodeTests, numModelTests );
+	numInserts = numRefits = numQueries = numNodeTests = numModelTests = 0;
+}
@@ -0,0 +1,111 @@
+/*
+===========================================================================
+
+Doom 3 GPL Source Code
+Copyright (C) 1999-2011 id Software LLC, a ZeniMax Media company.
+
+This file is part of the Doom 3 GPL Source Code ("Doom 3 Source Code").
+
+Doom 3 Source Code is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Doom 3 Source Code is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Doom 3 Source Code.  If not, see <http://www.gnu.org/licenses/>.
+
+In addition, the Doom 3 Source Code is also subject to certain additional terms. You should have received a copy of these additional terms immediately following the terms and conditions of the GNU General Public License which accompanied the Doom 3 Source Code.  If not, please request a copy in writing from id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+
+===========================================================================
+*/
+
+
+#ifndef __CLIPTREE_H__
+#define __CLIPTREE_H__
+
+/*
+===============================================================================
+
+	Dynamic bounding volume tree for the clip models.
+
+	Alternative to the clip sectors of idClip, selected with g_clipTree.
+	Every clip model that has been linked is a leaf of the tree. Leaf bounds
+	are the absolute bounds of the clip model enlarged with a margin and the
+	last movement, so a clip model that moves a little keeps its leaf and
+	linking it again costs nothing. Otherwise the leaf is removed and inserted
+	again at the spot that grows the tree the least. The tree is kept balanced
+	with rotations.
+
+	Unlinking a clip model only marks it unlinked, the leaf stays until the
+	clip model is linked again or destroyed.
+
+===============================================================================
+*/
+
+class idClipModel;
+
+typedef struct clipTreeNode_s {
+	idBounds				bounds;				// enlarged clip model bounds for leafs
+	int						parent;				// next free node if not used
+	int						children[2];		// -1 for leafs
+	int						height;				// 0 for leafs, -1 for free nodes
+	idClipModel *			clipModel;			// clip model of a leaf
+} clipTreeNode_t;
+
+class idClipTree {
+public:
+							idClipTree( void );
+							~idClipTree( void );
+
+	void					Init( void );
+							// unlinks all clip models and frees the tree
+	void					Shutdown( void );
+
+	int						CreateLeaf( idClipModel *clipModel, const idBounds &bounds );
+	void					FreeLeaf( int leaf );
+							// displacement is the movement since the last time, returns true if the leaf was inserted again
+	bool					MoveLeaf( int leaf, const idBounds &bounds, const idVec3 &displacement );
+
+	int						ClipModelsTouchingBounds( const idBounds &bounds, int contentMask, idClipModel **clipModelList, int maxCount ) const;
+
+	int						GetNumLeafs( void ) const;
+	int						GetHeight( void ) const;
+
+							// stats
+	void					PrintStatistics( void );
+
+private:
+	idList<clipTreeNode_t>	nodes;
+	int						root;
+	int						freeNodes;
+	int						numLeafs;
+							// statistics
+	int						numInserts;
+	int						numRefits;
+	mutable int				numQueries;
+	mutable int				numNodeTests;
+	mutable int				numModelTests;
+
+	int						AllocNode( void );
+	void					FreeNode( int node );
+	void					InsertLeaf( int leaf );
+	void					RemoveLeaf( int leaf );
+	int						Balance( int node );
+};
+
+ID_INLINE int idClipTree::GetNumLeafs( void ) const {
+	return numLeafs;
+}
+
+ID_INLINE int idClipTree::GetHeight( void ) const {
+	return ( root != -1 ) ? nodes[root].height : 0;
+}
+
+#endif /* !__CLIPTREE_H__ */
@@ -0,0 +1,283 @@
+/*
+===========================================================================
+
+Doom 3 GPL Source Code
+Copyright (C) 1999-2011 id Software LLC, a ZeniMax Media company.
+
+This file is part of the Doom 3 GPL Source Code ("Doom 3 Source Code").
+
+Doom 3 Source Code is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Doom 3 Source Code is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Doom 3 Source Code.  If not, see <http://www.gnu.org/licenses/>.
+
+In addition, the Doom 3 Source Code is also subject to certain additional terms. You should have received a copy of these additional terms immediately following the terms and conditions of the GNU General Public License which accompanied the Doom 3 Source Code.  If not, please request a copy in writing from id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+
+===========================================================================
+*/
+
+#include "precompiled.h"
+#pragma hdrstop
+
+#include "../Game_local.h"
+
+#define ISLAND_BOUNDS_EPSILON		2.0f		// swept bounds are expanded with this much
+
+/*
+================
+idPhysicsIslands::idPhysicsIslands
+================
+*/
+idPhysicsIslands::idPhysicsIslands( void ) {
+	int i;
+
+	for ( i = 0; i < MAX_GENTITIES; i++ ) {
+		memberForEntity[i] = -1;
+	}
+	numIslands = 0;
+}
+
+/*
+================
+idPhysicsIslands::SortMembers
+================
+*/
+int idPhysicsIslands::SortMembers( const islandMember_t *a, const islandMember_t *b ) {
+	if ( a->bounds[0].x < b->bounds[0].x ) {
+		return -1;
+	}
+	if ( a->bounds[0].x > b->bounds[0].x ) {
+		return 1;
+	}
+	return a->ent->entityNumber - b->ent->entityNumber;
+}
+
+/*
+================
+idPhysicsIslands::AddMembers
+
+  Adds every active entity that runs physics with the bounds it may sweep through this frame.
+================
+*/
+void idPhysicsIslands::AddMembers( void ) {
+	int i;
+	float frameTime, speed;
+	idEntity *ent, *master, *part;
+	idPhysics *phys;
+	idBounds bounds;
+
+	frameTime = MS2SEC( gameLocal.time - gameLocal.previousTime );
+
+	members.SetNum( 0, false );
+
+	for ( ent = gameLocal.activeEntities.Next(); ent != NULL; ent = ent->activeNode.Next() ) {
+
+		if ( !( ent->thinkFlags & TH_PHYSICS ) ) {
+			continue;
+		}
+
+		// the team master moves the whole team
+		master = ent->GetTeamMaster();
+		if ( master && master != ent ) {
+			continue;
+		}
+
+		islandMember_t &member = members.Alloc();
+		member.ent = ent;
+		member.bounds.Clear();
+
+		for ( part = ent; part != NULL; part = part->GetNextTeamEntity() ) {
+			phys = part->GetPhysics();
+			bounds = phys->GetAbsBounds();
+			if ( bounds.IsCleared() ) {
+				continue;
+			}
+
+			speed = 0.0f;
+			for ( i = 0; i < phys->GetNumClipModels(); i++ ) {
+				speed = Max( speed, phys->GetLinearVelocity( i ).Length() +
+									phys->GetAngularVelocity( i ).Length() * bounds.GetRadius( phys->GetOrigin( i ) ) );
+			}
+			bounds.ExpandSelf( speed * frameTime + ISLAND_BOUNDS_EPSILON );
+
+			member.bounds.AddBounds( bounds );
+		}
+	}
+
+	members.Sort( SortMembers );
+
+	for ( i = 0; i < members.Num(); i++ ) {
+		members[i].parent = i;
+		for ( part = members[i].ent; part != NULL; part = part->GetNextTeamEntity() ) {
+			memberForEntity[part->entityNumber] = i;
+		}
+	}
+}
+
+/*
+================
+idPhysicsIslands::FindIsland
+================
+*/
+int idPhysicsIslands::FindIsland( int member ) {
+	int root, next;
+
+	for ( root = member; members[root].parent != root; root = members[root].parent ) {
+	}
+
+	// point the whole path straight at the root
+	while ( member != root ) {
+		next = members[member].parent;
+		members[member].parent = root;
+		member = next;
+	}
+
+	return root;
+}
+
+/*
+================
+idPhysicsIslands::MergeIslands
+================
+*/
+void idPhysicsIslands::MergeIslands( int member1, int member2 ) {
+	int root1, root2;
+
+	root1 = FindIsland( member1 );
+	root2 = FindIsland( member2 );
+
+	// the member that comes first stays the root so the islands don't depend on the merge order
+	if ( root1 < root2 ) {
+		members[root2].parent = root1;
+	} else if ( root2 < root1 ) {
+		members[root1].parent = root2;
+	}
+}
+
+/*
+================
+idPhysicsIslands::LinkMembers
+
+  Merges the islands of members that touch or may touch each other this frame.
+================
+*/
+void idPhysicsIslands::LinkMembers( void ) {
+	int i, j, k, entityNum;
+	idEntity *part;
+	idPhysics *phys;
+
+	// members in contact with each other
+	for ( i = 0; i < members.Num(); i++ ) {
+		for ( part = members[i].ent; part != NULL; part = part->GetNextTeamEntity() ) {
+			phys = part->GetPhysics();
+			for ( j = 0; j < phys->GetNumContacts(); j++ ) {
+				entityNum = phys->GetContact( j ).entityNum;
+				if ( entityNum < 0 || entityNum >= MAX_GENTITIES ) {
+					continue;
+				}
+				k = memberForEntity[entityNum];
+				if ( k >= 0 ) {
+					MergeIslands( i, k );
+				}
+			}
+		}
+	}
+
+	// members with overlapping swept bounds, the members are sorted on the minimum x of their bounds
+	for ( i = 0; i < members.Num(); i++ ) {
+		const idBounds &bounds = members[i].bounds;
+		for ( j = i + 1; j < members.Num(); j++ ) {
+			if ( members[j].bounds[0].x > bounds[1].x ) {
+				break;
+			}
+			if ( bounds.IntersectsBounds( members[j].bounds ) ) {
+				MergeIslands( i, j );
+			}
+		}
+	}
+}
+
+/*
+================
+idPhysicsIslands::SolveFiguresJob
+================
+*/
+void idPhysicsIslands::SolveFiguresJob( void *data, int first, int last ) {
+	idPhysicsIslands *islands = (idPhysicsIslands *)data;
+
+	for ( int i = first; i < last; i++ ) {
+		islands->figures[i]->IslandSolve();
+	}
+}
+
+/*
+================
+idPhysicsIslands::Solve
+
+  Has to be called before the entities think.
+================
+*/
+void idPhysicsIslands::Solve( void ) {
+	int i;
+	idEntity *ent, *part;
+	idPhysics_AF *af;
+
+	numIslands = 0;
+	figures.SetNum( 0, false );
+
+	if ( !g_physicsIslands.GetBool() || gameLocal.isClient || jobSystem->GetNumWorkers() <= 0 ) {
+		return;
+	}
+
+	AddMembers();
+	LinkMembers();
+
+	islandSize.SetNum( members.Num(), false );
+	for ( i = 0; i < members.Num(); i++ ) {
+		islandSize[i] = 0;
+	}
+	for ( i = 0; i < members.Num(); i++ ) {
+		islandSize[FindIsland( i )]++;
+	}
+
+	// find the contacts of the figures that are alone in their island
+	for ( i = 0; i < members.Num(); i++ ) {
+		if ( members[i].parent != i ) {
+			continue;
+		}
+		numIslands++;
+
+		if ( islandSize[i] != 1 ) {
+			continue;
+		}
+		ent = members[i].ent;
+		if ( ent->GetTeamMaster() || !ent->GetPhysics()->IsType( idPhysics_AF::Type ) ) {
+			continue;
+		}
+		af = static_cast<idPhysics_AF *>( ent->GetPhysics() );
+		if ( af->PrepareIslandSolve( gameLocal.time - gameLocal.previousTime, gameLocal.time ) ) {
+			figures.Append( af );
+		}
+	}
+
+	// solve the figures, the results are picked up when the entities think
+	if ( figures.Num() ) {
+		jobSystem->ParallelFor( figures.Num(), 1, SolveFiguresJob, this );
+	}
+
+	for ( i = 0; i < members.Num(); i++ ) {
+		for ( part = members[i].ent; part != NULL; part = part->GetNextTeamEntity() ) {
+			memberForEntity[part->entityNumber] = -1;
+		}
+	}
+}
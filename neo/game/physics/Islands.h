@@ -0,0 +1,91 @@
+/*
+===========================================================================
+
+Doom 3 GPL Source Code
+Copyright (C) 1999-2011 id Software LLC, a ZeniMax Media company.
+
+This file is part of the Doom 3 GPL Source Code ("Doom 3 Source Code").
+
+Doom 3 Source Code is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Doom 3 Source Code is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Doom 3 Source Code.  If not, see <http://www.gnu.org/licenses/>.
+
+In addition, the Doom 3 Source Code is also subject to certain additional terms. You should have received a copy of these additional terms immediately following the terms and conditions of the GNU General Public License which accompanied the Doom 3 Source Code.  If not, please request a copy in writing from id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+
+===========================================================================
+*/
+
+#ifndef __ISLANDS_H__
+#define __ISLANDS_H__
+
+/*
+===============================================================================
+
+	Physics islands.
+
+	Before the entities think the active physics objects are grouped into
+	islands. Two objects end up in the same island when they are bound
+	together, touch each other or when the bounds they sweep through this
+	frame overlap. Objects in different islands can't influence each other
+	during the frame.
+
+	Articulated figures that are alone in their island have the constraint
+	forces for the frame solved ahead of the think loop on the job workers.
+	The contacts are found and the results are used later from the normal
+	idPhysics_AF::Evaluate of the entity, in the same entity order as always,
+	so the outcome does not depend on the number of workers. If anything
+	changed the figure before it gets to think, the solution is thrown away
+	and the figure is evaluated as usual.
+
+	The solver returns idMatX and idVecX temporaries, those come from a memory
+	pool per thread so the figures solved at the same time don't overwrite
+	each other's matrices.
+
+===============================================================================
+*/
+
+class idPhysics_AF;
+
+class idPhysicsIslands {
+public:
+							idPhysicsIslands( void );
+
+							// build the islands and solve the isolated articulated figures
+	void					Solve( void );
+							// number of islands found the last frame
+	int						GetNumIslands( void ) const { return numIslands; }
+
+private:
+	typedef struct islandMember_s {
+		idEntity *			ent;
+		idBounds			bounds;					// bounds swept this frame
+		int					parent;					// union find parent
+	} islandMember_t;
+
+	idList<islandMember_t>	members;				// sorted on the minimum x of their bounds
+	idList<int>				islandSize;				// number of members for each island root
+	idList<idPhysics_AF *>	figures;				// figures solved on the workers
+	int						memberForEntity[MAX_GENTITIES];
+	int						numIslands;
+
+private:
+	void					AddMembers( void );
+	void					LinkMembers( void );
+	int						FindIsland( int member );
+	void					MergeIslands( int member1, int member2 );
+	static int				SortMembers( const islandMember_t *a, const islandMember_t *b );
+	static void				SolveFiguresJob( void *data, int first, int last );
+};
+
+#endif /* !__ISLANDS_H__ */
@@ -81,6 +81,7 @@ idAFConstraint::idAFConstraint( void ) {
 	body1				= NULL;
 	body2				= NULL;
 	physics				= NULL;
+	changeCount			= 0;
 
 	lo.Zero( 6 );
 	lo.SubVec6(0)		= -vec6_infinity;
@@ -116,6 +117,7 @@ idAFConstraint::SetBody1
 ================
 */
 void idAFConstraint::SetBody1( idAFBody *body ) {
+	changeCount++;
 	if ( body1 != body) {
 		body1 = body;
 		if ( physics ) {
@@ -130,6 +132,7 @@ idAFConstraint::SetBody2
 ================
 */
 void idAFConstraint::SetBody2( idAFBody *body ) {
+	changeCount++;
 	if ( body2 != body ) {
 		body2 = body;
 		if ( physics ) {
@@ -301,6 +304,7 @@ idAFConstraint_Fixed::SetBody1
 ================
 */
 void idAFConstraint_Fixed::SetBody1( idAFBody *body ) {
+	changeCount++;
 	if ( body1 != body) {
 		body1 = body;
 		InitOffset();
@@ -316,6 +320,7 @@ idAFConstraint_Fixed::SetBody2
 ================
 */
 void idAFConstraint_Fixed::SetBody2( idAFBody *body ) {
+	changeCount++;
 	if ( body2 != body ) {
 		body2 = body;
 		InitOffset();
@@ -494,6 +499,7 @@ idAFConstraint_BallAndSocketJoint::SetAnchor
 ================
 */
 void idAFConstraint_BallAndSocketJoint::SetAnchor( const idVec3 &worldPosition ) {
+	changeCount++;
 
 	// get anchor relative to center of mass of body1
 	anchor1 = ( worldPosition - body1->GetWorldOrigin() ) * body1->GetWorldAxis().Transpose();
@@ -531,6 +537,7 @@ idAFConstraint_BallAndSocketJoint::SetNoLimit
 ================
 */
 void idAFConstraint_BallAndSocketJoint::SetNoLimit( void ) {
+	changeCount++;
 	if ( coneLimit ) {
 		delete coneLimit;
 		coneLimit = NULL;
@@ -547,6 +554,7 @@ idAFConstraint_BallAndSocketJoint::SetConeLimit
 ================
 */
 void idAFConstraint_BallAndSocketJoint::SetConeLimit( const idVec3 &coneAxis, const float coneAngle, const idVec3 &body1Axis ) {
+	changeCount++;
 	if ( pyramidLimit ) {
 		delete pyramidLimit;
 		pyramidLimit = NULL;
@@ -570,6 +578,7 @@ idAFConstraint_BallAndSocketJoint::SetPyramidLimit
 */
 void idAFConstraint_BallAndSocketJoint::SetPyramidLimit( const idVec3 &pyramidAxis, const idVec3 &baseAxis,
 														const float angle1, const float angle2, const idVec3 &body1Axis ) {
+	changeCount++;
 	if ( coneLimit ) {
 		delete coneLimit;
 		coneLimit = NULL;
@@ -595,6 +604,7 @@ idAFConstraint_BallAndSocketJoint::SetLimitEpsilon
 ================
 */
 void idAFConstraint_BallAndSocketJoint::SetLimitEpsilon( const float e ) {
+	changeCount++;
 	if ( coneLimit ) {
 		coneLimit->SetEpsilon( e );
 	}
@@ -986,6 +996,7 @@ idAFConstraint_UniversalJoint::SetAnchor
 ================
 */
 void idAFConstraint_UniversalJoint::SetAnchor( const idVec3 &worldPosition ) {
+	changeCount++;
 
 	// get anchor relative to center of mass of body1
 	anchor1 = ( worldPosition - body1->GetWorldOrigin() ) * body1->GetWorldAxis().Transpose();
@@ -1026,6 +1037,7 @@ void idAFConstraint_UniversalJoint::SetShafts( const idVec3 &cardanShaft1, const
 	idVec3 cardanAxis;
 	float l;
 
+	changeCount++;
 	shaft1 = cardanShaft1;
 	l = shaft1.Normalize();
 	assert( l != 0.0f );
@@ -1065,6 +1077,7 @@ idAFConstraint_UniversalJoint::SetNoLimit
 ================
 */
 void idAFConstraint_UniversalJoint::SetNoLimit( void ) {
+	changeCount++;
 	if ( coneLimit ) {
 		delete coneLimit;
 		coneLimit = NULL;
@@ -1081,6 +1094,7 @@ idAFConstraint_UniversalJoint::SetConeLimit
 ================
 */
 void idAFConstraint_UniversalJoint::SetConeLimit( const idVec3 &coneAxis, const float coneAngle ) {
+	changeCount++;
 	if ( pyramidLimit ) {
 		delete pyramidLimit;
 		pyramidLimit = NULL;
@@ -1104,6 +1118,7 @@ idAFConstraint_UniversalJoint::SetPyramidLimit
 */
 void idAFConstraint_UniversalJoint::SetPyramidLimit( const idVec3 &pyramidAxis, const idVec3 &baseAxis,
 														const float angle1, const float angle2 ) {
+	changeCount++;
 	if ( coneLimit ) {
 		delete coneLimit;
 		coneLimit = NULL;
@@ -1127,6 +1142,7 @@ idAFConstraint_UniversalJoint::SetLimitEpsilon
 ================
 */
 void idAFConstraint_UniversalJoint::SetLimitEpsilon( const float e ) {
+	changeCount++;
 	if ( coneLimit ) {
 		coneLimit->SetEpsilon( e );
 	}
@@ -1673,6 +1689,7 @@ idAFConstraint_Hinge::SetAnchor
 ================
 */
 void idAFConstraint_Hinge::SetAnchor( const idVec3 &worldPosition ) {
+	changeCount++;
 	// get anchor relative to center of mass of body1
 	anchor1 = ( worldPosition - body1->GetWorldOrigin() ) * body1->GetWorldAxis().Transpose();
 	if ( body2 ) {
@@ -1708,6 +1725,7 @@ idAFConstraint_Hinge::SetAxis
 void idAFConstraint_Hinge::SetAxis( const idVec3 &axis ) {
 	idVec3 normAxis;
 
+	changeCount++;
 	normAxis = axis;
 	normAxis.Normalize();
 
@@ -1740,6 +1758,7 @@ idAFConstraint_Hinge::SetNoLimit
 ================
 */
 void idAFConstraint_Hinge::SetNoLimit( void ) {
+	changeCount++;
 	if ( coneLimit ) {
 		delete coneLimit;
 		coneLimit = NULL;
@@ -1752,6 +1771,7 @@ idAFConstraint_Hinge::SetLimit
 ================
 */
 void idAFConstraint_Hinge::SetLimit( const idVec3 &axis, const float angle, const idVec3 &body1Axis ) {
+	changeCount++;
 	if ( !coneLimit ) {
 		coneLimit = new idAFConstraint_ConeLimit;
 		coneLimit->SetPhysics( physics );
@@ -1770,6 +1790,7 @@ idAFConstraint_Hinge::SetLimitEpsilon
 ================
 */
 void idAFConstraint_Hinge::SetLimitEpsilon( const float e ) {
+	changeCount++;
 	if ( coneLimit ) {
 		coneLimit->SetEpsilon( e );
 	}
@@ -1812,6 +1833,7 @@ idAFConstraint_Hinge::SetSteerAngle
 ================
 */
 void idAFConstraint_Hinge::SetSteerAngle( const float degrees ) {
+	changeCount++;
 	if ( coneLimit ) {
 		delete coneLimit;
 		coneLimit = NULL;
@@ -1829,6 +1851,7 @@ idAFConstraint_Hinge::SetSteerSpeed
 ================
 */
 void idAFConstraint_Hinge::SetSteerSpeed( const float speed ) {
+	changeCount++;
 	if ( steering ) {
 		steering->SetSteerSpeed( speed );
 	}
@@ -2361,6 +2384,7 @@ idAFConstraint_Slider::SetAxis
 void idAFConstraint_Slider::SetAxis( const idVec3 &ax ) {
 	idVec3 normAxis;
 
+	changeCount++;
 	// get normalized axis relative to body1
 	normAxis = ax;
 	normAxis.Normalize();
@@ -2598,6 +2622,7 @@ idAFConstraint_Plane::SetPlane
 ================
 */
 void idAFConstraint_Plane::SetPlane( const idVec3 &normal, const idVec3 &anchor ) {
+	changeCount++;
 	// get anchor relative to center of mass of body1
 	anchor1 = ( anchor - body1->GetWorldOrigin() ) * body1->GetWorldAxis().Transpose();
 	if ( body2 ) {
@@ -2764,6 +2789,7 @@ idAFConstraint_Spring::SetAnchor
 ================
 */
 void idAFConstraint_Spring::SetAnchor( const idVec3 &worldAnchor1, const idVec3 &worldAnchor2 ) {
+	changeCount++;
 	// get anchor relative to center of mass of body1
 	anchor1 = ( worldAnchor1 - body1->GetWorldOrigin() ) * body1->GetWorldAxis().Transpose();
 	if ( body2 ) {
@@ -2781,6 +2807,7 @@ idAFConstraint_Spring::SetSpring
 ================
 */
 void idAFConstraint_Spring::SetSpring( const float stretch, const float compress, const float damping, const float restLength ) {
+	changeCount++;
 	assert( stretch >= 0.0f && compress >= 0.0f && restLength >= 0.0f );
 	this->kstretch = stretch;
 	this->kcompress = compress;
@@ -2794,6 +2821,7 @@ idAFConstraint_Spring::SetLimit
 ================
 */
 void idAFConstraint_Spring::SetLimit( const float minLength, const float maxLength ) {
+	changeCount++;
 	assert( minLength >= 0.0f && maxLength >= 0.0f && maxLength >= minLength );
 	this->minLength = minLength;
 	this->maxLength = maxLength;
@@ -3445,6 +3473,7 @@ idAFConstraint_ConeLimit::SetAnchor
 ================
 */
 void idAFConstraint_ConeLimit::SetAnchor( const idVec3 &coneAnchor ) {
+	changeCount++;
 	this->coneAnchor = coneAnchor;
 }
 
@@ -3454,6 +3483,7 @@ idAFConstraint_ConeLimit::SetBody1Axis
 ================
 */
 void idAFConstraint_ConeLimit::SetBody1Axis( const idVec3 &body1Axis ) {
+	changeCount++;
 	this->body1Axis = body1Axis;
 }
 
@@ -3708,6 +3738,7 @@ idAFConstraint_PyramidLimit::SetAnchor
 ================
 */
 void idAFConstraint_PyramidLimit::SetAnchor( const idVec3 &pyramidAnchor ) {
+	changeCount++;
 	this->pyramidAnchor = pyramidAnchor;
 }
 
@@ -3717,6 +3748,7 @@ idAFConstraint_PyramidLimit::SetBody1Axis
 ================
 */
 void idAFConstraint_PyramidLimit::SetBody1Axis( const idVec3 &body1Axis ) {
+	changeCount++;
 	this->body1Axis = body1Axis;
 }
 
@@ -4000,6 +4032,7 @@ idAFConstraint_Suspension::SetSuspension
 ================
 */
 void idAFConstraint_Suspension::SetSuspension( const float up, const float down, const float k, const float d, const float f ) {
+	changeCount++;
 	suspensionUp = up;
 	suspensionDown = down;
 	suspensionKCompress = k;
@@ -4266,6 +4299,7 @@ void idAFBody::Init( void ) {
 	contactMotorDir				= vec3_zero;
 	contactMotorVelocity		= 0.0f;
 	contactMotorForce			= 0.0f;
+	changeCount					= 0;
 
 	mass						= 1.0f;
 	invMass						= 1.0f;
@@ -4307,6 +4341,7 @@ idAFBody::SetClipModel
 ================
 */
 void idAFBody::SetClipModel( idClipModel *clipModel ) {
+	changeCount++;
 	if ( this->clipModel && this->clipModel != clipModel ) {
 		delete this->clipModel;
 	}
@@ -4319,6 +4354,7 @@ idAFBody::SetFriction
 ================
 */
 void idAFBody::SetFriction( float linear, float angular, float contact ) {
+	changeCount++;
 	if ( linear < 0.0f || linear > 1.0f ||
 			angular < 0.0f || angular > 1.0f ||
 				contact < 0.0f ) {
@@ -4336,6 +4372,7 @@ idAFBody::SetBouncyness
 ================
 */
 void idAFBody::SetBouncyness( float bounce ) {
+	changeCount++;
 	if ( bounce < 0.0f || bounce > 1.0f ) {
 		gameLocal.Warning( "idAFBody::SetBouncyness: bouncyness out of range, bounce = %.1f", bounce );
 		return;
@@ -4349,6 +4386,7 @@ idAFBody::SetDensity
 ================
 */
 void idAFBody::SetDensity( float density, const idMat3 &inertiaScale ) {
+	changeCount++;
 
 	// get the body mass properties
 	clipModel->GetMassProperties( density, mass, centerOfMass, inertiaTensor );
@@ -4392,6 +4430,7 @@ idAFBody::SetFrictionDirection
 ================
 */
 void idAFBody::SetFrictionDirection( const idVec3 &dir ) {
+	changeCount++;
 	frictionDir = dir * current->worldAxis.Transpose();
 	fl.useFrictionDir = true;
 }
@@ -4415,6 +4454,7 @@ idAFBody::SetContactMotorDirection
 ================
 */
 void idAFBody::SetContactMotorDirection( const idVec3 &dir ) {
+	changeCount++;
 	contactMotorDir = dir * current->worldAxis.Transpose();
 	fl.useContactMotorDir = true;
 }
@@ -5292,7 +5332,9 @@ void idPhysics_AF::AuxiliaryForces( float timeStep ) {
 	}
 
 #ifdef AF_TIMINGS
-	timer_lcp.Start();
+	if ( islandSolveTime < 0 ) {
+		timer_lcp.Start();
+	}
 #endif
 
 	// calculate lagrange multipliers for auxiliary constraints
@@ -5301,7 +5343,9 @@ void idPhysics_AF::AuxiliaryForces( float timeStep ) {
 	}
 
 #ifdef AF_TIMINGS
-	timer_lcp.Stop();
+	if ( islandSolveTime < 0 ) {
+		timer_lcp.Stop();
+	}
 #endif
 
 	// calculate auxiliary constraint forces
@@ -5918,6 +5962,7 @@ idPhysics_AF::SetTimeScaleRamp
 ================
 */
 void idPhysics_AF::SetTimeScaleRamp( const float start, const float end ) {
+	changeCount++;
 	timeScaleRampStart = start;
 	timeScaleRampEnd = end;
 }
@@ -5928,6 +5973,7 @@ idPhysics_AF::SetJointFrictionDent
 ================
 */
 void idPhysics_AF::SetJointFrictionDent( const float dent, const float start, const float end ) {
+	changeCount++;
 	jointFrictionDent = dent;
 	jointFrictionDentStart = start;
 	jointFrictionDentEnd = end;
@@ -5955,6 +6001,7 @@ idPhysics_AF::SetContactFrictionDent
 ================
 */
 void idPhysics_AF::SetContactFrictionDent( const float dent, const float start, const float end ) {
+	changeCount++;
 	contactFrictionDent = dent;
 	contactFrictionDentStart = start;
 	contactFrictionDentEnd = end;
@@ -6248,6 +6295,7 @@ idPhysics_AF::SetContents
 void idPhysics_AF::SetContents( int contents, int id ) {
 	int i;
 
+	changeCount++;
 	if ( id >= 0 && id < bodies.Num() ) {
 		bodies[id]->GetClipModel()->SetContents( contents );
 	}
@@ -6334,22 +6382,221 @@ const idBounds &idPhysics_AF::GetAbsBounds( int id ) const {
 
 /*
 ================
-idPhysics_AF::Evaluate
+idPhysics_AF::GetChangeCount
+
+  sum of the parameter changes of the figure, its bodies and its constraints
 ================
 */
-bool idPhysics_AF::Evaluate( int timeStepMSec, int endTimeMSec ) {
-	PROFILE_SCOPE("AF", PROFMASK_PHYSICS);
-	float timeStep;
+int idPhysics_AF::GetChangeCount( void ) const {
+	int i, count;
 
+	count = changeCount;
+	for ( i = 0; i < bodies.Num(); i++ ) {
+		count += bodies[i]->changeCount;
+	}
+	for ( i = 0; i < constraints.Num(); i++ ) {
+		count += constraints[i]->changeCount;
+	}
+	return count;
+}
+
+/*
+================
+idPhysics_AF::GetTimeStep
+================
+*/
+float idPhysics_AF::GetTimeStep( int timeStepMSec, int endTimeMSec ) const {
 	if ( timeScaleRampStart < MS2SEC( endTimeMSec ) && timeScaleRampEnd > MS2SEC( endTimeMSec ) ) {
-		timeStep = MS2SEC( timeStepMSec ) * ( MS2SEC( endTimeMSec ) - timeScaleRampStart ) / ( timeScaleRampEnd - timeScaleRampStart );
+		return MS2SEC( timeStepMSec ) * ( MS2SEC( endTimeMSec ) - timeScaleRampStart ) / ( timeScaleRampEnd - timeScaleRampStart );
 	} else if ( af_timeScale.GetFloat() != 1.0f ) {
-		timeStep = MS2SEC( timeStepMSec ) * af_timeScale.GetFloat();
+		return MS2SEC( timeStepMSec ) * af_timeScale.GetFloat();
 	} else {
-		timeStep = MS2SEC( timeStepMSec ) * timeScale;
+		return MS2SEC( timeStepMSec ) * timeScale;
+	}
+}
+
+/*
+================
+idPhysics_AF::SolveConstraints
+
+  Only touches the bodies and constraints of this articulated figure
+  so it can run on a job worker.
+================
+*/
+void idPhysics_AF::SolveConstraints( float timeStep, int endTimeMSec ) {
+
+	// evaluate constraint equations
+	EvaluateConstraints( timeStep );
+
+	// apply friction
+	ApplyFriction( timeStep, endTimeMSec );
+
+	// add frame constraints
+	AddFrameConstraints();
+
+#ifdef AF_TIMINGS
+	// the timers are only used when not solving on a job worker
+	if ( islandSolveTime < 0 ) {
+		timer_pc.Start();
+	}
+#endif
+
+	// factor matrices for primary constraints
+	PrimaryFactor();
+
+	// calculate forces on bodies after applying primary constraints
+	PrimaryForces( timeStep );
+
+#ifdef AF_TIMINGS
+	if ( islandSolveTime < 0 ) {
+		timer_pc.Stop();
+		timer_ac.Start();
+	}
+#endif
+
+	// calculate and apply auxiliary constraint forces
+	AuxiliaryForces( timeStep );
+
+#ifdef AF_TIMINGS
+	if ( islandSolveTime < 0 ) {
+		timer_ac.Stop();
+	}
+#endif
+
+	// evolve current state to next state
+	Evolve( timeStep );
+}
+
+/*
+================
+idPhysics_AF::PrepareIslandSolve
+
+  Finds the contacts for the next step so IslandSolve can solve it ahead of Evaluate.
+  Returns false if the figure does not move or can't be solved separately.
+================
+*/
+bool idPhysics_AF::PrepareIslandSolve( int timeStepMSec, int endTimeMSec ) {
+	int i;
+	float timeStep;
+
+	DiscardIslandSolve();
+
+	if ( current.atRest >= 0 || masterBody || frozen || changedAF || linearTime != af_useLinearTime.GetBool() ) {
+		return false;
+	}
+
+	// a push velocity is only known once the pusher moved
+	if ( current.pushVelocity != vec6_origin ) {
+		return false;
+	}
+
+	// suspensions trace against the world while being evaluated
+	for ( i = 0; i < constraints.Num(); i++ ) {
+		if ( constraints[i]->GetType() == CONSTRAINT_SUSPENSION ) {
+			return false;
+		}
+	}
+
+	timeStep = GetTimeStep( timeStepMSec, endTimeMSec );
+	if ( timeStep <= 0.0f ) {
+		return false;
 	}
 	current.lastTimeStep = timeStep;
 
+	// remember the state the step is solved from
+	islandState = current;
+	islandBodyStates.SetNum( bodies.Num(), false );
+	for ( i = 0; i < bodies.Num(); i++ ) {
+		islandBodyStates[i] = *bodies[i]->current;
+	}
+
+	EvaluateContacts();
+
+	SetupContactConstraints();
+
+	islandSolveTime = endTimeMSec;
+	islandTimeStep = timeStep;
+	islandNumFrameConstraints = 0;
+
+	return true;
+}
+
+/*
+================
+idPhysics_AF::IslandSolve
+================
+*/
+void idPhysics_AF::IslandSolve( void ) {
+	assert( islandSolveTime >= 0 );
+
+	SolveConstraints( islandTimeStep, islandSolveTime );
+
+	islandNumFrameConstraints = frameConstraints.Num();
+	islandChangeCount = GetChangeCount();
+}
+
+/*
+================
+idPhysics_AF::UseIslandSolve
+
+  Returns true if the step solved ahead of Evaluate started from exactly the current state.
+================
+*/
+bool idPhysics_AF::UseIslandSolve( float timeStep, int endTimeMSec ) {
+	int i;
+
+	if ( islandSolveTime < 0 ) {
+		return false;
+	}
+
+	// the state and the parameters of the figure must not have been changed since it was solved
+	if ( islandSolveTime != endTimeMSec || islandTimeStep != timeStep || masterBody || frozen ||
+			islandNumFrameConstraints != frameConstraints.Num() || islandBodyStates.Num() != bodies.Num() ||
+				islandChangeCount != GetChangeCount() || memcmp( &islandState, &current, sizeof( current ) ) != 0 ) {
+		DiscardIslandSolve();
+		return false;
+	}
+
+	for ( i = 0; i < bodies.Num(); i++ ) {
+		if ( memcmp( &islandBodyStates[i], bodies[i]->current, sizeof( AFBodyPState_t ) ) != 0 ) {
+			DiscardIslandSolve();
+			return false;
+		}
+	}
+
+	islandSolveTime = -1;
+
+	return true;
+}
+
+/*
+================
+idPhysics_AF::DiscardIslandSolve
+================
+*/
+void idPhysics_AF::DiscardIslandSolve( void ) {
+	if ( islandSolveTime < 0 ) {
+		return;
+	}
+	islandSolveTime = -1;
+
+	// remove the frame constraints the solve added to the auxiliary constraints
+	auxiliaryConstraints.SetNum( auxiliaryConstraints.Num() - islandNumFrameConstraints, false );
+	frameConstraints.SetNum( 0, false );
+}
+
+/*
+================
+idPhysics_AF::Evaluate
+================
+*/
+bool idPhysics_AF::Evaluate( int timeStepMSec, int endTimeMSec ) {
+	PROFILE_SCOPE("AF", PROFMASK_PHYSICS);
+	float timeStep;
+
+	timeStep = GetTimeStep( timeStepMSec, endTimeMSec );
+	current.lastTimeStep = timeStep;
+
 	// HUMANHEAD JRM - To allow afs to waked up when masters change
 #if 0
 	if (current.atRest && masterBody) {
@@ -6364,6 +6611,7 @@ bool idPhysics_AF::Evaluate( int timeStepMSec, int endTimeMSec ) {
 
 	// if the articulated figure changed
 	if ( changedAF || ( linearTime != af_useLinearTime.GetBool() ) ) {
+		DiscardIslandSolve();
 		BuildTrees();
 		changedAF = false;
 		linearTime = af_useLinearTime.GetBool();
@@ -6404,6 +6652,7 @@ bool idPhysics_AF::Evaluate( int timeStepMSec, int endTimeMSec ) {
 
 	// if the simulation is suspended because the figure is at rest
 	if ( current.atRest >= 0 || timeStep <= 0.0f ) {
+		DiscardIslandSolve();
 		DebugDraw();
 		return false;
 	}
@@ -6415,28 +6664,26 @@ bool idPhysics_AF::Evaluate( int timeStepMSec, int endTimeMSec ) {
 	timer_total.Start();
 #endif
 
+	// use the step solved ahead of the think loop if nothing changed the figure since
+	if ( !UseIslandSolve( timeStep, endTimeMSec ) ) {
+
 #ifdef AF_TIMINGS
-	timer_collision.Start();
+		timer_collision.Start();
 #endif
 
-	// evaluate contacts
-	EvaluateContacts();
+		// evaluate contacts
+		EvaluateContacts();
 
-	// setup contact constraints
-	SetupContactConstraints();
+		// setup contact constraints
+		SetupContactConstraints();
 
 #ifdef AF_TIMINGS
-	timer_collision.Stop();
+		timer_collision.Stop();
 #endif
 
-	// evaluate constraint equations
-	EvaluateConstraints( timeStep );
-
-	// apply friction
-	ApplyFriction( timeStep, endTimeMSec );
-
-	// add frame constraints
-	AddFrameConstraints();
+		// solve the constraint forces and evolve current state to next state
+		SolveConstraints( timeStep, endTimeMSec );
+	}
 
 #ifdef AF_TIMINGS
 	int i, numPrimary = 0, numAuxiliary = 0;
@@ -6446,30 +6693,8 @@ bool idPhysics_AF::Evaluate( int timeStepMSec, int endTimeMSec ) {
 	for ( i = 0; i < auxiliaryConstraints.Num(); i++ ) {
 		numAuxiliary += auxiliaryConstraints[i]->J1.GetNumRows();
 	}
-	timer_pc.Start();
-#endif
-
-	// factor matrices for primary constraints
-	PrimaryFactor();
-
-	// calculate forces on bodies after applying primary constraints
-	PrimaryForces( timeStep );
-
-#ifdef AF_TIMINGS
-	timer_pc.Stop();
-	timer_ac.Start();
 #endif
 
-	// calculate and apply auxiliary constraint forces
-	AuxiliaryForces( timeStep );
-
-#ifdef AF_TIMINGS
-	timer_ac.Stop();
-#endif
-
-	// evolve current state to next state
-	Evolve( timeStep );
-
 	// debug graphics
 	DebugDraw();
 
@@ -6799,12 +7024,19 @@ idPhysics_AF::idPhysics_AF( void ) {
 	noImpact = false;
 	worldConstraintsLocked = false;
 	forcePushable = false;
+	changeCount = 0;
 
 	// HUMANHEAD nla
 	frozen = false;
 	invMass = 1;
 	// HUMANHEAD
 
+	islandSolveTime = -1;
+	islandTimeStep = 0.0f;
+	islandNumFrameConstraints = 0;
+	islandChangeCount = 0;
+	memset( &islandState, 0, sizeof( islandState ) );
+
 #ifdef AF_TIMINGS
 	lastTimerReset = 0;
 #endif
@@ -7544,6 +7776,7 @@ idPhysics_AF::SetDefaultFriction
 ================
 */
 void idPhysics_AF::SetDefaultFriction( float linear, float angular, float contact ) {
+	changeCount++;
 	if (	linear < 0.0f || linear > 1.0f ||
 			angular < 0.0f || angular > 1.0f ||
 			contact < 0.0f || contact > 1.0f ) {
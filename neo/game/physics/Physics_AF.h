@@ -120,6 +120,7 @@ protected:
 	idAFBody *				body1;						// first constrained body
 	idAFBody *				body2;						// second constrained body, NULL for world
 	idPhysics_AF *			physics;					// for adding additional constraints like limits
+	int						changeCount;				// incremented whenever a parameter is set
 
 							// simulation variables set by Evaluate
 	idMatX					J1, J2;						// matrix with left hand side of constraint equations
@@ -155,8 +156,8 @@ class idAFConstraint_Fixed : public idAFConstraint {
 
 public:
 							idAFConstraint_Fixed( const idStr &name, idAFBody *body1, idAFBody *body2 );
-	void					SetRelativeOrigin( const idVec3 &origin ) { this->offset = origin; }
-	void					SetRelativeAxis( const idMat3 &axis ) { this->relAxis = axis; }
+	void					SetRelativeOrigin( const idVec3 &origin ) { this->offset = origin; changeCount++; }
+	void					SetRelativeAxis( const idMat3 &axis ) { this->relAxis = axis; changeCount++; }
 	virtual void			SetBody1( idAFBody *body );
 	virtual void			SetBody2( idAFBody *body );
 	virtual void			DebugDraw( void );
@@ -190,7 +191,7 @@ public:
 	void					SetPyramidLimit( const idVec3 &pyramidAxis, const idVec3 &baseAxis,
 											const float angle1, const float angle2, const idVec3 &body1Axis );
 	void					SetLimitEpsilon( const float e );
-	void					SetFriction( const float f ) { friction = f; }
+	void					SetFriction( const float f ) { friction = f; changeCount++; }
 	float					GetFriction( void ) const;
 	virtual void			DebugDraw( void );
 	virtual void			GetForce( idAFBody *body, idVec6 &force );
@@ -247,7 +248,7 @@ public:
 	void					SetPyramidLimit( const idVec3 &pyramidAxis, const idVec3 &baseAxis,
 											const float angle1, const float angle2 );
 	void					SetLimitEpsilon( const float e );
-	void					SetFriction( const float f ) { friction = f; }
+	void					SetFriction( const float f ) { friction = f; changeCount++; }
 	float					GetFriction( void ) const;
 	virtual void			DebugDraw( void );
 	virtual void			GetForce( idAFBody *body, idVec6 &force );
@@ -327,7 +328,7 @@ public:
 	float					GetAngle( void ) const;
 	void					SetSteerAngle( const float degrees );
 	void					SetSteerSpeed( const float speed );
-	void					SetFriction( const float f ) { friction = f; }
+	void					SetFriction( const float f ) { friction = f; changeCount++; }
 	float					GetFriction( void ) const;
 	virtual void			DebugDraw( void );
 	virtual void			GetForce( idAFBody *body, idVec6 &force );
@@ -377,9 +378,9 @@ class idAFConstraint_HingeSteering : public idAFConstraint {
 public:
 							idAFConstraint_HingeSteering( void );
 	void					Setup( idAFConstraint_Hinge *cc );
-	void					SetSteerAngle( const float degrees ) { steerAngle = degrees; }
-	void					SetSteerSpeed( const float speed ) { steerSpeed = speed; }
-	void					SetEpsilon( const float e ) { epsilon = e; }
+	void					SetSteerAngle( const float degrees ) { steerAngle = degrees; changeCount++; }
+	void					SetSteerSpeed( const float speed ) { steerSpeed = speed; changeCount++; }
+	void					SetEpsilon( const float e ) { epsilon = e; changeCount++; }
 	bool					Add( idPhysics_AF *phys, float invTimeStep );
 	virtual void			Translate( const idVec3 &translation );
 	virtual void			Rotate( const idRotation &rotation );
@@ -543,7 +544,7 @@ public:
 									const float coneAngle, const idVec3 &body1Axis );
 	void					SetAnchor( const idVec3 &coneAnchor );
 	void					SetBody1Axis( const idVec3 &body1Axis );
-	void					SetEpsilon( const float e ) { epsilon = e; }
+	void					SetEpsilon( const float e ) { epsilon = e; changeCount++; }
 	bool					Add( idPhysics_AF *phys, float invTimeStep );
 	virtual void			DebugDraw( void );
 	virtual void			Translate( const idVec3 &translation );
@@ -575,7 +576,7 @@ public:
 									const float pyramidAngle1, const float pyramidAngle2, const idVec3 &body1Axis );
 	void					SetAnchor( const idVec3 &pyramidAxis );
 	void					SetBody1Axis( const idVec3 &body1Axis );
-	void					SetEpsilon( const float e ) { epsilon = e; }
+	void					SetEpsilon( const float e ) { epsilon = e; changeCount++; }
 	bool					Add( idPhysics_AF *phys, float invTimeStep );
 	virtual void			DebugDraw( void );
 	virtual void			Translate( const idVec3 &translation );
@@ -606,11 +607,11 @@ public:
 	void					Setup( const char *name, idAFBody *body, const idVec3 &origin, const idMat3 &axis, idClipModel *clipModel );
 	void					SetSuspension( const float up, const float down, const float k, const float d, const float f );
 
-	void					SetSteerAngle( const float degrees ) { steerAngle = degrees; }
+	void					SetSteerAngle( const float degrees ) { steerAngle = degrees; changeCount++; }
 	void					EnableMotor( const bool enable ) { motorEnabled = enable; }
-	void					SetMotorForce( const float force ) { motorForce = force; }
-	void					SetMotorVelocity( const float vel ) { motorVelocity = vel; }
-	void					SetEpsilon( const float e ) { epsilon = e; }
+	void					SetMotorForce( const float force ) { motorForce = force; changeCount++; }
+	void					SetMotorVelocity( const float vel ) { motorVelocity = vel; changeCount++; }
+	void					SetEpsilon( const float e ) { epsilon = e; changeCount++; }
 	const idVec3			GetWheelOrigin( void ) const;
 
 	virtual void			DebugDraw( void );
@@ -674,9 +675,9 @@ public:
 	const idVec3 &			GetCenterOfMass( void ) const { return centerOfMass; }
 	void					SetClipModel( idClipModel *clipModel );
 	idClipModel *			GetClipModel( void ) const { return clipModel; }
-	void					SetClipMask( const int mask ) { clipMask = mask; fl.clipMaskSet = true; }
+	void					SetClipMask( const int mask ) { clipMask = mask; fl.clipMaskSet = true; changeCount++; }
 	int						GetClipMask( void ) const { return clipMask; }
-	void					SetSelfCollision( const bool enable ) { fl.selfCollision = enable; }
+	void					SetSelfCollision( const bool enable ) { fl.selfCollision = enable; changeCount++; }
 	void					SetWorldOrigin( const idVec3 &origin ) { current->worldOrigin = origin; }
 	void					SetWorldAxis( const idMat3 &axis ) { current->worldAxis = axis; }
 	void					SetLinearVelocity( const idVec3 &linear ) const { current->spatialVelocity.SubVec3(0) = linear; }
@@ -694,9 +695,9 @@ public:
 
 	void					SetContactMotorDirection( const idVec3 &dir );
 	bool					GetContactMotorDirection( idVec3 &dir ) const;
-	void					SetContactMotorVelocity( float vel ) { contactMotorVelocity = vel; }
+	void					SetContactMotorVelocity( float vel ) { contactMotorVelocity = vel; changeCount++; }
 	float					GetContactMotorVelocity( void ) const { return contactMotorVelocity; }
-	void					SetContactMotorForce( float force ) { contactMotorForce = force; }
+	void					SetContactMotorForce( float force ) { contactMotorForce = force; changeCount++; }
 	float					GetContactMotorForce( void ) const { return contactMotorForce; }
 
 	void					AddForce( const idVec3 &point, const idVec3 &force );
@@ -726,6 +727,7 @@ private:
 	idVec3					contactMotorDir;			// contact motor direction
 	float					contactMotorVelocity;		// contact motor velocity
 	float					contactMotorForce;			// maximum force applied to reach the motor velocity
+	int						changeCount;				// incremented whenever a parameter is set
 
 							// derived properties
 	float					mass;						// mass of body
@@ -858,25 +860,25 @@ public:
 							// set minimum and maximum simulation time in seconds
 	void					SetSuspendTime( const float minTime, const float maxTime );
 							// set the time scale value
-	void					SetTimeScale( const float ts ) { timeScale = ts; }
+	void					SetTimeScale( const float ts ) { timeScale = ts; changeCount++; }
 							// set time scale ramp
 	void					SetTimeScaleRamp( const float start, const float end );
 							// set the joint friction scale
-	void					SetJointFrictionScale( const float scale ) { jointFrictionScale = scale; }
+	void					SetJointFrictionScale( const float scale ) { jointFrictionScale = scale; changeCount++; }
 							// set joint friction dent
 	void					SetJointFrictionDent( const float dent, const float start, const float end );
 							// get the current joint friction scale
 	float					GetJointFrictionScale( void ) const;
 							// set the contact friction scale
-	void					SetContactFrictionScale( const float scale ) { contactFrictionScale = scale; }
+	void					SetContactFrictionScale( const float scale ) { contactFrictionScale = scale; changeCount++; }
 							// set contact friction dent
 	void					SetContactFrictionDent( const float dent, const float start, const float end );
 							// get the current contact friction scale
 	float					GetContactFrictionScale( void ) const;
 							// enable or disable collision detection
-	void					SetCollision( const bool enable ) { enableCollision = enable; }
+	void					SetCollision( const bool enable ) { enableCollision = enable; changeCount++; }
 							// enable or disable self collision
-	void					SetSelfCollision( const bool enable ) { selfCollision = enable; }
+	void					SetSelfCollision( const bool enable ) { selfCollision = enable; changeCount++; }
 							// enable or disable coming to a dead stop
 	void					SetComeToRest( bool enable ) { comeToRest = enable; }
 							// call when structure of articulated figure changes
@@ -961,6 +963,10 @@ public:	// common physics interface
 
 	void					SetMaster( idEntity *master, const bool orientated = true );
 
+							// solve the next step ahead of Evaluate, see idPhysicsIslands
+	bool					PrepareIslandSolve( int timeStepMSec, int endTimeMSec );
+	void					IslandSolve( void );
+
 	void					WriteToSnapshot( idBitMsgDelta &msg ) const;
 	void					ReadFromSnapshot( const idBitMsgDelta &msg );
 
@@ -1017,6 +1023,7 @@ private:
 	bool					noImpact;						// if true do not activate when another object collides
 	bool					worldConstraintsLocked;			// if true world constraints cannot be moved
 	bool					forcePushable;					// if true can be pushed even when bound to a master
+	int						changeCount;					// incremented whenever a parameter is set
 
 							// physics state
 	AFPState_t				current;
@@ -1030,9 +1037,19 @@ private:
 	float					invMass;	// The inv mass of the body
 	// HUMANHEAD END
 
+							// step solved ahead of Evaluate
+	int						islandSolveTime;				// end time of the solved step, -1 if none
+	float					islandTimeStep;					// time step of the solved step
+	int						islandNumFrameConstraints;		// frame constraints after solving
+	int						islandChangeCount;				// parameter changes after solving
+	AFPState_t				islandState;					// state the step was solved from
+	idList<AFBodyPState_t>	islandBodyStates;				// body states the step was solved from
+
 private:
 	void					BuildTrees( void );
 	bool					IsClosedLoop( const idAFBody *body1, const idAFBody *body2 ) const;
+	float					GetTimeStep( int timeStepMSec, int endTimeMSec ) const;
+	int						GetChangeCount( void ) const;
 	void					PrimaryFactor( void );
 	void					EvaluateBodies( float timeStep );
 	void					EvaluateConstraints( float timeStep );
@@ -1045,6 +1062,9 @@ private:
 	void					SetupContactConstraints( void );
 	void					ApplyContactForces( void );
 	void					Evolve( float timeStep );
+	void					SolveConstraints( float timeStep, int endTimeMSec );
+	bool					UseIslandSolve( float timeStep, int endTimeMSec );
+	void					DiscardIslandSolve( void );
 	idEntity *				SetupCollisionForBody( idAFBody *body ) const;
 	bool					CollisionImpulse( float timeStep, idAFBody *body, trace_t &collision );
 	bool					ApplyCollisions( float timeStep );
@@ -37,6 +37,12 @@ END_CLASS
 // DG: physics fixes from TDM
 const float STOP_SPEED = 50.0f; // grayman #3452 (was 10) - allow less movement at end to prevent excessive jiggling
 const float OLD_STOP_SPEED = 10.0f; // grayman #3452 - still needed at this value for some of the math
+const float NO_MOVE_TRANSLATION_TOLERANCE = 4.0f;	// a body goes to sleep when it moved less than this during rb_sleepTime
+const float NO_MOVE_ROTATION_TOLERANCE = 4.0f;		// and rotated less degrees than this
+const float SLEEP_LINEAR_SPEED = 0.05f * STOP_SPEED;	// and moves slower than this
+const float SLEEP_ANGULAR_SPEED = 0.1f;				// and rotates slower than this many radians per second
+const float WAKE_TRANSLATION_TOLERANCE = 1.0f;		// contact entities are woken when the body moved further than this
+const float WAKE_ROTATION_TOLERANCE = 2.0f;			// or rotated more degrees than this
 
 
 #undef RB_TIMINGS
@@ -399,6 +405,91 @@ bool idPhysics_RigidBody::TestIfAtRest( void ) const {
 	return true;
 }
 
+/*
+================
+RB_HardlyMoved
+================
+*/
+static bool RB_HardlyMoved( const idVec3 &origin, const idMat3 &axis, const idVec3 &oldOrigin, const idMat3 &oldAxis,
+								const float translationTolerance, const float rotationTolerance ) {
+	if ( ( origin - oldOrigin ).LengthSqr() > Square( translationTolerance ) ) {
+		return false;
+	}
+	// the trace of the relative rotation is 1 + 2 * cos( angle )
+	if ( axis[0] * oldAxis[0] + axis[1] * oldAxis[1] + axis[2] * oldAxis[2] < 1.0f + 2.0f * idMath::Cos( DEG2RAD( rotationTolerance ) ) ) {
+		return false;
+	}
+	return true;
+}
+
+/*
+================
+idPhysics_RigidBody::TestIfSleeping
+
+  Returns true if the body is in contact with something, hardly moved for rb_sleepTime milliseconds
+  and almost stands still. Catches the bodies that settled but never pass TestIfAtRest, like bodies
+  leaning against each other or jittering on a slope, without freezing bodies that slowly slide or roll.
+================
+*/
+bool idPhysics_RigidBody::TestIfSleeping( void ) {
+	int sleepTime;
+	idVec3 v, av;
+	idMat3 inverseWorldInertiaTensor;
+
+	sleepTime = rb_sleepTime.GetInteger();
+	if ( sleepTime <= 0 || contacts.Num() == 0 ) {
+		noMoveTime = -1;
+		return false;
+	}
+
+	if ( noMoveTime < 0 || !RB_HardlyMoved( current.i.position, current.i.orientation, noMoveOrigin, noMoveAxis,
+												NO_MOVE_TRANSLATION_TOLERANCE, NO_MOVE_ROTATION_TOLERANCE ) ) {
+		noMoveTime = gameLocal.time;
+		noMoveOrigin = current.i.position;
+		noMoveAxis = current.i.orientation;
+		return false;
+	}
+
+	if ( gameLocal.time - noMoveTime < sleepTime ) {
+		return false;
+	}
+
+	// a body that creeps along keeps moving even though it stays within the tolerances for a while
+	v = inverseMass * current.i.linearMomentum;
+	if ( v.LengthSqr() > Square( SLEEP_LINEAR_SPEED ) ) {
+		return false;
+	}
+
+	inverseWorldInertiaTensor = current.i.orientation * inverseInertiaTensor * current.i.orientation.Transpose();
+	av = inverseWorldInertiaTensor * current.i.angularMomentum;
+	if ( av.LengthSqr() > Square( SLEEP_ANGULAR_SPEED ) ) {
+		return false;
+	}
+
+	return true;
+}
+
+/*
+================
+idPhysics_RigidBody::MovedSinceWake
+
+  Returns true if the body moved enough since the contact entities were last woken to wake them again.
+  A body that is settling or jittering in place should not keep waking everything that rests against it.
+================
+*/
+bool idPhysics_RigidBody::MovedSinceWake( void ) {
+	if ( rb_sleepTime.GetInteger() <= 0 ) {
+		return true;
+	}
+	if ( RB_HardlyMoved( current.i.position, current.i.orientation, wakeOrigin, wakeAxis,
+							WAKE_TRANSLATION_TOLERANCE, WAKE_ROTATION_TOLERANCE ) ) {
+		return false;
+	}
+	wakeOrigin = current.i.position;
+	wakeAxis = current.i.orientation;
+	return true;
+}
+
 /*
 ================
 idPhysics_RigidBody::DropToFloorAndRest
@@ -523,6 +614,12 @@ idPhysics_RigidBody::idPhysics_RigidBody( void ) {
 	hasMaster = false;
 	isOrientated = false;
 
+	noMoveTime = -1;
+	noMoveOrigin.Zero();
+	noMoveAxis.Identity();
+	wakeOrigin.Zero();
+	wakeAxis.Identity();
+
 #ifdef RB_TIMINGS
 	lastTimerReset = 0;
 #endif
@@ -642,6 +739,10 @@ void idPhysics_RigidBody::Restore( idRestoreGame *savefile ) {
 
 	savefile->ReadBool( hasMaster );
 	savefile->ReadBool( isOrientated );
+
+	noMoveTime = -1;
+	wakeOrigin = current.i.position;
+	wakeAxis = current.i.orientation;
 }
 
 /*
@@ -991,8 +1092,8 @@ bool idPhysics_RigidBody::Evaluate( int timeStepMSec, int endTimeMSec ) {
 		timer_collision.Stop();
 #endif
 
-		// check if the body has come to rest
-		if ( TestIfAtRest() ) {
+		// check if the body has come to rest or hardly moved for a while
+		if ( TestIfAtRest() || TestIfSleeping() ) {
 			// put to rest
 			Rest();
 			cameToRest = true;
@@ -1002,7 +1103,8 @@ bool idPhysics_RigidBody::Evaluate( int timeStepMSec, int endTimeMSec ) {
 		}
 	}
 
-	if ( current.atRest < 0 ) {
+	// only wake the entities in contact with this body when it actually moved
+	if ( current.atRest < 0 && MovedSinceWake() ) {
 		ActivateContactEntities();
 	}
 
@@ -1120,6 +1222,7 @@ void idPhysics_RigidBody::ApplyImpulse( const int id, const idVec3 &point, const
 
 	current.i.linearMomentum += impulse;
 	current.i.angularMomentum += ( point - ( current.i.position + centerOfMass * current.i.orientation ) ).Cross( impulse );
+	noMoveTime = -1;
 	Activate();
 }
 
@@ -1134,6 +1237,7 @@ void idPhysics_RigidBody::AddForce( const int id, const idVec3 &point, const idV
 	}
 	current.externalForce += force;
 	current.externalTorque += ( point - ( current.i.position + centerOfMass * current.i.orientation ) ).Cross( force );
+	noMoveTime = -1;
 	Activate();
 }
 
@@ -1206,6 +1310,7 @@ void idPhysics_RigidBody::SetOrigin( const idVec3 &newOrigin, int id ) {
 
 	clipModel->Link( gameLocal.clip, self, clipModel->GetId(), current.i.position, clipModel->GetAxis() );
 
+	noMoveTime = -1;
 	Activate();
 }
 
@@ -1229,6 +1334,7 @@ void idPhysics_RigidBody::SetAxis( const idMat3 &newAxis, int id ) {
 
 	clipModel->Link( gameLocal.clip, self, clipModel->GetId(), clipModel->GetOrigin(), current.i.orientation );
 
+	noMoveTime = -1;
 	Activate();
 }
 
@@ -1244,6 +1350,7 @@ void idPhysics_RigidBody::Translate( const idVec3 &translation, int id ) {
 
 	clipModel->Link( gameLocal.clip, self, clipModel->GetId(), current.i.position, clipModel->GetAxis() );
 
+	noMoveTime = -1;
 	Activate();
 }
 
@@ -1271,6 +1378,7 @@ void idPhysics_RigidBody::Rotate( const idRotation &rotation, int id ) {
 
 	clipModel->Link( gameLocal.clip, self, clipModel->GetId(), current.i.position, current.i.orientation );
 
+	noMoveTime = -1;
 	Activate();
 }
 
@@ -1299,6 +1407,7 @@ idPhysics_RigidBody::SetLinearVelocity
 */
 void idPhysics_RigidBody::SetLinearVelocity( const idVec3 &newLinearVelocity, int id ) {
 	current.i.linearMomentum = newLinearVelocity * mass;
+	noMoveTime = -1;
 	Activate();
 }
 
@@ -1309,6 +1418,7 @@ idPhysics_RigidBody::SetAngularVelocity
 */
 void idPhysics_RigidBody::SetAngularVelocity( const idVec3 &newAngularVelocity, int id ) {
 	current.i.angularMomentum = newAngularVelocity * inertiaTensor;
+	noMoveTime = -1;
 	Activate();
 }
 
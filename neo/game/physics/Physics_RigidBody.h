@@ -184,6 +184,13 @@ protected:	// HUMANHEAD
 	bool					hasMaster;
 	bool					isOrientated;
 
+	// sleeping
+	int						noMoveTime;					// time the body started to hardly move, -1 if moving
+	idVec3					noMoveOrigin;				// position when the body started to hardly move
+	idMat3					noMoveAxis;					// orientation when the body started to hardly move
+	idVec3					wakeOrigin;					// position when the contact entities were last woken
+	idMat3					wakeAxis;					// orientation when the contact entities were last woken
+
 protected:	// HUMANHEAD
 	friend void				RigidBodyDerivatives( const float t, const void *clientData, const float *state, float *derivatives );
 	virtual	// HUMANHEAD: made virtual
@@ -194,6 +201,8 @@ protected:	// HUMANHEAD
 	void					ContactFriction( float deltaTime );
 	void					DropToFloorAndRest( void );
 	bool					TestIfAtRest( void ) const;
+	bool					TestIfSleeping( void );
+	bool					MovedSinceWake( void );
 	void					Rest( void );
 	void					DebugDraw( void );
 	// HUMANHEAD pdm: testing
@@ -677,6 +677,8 @@ enum {
 	PUSH_BLOCKED		// blocked
 };
 
+#define PUSH_CULL_EPSILON		1.0f
+
 /*
 ============
 idPush::ClipEntityRotation
@@ -1070,6 +1072,67 @@ int idPush::DiscardEntities( idEntity *entityList[], int numEntities, int flags,
 	return num;
 }
 
+/*
+============
+idPush::CullTranslationalPush
+
+  Returns true if the pusher can't touch the entity while moving along the translation.
+  The test is done in the space of the pusher where the clip model bounds are tight.
+============
+*/
+bool idPush::CullTranslationalPush( idEntity *check, const idClipModel *clipModel, const idVec3 &translation ) const {
+	idBounds localBounds, sweptBounds;
+	idVec3 localMove;
+
+	// always try to push entities standing on the pusher
+	if ( check->GetPhysics()->IsGroundClipModel( clipModel->GetEntity()->entityNumber, clipModel->GetId() ) ) {
+		return false;
+	}
+
+	localBounds.FromTransformedBounds( check->GetPhysics()->GetAbsBounds().Translate( -clipModel->GetOrigin() ), vec3_origin, clipModel->GetAxis().Transpose() );
+	localBounds.ExpandSelf( PUSH_CULL_EPSILON );
+	localMove = clipModel->GetAxis() * translation;
+
+	// the pusher might already be linked at its new position so sweep both ways
+	sweptBounds = localBounds;
+	sweptBounds.AddBounds( localBounds.Translate( localMove ) );
+	sweptBounds.AddBounds( localBounds.Translate( -localMove ) );
+
+	return !sweptBounds.IntersectsBounds( clipModel->GetBounds() );
+}
+
+/*
+============
+idPush::CullRotationalPush
+
+  Returns true if the pusher can't touch the entity while rotating.
+  The test is done in the space of the pusher where the clip model bounds are tight.
+============
+*/
+bool idPush::CullRotationalPush( idEntity *check, const idClipModel *clipModel, const idRotation &rotation ) const {
+	idBounds localBounds;
+	float angle;
+
+	// always try to push entities standing on the pusher
+	if ( check->GetPhysics()->IsGroundClipModel( clipModel->GetEntity()->entityNumber, clipModel->GetId() ) ) {
+		return false;
+	}
+
+	const idBounds &absBounds = check->GetPhysics()->GetAbsBounds();
+
+	// no point of the entity moves further relative to the pusher than its distance
+	// to the rotation origin times the angle or twice that distance
+	angle = DEG2RAD( idMath::Fabs( rotation.GetAngle() ) );
+	if ( angle > 2.0f ) {
+		angle = 2.0f;
+	}
+
+	localBounds.FromTransformedBounds( absBounds.Translate( -clipModel->GetOrigin() ), vec3_origin, clipModel->GetAxis().Transpose() );
+	localBounds.ExpandSelf( absBounds.GetRadius( rotation.GetOrigin() ) * angle + PUSH_CULL_EPSILON );
+
+	return !localBounds.IntersectsBounds( clipModel->GetBounds() );
+}
+
 /*
 ============
 idPush::ClipTranslationalPush
@@ -1122,6 +1185,7 @@ float idPush::ClipTranslationalPush( trace_t &results, idEntity *pusher, const i
 
 	// discard entities we cannot or should not push
 	listedEntities = DiscardEntities( entityList, listedEntities, flags, pusher );
+	numListed += listedEntities;
 
 	if ( flags & PUSHFL_CLIP ) {
 
@@ -1168,6 +1232,12 @@ float idPush::ClipTranslationalPush( trace_t &results, idEntity *pusher, const i
 
 		check = entityList[ i ];
 
+		// skip entities the pusher can't reach without tracing against them
+		if ( g_pushCulling.GetBool() && CullTranslationalPush( check, clipModel, clipMove ) ) {
+			numCulled++;
+			continue;
+		}
+
 		idPhysics *physics = check->GetPhysics();
 
 		// disable the entity for collision detection
@@ -1206,6 +1276,7 @@ float idPush::ClipTranslationalPush( trace_t &results, idEntity *pusher, const i
 
 			// add mass of pushed entity
 			totalMass += physics->GetMass();
+			numMoved++;
 		}
 
 		// if the entity is not blocking
@@ -1313,6 +1384,7 @@ float idPush::ClipRotationalPush( trace_t &results, idEntity *pusher, const int
 
 	// discard entities we cannot or should not push
 	listedEntities = DiscardEntities( entityList, listedEntities, flags, pusher );
+	numListed += listedEntities;
 
 	if ( flags & PUSHFL_CLIP ) {
 
@@ -1358,6 +1430,12 @@ float idPush::ClipRotationalPush( trace_t &results, idEntity *pusher, const int
 
 		check = entityList[ i ];
 
+		// skip entities the pusher can't reach without tracing against them
+		if ( g_pushCulling.GetBool() && CullRotationalPush( check, clipModel, clipRotation ) ) {
+			numCulled++;
+			continue;
+		}
+
 		idPhysics *physics = check->GetPhysics();
 
 		// disable the entity for collision detection
@@ -1384,6 +1462,7 @@ float idPush::ClipRotationalPush( trace_t &results, idEntity *pusher, const int
 
 			// add mass of pushed entity
 			totalMass += physics->GetMass();
+			numMoved++;
 		}
 
 		// if the entity is not blocking
@@ -1454,6 +1533,14 @@ float idPush::ClipPush( trace_t &results, idEntity *pusher, const int flags,
 	idVec3 translation;
 	idRotation rotation;
 	float mass;
+	bool showTimes;
+	double startTicks;
+
+	// idTimer only has millisecond resolution
+	showTimes = g_showPushTimes.GetBool();
+	startTicks = showTimes ? idLib::sys->GetClockTicks() : 0.0;
+
+	numListed = numCulled = numMoved = 0;
 
 	mass = 0.0f;
 
@@ -1469,41 +1556,45 @@ float idPush::ClipPush( trace_t &results, idEntity *pusher, const int flags,
 	if ( translation != vec3_origin ) {
 
 		mass += ClipTranslationalPush( results, pusher, flags, newOrigin, translation );
-		if ( results.fraction < 1.0f ) {
-			newOrigin = oldOrigin;
-			newAxis = oldAxis;
-			return mass;
-		}
 	} else {
 		newOrigin = oldOrigin;
 	}
 
 	// rotational push
-	rotation = ( oldAxis.Transpose() * newAxis ).ToRotation();
-	rotation.SetOrigin( newOrigin );
-	rotation.Normalize180();
-	rotation.ReCalculateMatrix();		// recalculate the rotation matrix to avoid accumulating rounding errors
+	if ( results.fraction >= 1.0f ) {
+		rotation = ( oldAxis.Transpose() * newAxis ).ToRotation();
+		rotation.SetOrigin( newOrigin );
+		rotation.Normalize180();
+		rotation.ReCalculateMatrix();		// recalculate the rotation matrix to avoid accumulating rounding errors
 
-	// if the pusher rotates
-	if ( rotation.GetAngle() != 0.0f ) {
+		// if the pusher rotates
+		if ( rotation.GetAngle() != 0.0f ) {
 
-		// recalculate new axis to avoid floating point rounding problems
-		newAxis = oldAxis * rotation.ToMat3();
-		newAxis.OrthoNormalizeSelf();
-		newAxis.FixDenormals();
-		newAxis.FixDegeneracies();
+			// recalculate new axis to avoid floating point rounding problems
+			newAxis = oldAxis * rotation.ToMat3();
+			newAxis.OrthoNormalizeSelf();
+			newAxis.FixDenormals();
+			newAxis.FixDegeneracies();
 
-		pusher->GetPhysics()->GetClipModel()->SetPosition( newOrigin, oldAxis );
+			pusher->GetPhysics()->GetClipModel()->SetPosition( newOrigin, oldAxis );
 
-		mass += ClipRotationalPush( results, pusher, flags, newAxis, rotation );
-		if ( results.fraction < 1.0f ) {
-			newOrigin = oldOrigin;
+			mass += ClipRotationalPush( results, pusher, flags, newAxis, rotation );
+		} else {
 			newAxis = oldAxis;
-			return mass;
 		}
-	} else {
+	}
+
+	// if blocked the pusher stays where it was
+	if ( results.fraction < 1.0f ) {
+		newOrigin = oldOrigin;
 		newAxis = oldAxis;
 	}
 
+	if ( showTimes ) {
+		double ms = ( idLib::sys->GetClockTicks() - startTicks ) * 1000.0 / idLib::sys->ClockTicksPerSecond();
+		gameLocal.Printf( "%d: push '%s' %1.3f ms, %d listed, %d culled, %d pushed%s\n", gameLocal.framenum, pusher->name.c_str(),
+							ms, numListed, numCulled, numMoved, ( results.fraction < 1.0f ) ? ", blocked" : "" );
+	}
+
 	return mass;
 }
@@ -87,6 +87,11 @@ private:
 	}				pushedGroup[MAX_GENTITIES];
 	int				pushedGroupSize;
 
+					// statistics for the current ClipPush
+	int				numListed;				// entities touching the bounds of the push
+	int				numCulled;				// entities skipped because the pusher can't reach them
+	int				numMoved;				// entities moved by the pusher
+
 private:
 	void			SaveEntityPosition( idEntity *ent );
 	bool			RotateEntityToAxial( idEntity *ent, idVec3 rotationPoint );
@@ -110,6 +115,8 @@ private:
 	int				TryRotatePushEntity( trace_t &results, idEntity *check, idClipModel *clipModel, const int flags,
 												const idMat3 &newAxis, const idRotation &rotation );
 	int				DiscardEntities( idEntity *entityList[], int numEntities, int flags, idEntity *pusher );
+	bool			CullTranslationalPush( idEntity *check, const idClipModel *clipModel, const idVec3 &translation ) const;
+	bool			CullRotationalPush( idEntity *check, const idClipModel *clipModel, const idRotation &rotation ) const;
 #endif
 };
 
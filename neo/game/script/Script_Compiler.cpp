@@ -2686,6 +2686,11 @@ void idCompiler::CompileFile( const char *text, const char *filename, bool toCon
 		throw idCompileError( error );
 	}
 
+	// remember the headers for the program image, the ones with only defines never produce a token
+	for ( int i = 0; i < parser.GetIncludedFiles().Num(); i++ ) {
+		gameLocal.program.AddIncludedFile( parser.GetIncludedFiles()[i] );
+	}
+
 	parser.FreeSource();
 
 	compile_time.Stop();
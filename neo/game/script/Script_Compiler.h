@@ -194,6 +194,27 @@ enum {
 	NUM_OPCODES
 };
 
+// superinstructions execute a statement and the one following it, they are
+// only found in the instructions decoded by idProgram::DecodeStatements
+enum {
+	OP_EQ_F_IF = NUM_OPCODES,
+	OP_EQ_F_IFNOT,
+	OP_NE_F_IF,
+	OP_NE_F_IFNOT,
+	OP_LT_IF,
+	OP_LT_IFNOT,
+	OP_LE_IF,
+	OP_LE_IFNOT,
+	OP_GT_IF,
+	OP_GT_IFNOT,
+	OP_GE_IF,
+	OP_GE_IFNOT,
+	OP_ADDRESS_STOREP_INT,		// OP_ADDRESS followed by a 4 byte OP_STOREP
+	OP_ADDRESS_STOREP_V,
+
+	NUM_INSTRUCTIONS
+};
+
 class idCompiler {
 private:
 	static bool		punctuationValid[ 256 ];
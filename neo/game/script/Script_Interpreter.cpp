@@ -40,6 +40,7 @@ idInterpreter::idInterpreter() {
 	localstackUsed = 0;
 	terminateOnExit = true;
 	debug = 0;
+	statementCount = 0;
 	memset( localstack, 0, sizeof( localstack ) );
 	memset( callStack, 0, sizeof( callStack ) );
 	Reset();
@@ -639,6 +640,10 @@ void idInterpreter::EnterFunction( const function_t *func, bool clearStack ) {
 	assert( !func->eventdef );
 	NextInstruction( func->firstStatement );
 
+	if ( scriptProfiler.IsActive() ) {
+		scriptProfiler.EnterFunction( this, func );
+	}
+
 	// allocate space on the stack for locals
 	// parms are already on stack
 	c = func->locals - func->parmTotal;
@@ -704,6 +709,10 @@ void idInterpreter::LeaveFunction( idVarDef *returnDef ) {
 		}
 	}
 
+	if ( scriptProfiler.IsActive() ) {
+		scriptProfiler.LeaveFunction( this );
+	}
+
 	// up stack
 	callStackDepth--;
 	stack = &callStack[ callStackDepth ];
@@ -733,6 +742,7 @@ void idInterpreter::CallEvent( const function_t *func, int argsize ) {
 	intptr_t			data[ D_EVENT_MAXARGS ];
 	const idEventDef	*evdef;
 	const char			*format;
+	int					profileNode;
 
 	if ( !func ) {
 		Error( "NULL function" );
@@ -855,7 +865,13 @@ void idInterpreter::CallEvent( const function_t *func, int argsize ) {
 	}
 
 	popParms = argsize;
-	eventEntity->ProcessEventArgPtr( evdef, data );
+	if ( scriptProfiler.IsActive() ) {
+		profileNode = scriptProfiler.BeginEvent( evdef, false );
+		eventEntity->ProcessEventArgPtr( evdef, data );
+		scriptProfiler.EndEvent( this, profileNode );
+	} else {
+		eventEntity->ProcessEventArgPtr( evdef, data );
+	}
 
 	if ( !multiFrameEvent ) {
 		if ( popParms ) {
@@ -941,6 +957,7 @@ void idInterpreter::CallSysEvent( const function_t *func, int argsize ) {
 	intptr_t			data[ D_EVENT_MAXARGS ];
 	const idEventDef	*evdef;
 	const char			*format;
+	int					profileNode;
 
 	if ( !func ) {
 		Error( "NULL function" );
@@ -1009,7 +1026,13 @@ void idInterpreter::CallSysEvent( const function_t *func, int argsize ) {
 	}
 
 	popParms = argsize;
-	thread->ProcessEventArgPtr( evdef, data );
+	if ( scriptProfiler.IsActive() ) {
+		profileNode = scriptProfiler.BeginEvent( evdef, true );
+		thread->ProcessEventArgPtr( evdef, data );
+		scriptProfiler.EndEvent( this, profileNode );
+	} else {
+		thread->ProcessEventArgPtr( evdef, data );
+	}
 	if ( popParms ) {
 		PopParms( popParms );
 	}
@@ -1020,6 +1043,76 @@ void idInterpreter::CallSysEvent( const function_t *func, int argsize ) {
 //#define _ASSERT_ON_INTERPRETER_NANS
 //HUMANHEAD END
 
+/*
+====================
+idInterpreter::DebugStatement
+====================
+*/
+void idInterpreter::DebugStatement( void ) {
+	static int lastLineNumber = -1;
+
+	if ( gameLocal.editors & EDITOR_DEBUGGER ) {
+		common->DebuggerCheckBreakpoint ( this, &gameLocal.program, instructionPointer );
+	} else if ( g_debugScript.GetBool ( ) ) {
+		if ( lastLineNumber != gameLocal.program.GetStatement ( instructionPointer ).linenumber ) {				
+			gameLocal.Printf ( "%s (%d)\n", 
+				gameLocal.program.GetFilename ( gameLocal.program.GetStatement ( instructionPointer ).file ),
+				gameLocal.program.GetStatement ( instructionPointer ).linenumber
+				);
+			lastLineNumber = gameLocal.program.GetStatement ( instructionPointer ).linenumber;
+		}
+	}
+}
+
+/*
+	The statements are executed from the instructions decoded by idProgram::DecodeStatements.
+	With GCC and clang every handler dispatches the next instruction itself through a table
+	of label addresses, other compilers go through the switch.  When the debugger, g_debugScript
+	or !g_scriptSuperInstructions is used, every statement is checked and executed on its own.
+*/
+#if defined( __GNUC__ )
+#define SCRIPT_COMPUTED_GOTO
+#endif
+
+// advances to the next statement
+#define SCRIPT_FETCH()															\
+	instructionPointer++;														\
+	if ( !--runaway ) {															\
+		Error( "runaway loop error" );											\
+	}																			\
+	st = &gameLocal.program.GetStatement( instructionPointer );					\
+	inst = &instructions[ instructionPointer ];									\
+	op = inst->op;																\
+	if ( checkStatements ) {													\
+		op = st->op;															\
+		DebugStatement();														\
+	}
+
+// moves on to the second statement of a superinstruction
+#define SCRIPT_SKIP()															\
+	instructionPointer++;														\
+	if ( !--runaway ) {															\
+		Error( "runaway loop error" );											\
+	}																			\
+	st++;																		\
+	inst++;
+
+// executes the OP_IF or OP_IFNOT of a compare superinstruction
+#define SCRIPT_BRANCH( branchIfTrue )											\
+	SCRIPT_SKIP();																\
+	var_a = GetOperand( inst, 0 );												\
+	if ( ( *var_a.intPtr != 0 ) == ( branchIfTrue ) ) {							\
+		NextInstruction( instructionPointer + inst->operands[ 1 ].jumpOffset );	\
+	}
+
+#ifdef SCRIPT_COMPUTED_GOTO
+#define SCRIPT_OP( op )			case op: label_##op
+#define SCRIPT_NEXT				if ( doneProcessing || threadDying ) { goto done; } SCRIPT_FETCH(); goto *dispatchTable[ op ]
+#else
+#define SCRIPT_OP( op )			case op
+#define SCRIPT_NEXT				break
+#endif
+
 /*
 ====================
 idInterpreter::Execute
@@ -1031,18 +1124,68 @@ bool idInterpreter::Execute( void ) {
 	varEval_t	var_c;
 	varEval_t	var;
 	statement_t	*st;
+	const scriptInstruction_t *instructions;
+	const scriptInstruction_t *inst;
+	int			op;
+	bool		checkStatements;
+	bool		profiling;
 	int			runaway;
 	idThread	*newThread;
 	float		floatVal;
 	idScriptObject *obj;
 	const function_t *func;
 
+#ifdef SCRIPT_COMPUTED_GOTO
+	static void *dispatchTable[ NUM_INSTRUCTIONS ] = {
+		&&label_OP_RETURN, &&label_OP_UINC_F, &&label_OP_UINCP_F, &&label_OP_UDEC_F,
+		&&label_OP_UDECP_F, &&label_OP_COMP_F, &&label_OP_MUL_F, &&label_OP_MUL_V,
+		&&label_OP_MUL_FV, &&label_OP_MUL_VF, &&label_OP_DIV_F, &&label_OP_MOD_F,
+		&&label_OP_ADD_F, &&label_OP_ADD_V, &&label_OP_ADD_S, &&label_OP_ADD_FS,
+		&&label_OP_ADD_SF, &&label_OP_ADD_VS, &&label_OP_ADD_SV, &&label_OP_SUB_F,
+		&&label_OP_SUB_V, &&label_OP_EQ_F, &&label_OP_EQ_V, &&label_OP_EQ_S,
+		&&label_OP_EQ_E, &&label_OP_EQ_EO, &&label_OP_EQ_OE, &&label_OP_EQ_OO,
+		&&label_OP_NE_F, &&label_OP_NE_V, &&label_OP_NE_S, &&label_OP_NE_E,
+		&&label_OP_NE_EO, &&label_OP_NE_OE, &&label_OP_NE_OO, &&label_OP_LE,
+		&&label_OP_GE, &&label_OP_LT, &&label_OP_GT, &&label_OP_INDIRECT_F,
+		&&label_OP_INDIRECT_V, &&label_OP_INDIRECT_S, &&label_OP_INDIRECT_ENT, &&label_OP_INDIRECT_BOOL,
+		&&label_OP_INDIRECT_OBJ, &&label_OP_ADDRESS, &&label_OP_EVENTCALL, &&label_OP_OBJECTCALL,
+		&&label_OP_SYSCALL, &&label_OP_STORE_F, &&label_OP_STORE_V, &&label_OP_STORE_S,
+		&&label_OP_STORE_ENT, &&label_OP_STORE_BOOL, &&label_OP_STORE_OBJENT, &&label_OP_STORE_OBJ,
+		&&label_OP_STORE_ENTOBJ, &&label_OP_STORE_FTOS, &&label_OP_STORE_BTOS, &&label_OP_STORE_VTOS,
+		&&label_OP_STORE_FTOBOOL, &&label_OP_STORE_BOOLTOF, &&label_OP_STOREP_F, &&label_OP_STOREP_V,
+		&&label_OP_STOREP_S, &&label_OP_STOREP_ENT, &&label_OP_STOREP_FLD, &&label_OP_STOREP_BOOL,
+		&&label_OP_STOREP_OBJ, &&label_OP_STOREP_OBJENT, &&label_OP_STOREP_FTOS, &&label_OP_STOREP_BTOS,
+		&&label_OP_STOREP_VTOS, &&label_OP_STOREP_FTOBOOL, &&label_OP_STOREP_BOOLTOF, &&label_OP_UMUL_F,
+		&&label_OP_UMUL_V, &&label_OP_UDIV_F, &&label_OP_UDIV_V, &&label_OP_UMOD_F,
+		&&label_OP_UADD_F, &&label_OP_UADD_V, &&label_OP_USUB_F, &&label_OP_USUB_V,
+		&&label_OP_UAND_F, &&label_OP_UOR_F, &&label_OP_NOT_BOOL, &&label_OP_NOT_F,
+		&&label_OP_NOT_V, &&label_OP_NOT_S, &&label_OP_NOT_ENT, &&label_OP_NEG_F,
+		&&label_OP_NEG_V, &&label_OP_INT_F, &&label_OP_IF, &&label_OP_IFNOT,
+		&&label_OP_CALL, &&label_OP_THREAD, &&label_OP_OBJTHREAD, &&label_OP_PUSH_F,
+		&&label_OP_PUSH_V, &&label_OP_PUSH_S, &&label_OP_PUSH_ENT, &&label_OP_PUSH_OBJ,
+		&&label_OP_PUSH_OBJENT, &&label_OP_PUSH_FTOS, &&label_OP_PUSH_BTOF, &&label_OP_PUSH_FTOB,
+		&&label_OP_PUSH_VTOS, &&label_OP_PUSH_BTOS, &&label_OP_GOTO, &&label_OP_AND,
+		&&label_OP_AND_BOOLF, &&label_OP_AND_FBOOL, &&label_OP_AND_BOOLBOOL, &&label_OP_OR,
+		&&label_OP_OR_BOOLF, &&label_OP_OR_FBOOL, &&label_OP_OR_BOOLBOOL, &&label_OP_BITAND,
+		&&label_OP_BITOR, &&label_OP_BREAK, &&label_OP_CONTINUE, &&label_OP_EQ_F_IF,
+		&&label_OP_EQ_F_IFNOT, &&label_OP_NE_F_IF, &&label_OP_NE_F_IFNOT, &&label_OP_LT_IF,
+		&&label_OP_LT_IFNOT, &&label_OP_LE_IF, &&label_OP_LE_IFNOT, &&label_OP_GT_IF,
+		&&label_OP_GT_IFNOT, &&label_OP_GE_IF, &&label_OP_GE_IFNOT, &&label_OP_ADDRESS_STOREP_INT,
+		&&label_OP_ADDRESS_STOREP_V
+	};
+#endif
+
 	PROFILE_SCOPE("Scripting", PROFMASK_NORMAL);		// HUMANHEAD pdm
 
 	if ( threadDying || !currentFunction ) {
 		return true;
 	}
 
+	profiling = scriptProfiler.IsActive();
+	if ( profiling ) {
+		scriptProfiler.BeginExecute( this, instructionPointer == currentFunction->firstStatement - 1 );
+	}
+
 	if ( multiFrameEvent ) {
 		// move to previous instruction and call it again
 		instructionPointer--;
@@ -1050,50 +1193,38 @@ bool idInterpreter::Execute( void ) {
 
 	runaway = 5000000;
 
+	instructions = gameLocal.program.GetInstructions();
+	checkStatements = ( gameLocal.editors & EDITOR_DEBUGGER ) || g_debugScript.GetBool() || !g_scriptSuperInstructions.GetBool();
+
 	doneProcessing = false;
 	while( !doneProcessing && !threadDying ) {
-		instructionPointer++;
-
-		if ( !--runaway ) {
-			Error( "runaway loop error" );
-		}
-
 		// next statement
-		st = &gameLocal.program.GetStatement( instructionPointer );
-
-		if ( gameLocal.editors & EDITOR_DEBUGGER ) {
-			common->DebuggerCheckBreakpoint ( this, &gameLocal.program, instructionPointer );
-		} else if ( g_debugScript.GetBool ( ) ) {
-			static int lastLineNumber = -1;
-			if ( lastLineNumber != gameLocal.program.GetStatement ( instructionPointer ).linenumber ) {				
-				gameLocal.Printf ( "%s (%d)\n", 
-					gameLocal.program.GetFilename ( gameLocal.program.GetStatement ( instructionPointer ).file ),
-					gameLocal.program.GetStatement ( instructionPointer ).linenumber
-					);
-				lastLineNumber = gameLocal.program.GetStatement ( instructionPointer ).linenumber;
-			}
-		}
+		SCRIPT_FETCH();
+
+#ifdef SCRIPT_COMPUTED_GOTO
+		goto *dispatchTable[ op ];
+#endif
 
-		switch( st->op ) {
-		case OP_RETURN:
+		switch( op ) {
+		SCRIPT_OP( OP_RETURN ):
 			LeaveFunction( st->a );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_THREAD:
-			newThread = new idThread( this, st->a->value.functionPtr, st->b->value.argSize );
+		SCRIPT_OP( OP_THREAD ):
+			newThread = new idThread( this, inst->operands[ 0 ].functionPtr, inst->operands[ 1 ].argSize );
 			newThread->Start();
 
 			// return the thread number to the script
 			gameLocal.program.ReturnFloat( newThread->GetThreadNum() );
-			PopParms( st->b->value.argSize );
-			break;
+			PopParms( inst->operands[ 1 ].argSize );
+			SCRIPT_NEXT;
 
-		case OP_OBJTHREAD:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_OBJTHREAD ):
+			var_a = GetOperand( inst, 0 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( obj ) {
-				func = obj->GetTypeDef()->GetFunction( st->b->value.virtualFunction );
-				assert( st->c->value.argSize == func->parmTotal );
+				func = obj->GetTypeDef()->GetFunction( inst->operands[ 1 ].virtualFunction );
+				assert( inst->operands[ 2 ].argSize == func->parmTotal );
 				newThread = new idThread( this, GetEntity( *var_a.entityNumberPtr ), func, func->parmTotal );
 				newThread->Start();
 
@@ -1103,57 +1234,57 @@ bool idInterpreter::Execute( void ) {
 				// return a null thread to the script
 				gameLocal.program.ReturnFloat( 0.0f );
 			}
-			PopParms( st->c->value.argSize );
-			break;
+			PopParms( inst->operands[ 2 ].argSize );
+			SCRIPT_NEXT;
 
-		case OP_CALL:
-			EnterFunction( st->a->value.functionPtr, false );
-			break;
+		SCRIPT_OP( OP_CALL ):
+			EnterFunction( inst->operands[ 0 ].functionPtr, false );
+			SCRIPT_NEXT;
 
-		case OP_EVENTCALL:
-			CallEvent( st->a->value.functionPtr, st->b->value.argSize );
-			break;
+		SCRIPT_OP( OP_EVENTCALL ):
+			CallEvent( inst->operands[ 0 ].functionPtr, inst->operands[ 1 ].argSize );
+			SCRIPT_NEXT;
 
-		case OP_OBJECTCALL:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_OBJECTCALL ):
+			var_a = GetOperand( inst, 0 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( obj ) {
-				func = obj->GetTypeDef()->GetFunction( st->b->value.virtualFunction );
+				func = obj->GetTypeDef()->GetFunction( inst->operands[ 1 ].virtualFunction );
 				EnterFunction( func, false );
 			} else {
 				// return a 'safe' value
 				gameLocal.program.ReturnVector( vec3_zero );
 				gameLocal.program.ReturnString( "" );
-				PopParms( st->c->value.argSize );
+				PopParms( inst->operands[ 2 ].argSize );
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_SYSCALL:
-			CallSysEvent( st->a->value.functionPtr, st->b->value.argSize );
-			break;
+		SCRIPT_OP( OP_SYSCALL ):
+			CallSysEvent( inst->operands[ 0 ].functionPtr, inst->operands[ 1 ].argSize );
+			SCRIPT_NEXT;
 
-		case OP_IFNOT:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_IFNOT ):
+			var_a = GetOperand( inst, 0 );
 			if ( *var_a.intPtr == 0 ) {
-				NextInstruction( instructionPointer + st->b->value.jumpOffset );
+				NextInstruction( instructionPointer + inst->operands[ 1 ].jumpOffset );
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_IF:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_IF ):
+			var_a = GetOperand( inst, 0 );
 			if ( *var_a.intPtr != 0 ) {
-				NextInstruction( instructionPointer + st->b->value.jumpOffset );
+				NextInstruction( instructionPointer + inst->operands[ 1 ].jumpOffset );
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_GOTO:
-			NextInstruction( instructionPointer + st->a->value.jumpOffset );
-			break;
+		SCRIPT_OP( OP_GOTO ):
+			NextInstruction( instructionPointer + inst->operands[ 0 ].jumpOffset );
+			SCRIPT_NEXT;
 
-		case OP_ADD_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_ADD_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = *var_a.floatPtr + *var_b.floatPtr;
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1162,12 +1293,12 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_c.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_ADD_V:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_ADD_V ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.vectorPtr = *var_a.vectorPtr + *var_b.vectorPtr;
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1182,41 +1313,41 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(var_c.vectorPtr->z));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_ADD_S:
+		SCRIPT_OP( OP_ADD_S ):
 			SetString( st->c, GetString( st->a ) );
 			AppendString( st->c, GetString( st->b ) );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_ADD_FS:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_ADD_FS ):
+			var_a = GetOperand( inst, 0 );
 			SetString( st->c, FloatToString( *var_a.floatPtr ) );
 			AppendString( st->c, GetString( st->b ) );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_ADD_SF:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_ADD_SF ):
+			var_b = GetOperand( inst, 1 );
 			SetString( st->c, GetString( st->a ) );
 			AppendString( st->c, FloatToString( *var_b.floatPtr ) );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_ADD_VS:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_ADD_VS ):
+			var_a = GetOperand( inst, 0 );
 			SetString( st->c, var_a.vectorPtr->ToString() );
 			AppendString( st->c, GetString( st->b ) );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_ADD_SV:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_ADD_SV ):
+			var_b = GetOperand( inst, 1 );
 			SetString( st->c, GetString( st->a ) );
 			AppendString( st->c, var_b.vectorPtr->ToString() );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_SUB_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_SUB_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = *var_a.floatPtr - *var_b.floatPtr;
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1225,12 +1356,12 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_c.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_SUB_V:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_SUB_V ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.vectorPtr = *var_a.vectorPtr - *var_b.vectorPtr;
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1245,12 +1376,12 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(var_c.vectorPtr->z));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_MUL_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_MUL_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = *var_a.floatPtr * *var_b.floatPtr;
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1259,12 +1390,12 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_c.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_MUL_V:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_MUL_V ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = *var_a.vectorPtr * *var_b.vectorPtr;
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1279,26 +1410,26 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(var_c.vectorPtr->z));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_MUL_FV:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_MUL_FV ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.vectorPtr = *var_a.floatPtr * *var_b.vectorPtr;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_MUL_VF:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_MUL_VF ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.vectorPtr = *var_a.vectorPtr * *var_b.floatPtr;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_DIV_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_DIV_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 
 			if ( *var_b.floatPtr == 0.0f ) {
 				Warning( "Divide by zero" );
@@ -1306,11 +1437,11 @@ bool idInterpreter::Execute( void ) {
 			} else {
 				*var_c.floatPtr = *var_a.floatPtr / *var_b.floatPtr;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_MOD_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_MOD_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			var_c = GetVariable ( st->c );
 
 			if ( *var_b.floatPtr == 0.0f ) {
@@ -1319,115 +1450,115 @@ bool idInterpreter::Execute( void ) {
 			} else {
 				*var_c.floatPtr = static_cast<int>( *var_a.floatPtr ) % static_cast<int>( *var_b.floatPtr );
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_BITAND:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_BITAND ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = static_cast<int>( *var_a.floatPtr ) & static_cast<int>( *var_b.floatPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_BITOR:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_BITOR ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = static_cast<int>( *var_a.floatPtr ) | static_cast<int>( *var_b.floatPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_GE:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_GE ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.floatPtr >= *var_b.floatPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_LE:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_LE ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.floatPtr <= *var_b.floatPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_GT:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_GT ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.floatPtr > *var_b.floatPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_LT:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_LT ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.floatPtr < *var_b.floatPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_AND:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_AND ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.floatPtr != 0.0f ) && ( *var_b.floatPtr != 0.0f );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_AND_BOOLF:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_AND_BOOLF ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.intPtr != 0 ) && ( *var_b.floatPtr != 0.0f );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_AND_FBOOL:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_AND_FBOOL ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.floatPtr != 0.0f ) && ( *var_b.intPtr != 0 );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_AND_BOOLBOOL:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_AND_BOOLBOOL ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.intPtr != 0 ) && ( *var_b.intPtr != 0 );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_OR:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_OR ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.floatPtr != 0.0f ) || ( *var_b.floatPtr != 0.0f );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_OR_BOOLF:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_OR_BOOLF ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.intPtr != 0 ) || ( *var_b.floatPtr != 0.0f );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_OR_FBOOL:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_OR_FBOOL ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.floatPtr != 0.0f ) || ( *var_b.intPtr != 0 );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_OR_BOOLBOOL:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_OR_BOOLBOOL ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.intPtr != 0 ) || ( *var_b.intPtr != 0 );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_NOT_BOOL:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_NOT_BOOL ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.intPtr == 0 );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_NOT_F:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_NOT_F ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.floatPtr == 0.0f );
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1435,28 +1566,28 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_c.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_NOT_V:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_NOT_V ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.vectorPtr == vec3_zero );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_NOT_S:
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_NOT_S ):
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( strlen( GetString( st->a ) ) == 0 );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_NOT_ENT:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_NOT_ENT ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( GetEntity( *var_a.entityNumberPtr ) == NULL );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_NEG_F:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_NEG_F ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = -*var_a.floatPtr;
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1464,83 +1595,83 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_c.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_NEG_V:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_NEG_V ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.vectorPtr = -*var_a.vectorPtr;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_INT_F:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_INT_F ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = static_cast<int>( *var_a.floatPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_EQ_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_EQ_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.floatPtr == *var_b.floatPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_EQ_V:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_EQ_V ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.vectorPtr == *var_b.vectorPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_EQ_S:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_EQ_S ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( idStr::Cmp( GetString( st->a ), GetString( st->b ) ) == 0 );
-			break;
-
-		case OP_EQ_E:
-		case OP_EQ_EO:
-		case OP_EQ_OE:
-		case OP_EQ_OO:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+			SCRIPT_NEXT;
+
+		SCRIPT_OP( OP_EQ_E ):
+		SCRIPT_OP( OP_EQ_EO ):
+		SCRIPT_OP( OP_EQ_OE ):
+		SCRIPT_OP( OP_EQ_OO ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.entityNumberPtr == *var_b.entityNumberPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_NE_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_NE_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.floatPtr != *var_b.floatPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_NE_V:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_NE_V ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.vectorPtr != *var_b.vectorPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_NE_S:
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_NE_S ):
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( idStr::Cmp( GetString( st->a ), GetString( st->b ) ) != 0 );
-			break;
-
-		case OP_NE_E:
-		case OP_NE_EO:
-		case OP_NE_OE:
-		case OP_NE_OO:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
-			var_c = GetVariable( st->c );
+			SCRIPT_NEXT;
+
+		SCRIPT_OP( OP_NE_E ):
+		SCRIPT_OP( OP_NE_EO ):
+		SCRIPT_OP( OP_NE_OE ):
+		SCRIPT_OP( OP_NE_OO ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
 			*var_c.floatPtr = ( *var_a.entityNumberPtr != *var_b.entityNumberPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UADD_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_UADD_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.floatPtr += *var_a.floatPtr;
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1548,17 +1679,17 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_b.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UADD_V:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_UADD_V ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.vectorPtr += *var_a.vectorPtr;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_USUB_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_USUB_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.floatPtr -= *var_a.floatPtr;
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1566,17 +1697,17 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_b.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_USUB_V:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_USUB_V ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.vectorPtr -= *var_a.vectorPtr;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UMUL_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_UMUL_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.floatPtr *= *var_a.floatPtr;
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1584,17 +1715,17 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_b.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UMUL_V:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_UMUL_V ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.vectorPtr *= *var_a.floatPtr;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UDIV_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_UDIV_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 
 			if ( *var_a.floatPtr == 0.0f ) {
 				Warning( "Divide by zero" );
@@ -1609,11 +1740,11 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_b.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UDIV_V:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_UDIV_V ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 
 			if ( *var_a.floatPtr == 0.0f ) {
 				Warning( "Divide by zero" );
@@ -1621,11 +1752,11 @@ bool idInterpreter::Execute( void ) {
 			} else {
 				*var_b.vectorPtr = *var_b.vectorPtr / *var_a.floatPtr;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UMOD_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_UMOD_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 
 			if ( *var_a.floatPtr == 0.0f ) {
 				Warning( "Divide by zero" );
@@ -1640,11 +1771,11 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_b.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UOR_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_UOR_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.floatPtr = static_cast<int>( *var_b.floatPtr ) | static_cast<int>( *var_a.floatPtr );
 
 			//HUMANHEAD rww - float debugging
@@ -1653,11 +1784,11 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_b.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UAND_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_UAND_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.floatPtr = static_cast<int>( *var_b.floatPtr ) & static_cast<int>( *var_a.floatPtr );
 
 			//HUMANHEAD rww - float debugging
@@ -1666,10 +1797,10 @@ bool idInterpreter::Execute( void ) {
 			assert(!FLOAT_IS_INVALID(*var_b.floatPtr));
 #endif
 			//HUMANHEAD END
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UINC_F:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_UINC_F ):
+			var_a = GetOperand( inst, 0 );
 
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1678,13 +1809,13 @@ bool idInterpreter::Execute( void ) {
 			//HUMANHEAD END
 
 			( *var_a.floatPtr )++;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UINCP_F:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_UINCP_F ):
+			var_a = GetOperand( inst, 0 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( obj ) {
-				var.bytePtr = &obj->data[ st->b->value.ptrOffset ];
+				var.bytePtr = &obj->data[ inst->operands[ 1 ].ptrOffset ];
 
 				//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1694,23 +1825,23 @@ bool idInterpreter::Execute( void ) {
 
 				( *var.floatPtr )++;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UDEC_F:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_UDEC_F ):
+			var_a = GetOperand( inst, 0 );
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
 			assert(!FLOAT_IS_INVALID(*var_a.floatPtr));
 #endif
 			//HUMANHEAD END
 			( *var_a.floatPtr )--;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_UDECP_F:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_UDECP_F ):
+			var_a = GetOperand( inst, 0 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( obj ) {
-				var.bytePtr = &obj->data[ st->b->value.ptrOffset ];
+				var.bytePtr = &obj->data[ inst->operands[ 1 ].ptrOffset ];
 				//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
 				assert(!FLOAT_IS_INVALID(*var.floatPtr));
@@ -1718,11 +1849,11 @@ bool idInterpreter::Execute( void ) {
 				//HUMANHEAD END
 				( *var.floatPtr )--;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_COMP_F:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_COMP_F ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
 			assert(!FLOAT_IS_INVALID(*var_a.floatPtr));
@@ -1730,11 +1861,11 @@ bool idInterpreter::Execute( void ) {
 #endif
 			//HUMANHEAD END
 			*var_c.floatPtr = ~static_cast<int>( *var_a.floatPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_F:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STORE_F ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
 			assert(!FLOAT_IS_INVALID(*var_a.floatPtr));
@@ -1742,23 +1873,23 @@ bool idInterpreter::Execute( void ) {
 #endif
 			//HUMANHEAD END
 			*var_b.floatPtr = *var_a.floatPtr;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_ENT:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STORE_ENT ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.entityNumberPtr = *var_a.entityNumberPtr;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_BOOL:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STORE_BOOL ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.intPtr = *var_a.intPtr;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_OBJENT:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STORE_OBJENT ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( !obj ) {
 				*var_b.entityNumberPtr = 0;
@@ -1768,60 +1899,60 @@ bool idInterpreter::Execute( void ) {
 			} else {
 				*var_b.entityNumberPtr = *var_a.entityNumberPtr;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_OBJ:
-		case OP_STORE_ENTOBJ:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STORE_OBJ ):
+		SCRIPT_OP( OP_STORE_ENTOBJ ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.entityNumberPtr = *var_a.entityNumberPtr;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_S:
+		SCRIPT_OP( OP_STORE_S ):
 			SetString( st->b, GetString( st->a ) );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_V:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STORE_V ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.vectorPtr = *var_a.vectorPtr;
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_FTOS:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_STORE_FTOS ):
+			var_a = GetOperand( inst, 0 );
 			SetString( st->b, FloatToString( *var_a.floatPtr ) );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_BTOS:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_STORE_BTOS ):
+			var_a = GetOperand( inst, 0 );
 			SetString( st->b, *var_a.intPtr ? "true" : "false" );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_VTOS:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_STORE_VTOS ):
+			var_a = GetOperand( inst, 0 );
 			SetString( st->b, var_a.vectorPtr->ToString() );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_FTOBOOL:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STORE_FTOBOOL ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			if ( *var_a.floatPtr != 0.0f ) {
 				*var_b.intPtr = 1;
 			} else {
 				*var_b.intPtr = 0;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STORE_BOOLTOF:
-			var_a = GetVariable( st->a );
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STORE_BOOLTOF ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
 			*var_b.floatPtr = static_cast<float>( *var_a.intPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_F:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_F ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->floatPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 
 				//HUMANHEAD rww - float debugging
 #ifdef _ASSERT_ON_INTERPRETER_NANS
@@ -1831,107 +1962,107 @@ bool idInterpreter::Execute( void ) {
 
 				*var_b.evalPtr->floatPtr = *var_a.floatPtr;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_ENT:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_ENT ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->entityNumberPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 				*var_b.evalPtr->entityNumberPtr = *var_a.entityNumberPtr;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_FLD:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_FLD ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->intPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 				*var_b.evalPtr->intPtr = *var_a.intPtr;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_BOOL:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_BOOL ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->intPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 				*var_b.evalPtr->intPtr = *var_a.intPtr;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_S:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_S ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->stringPtr ) {
 				idStr::Copynz( var_b.evalPtr->stringPtr, GetString( st->a ), MAX_STRING_LEN );
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_V:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_V ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->vectorPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 				*var_b.evalPtr->vectorPtr = *var_a.vectorPtr;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_FTOS:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_FTOS ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->stringPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 				idStr::Copynz( var_b.evalPtr->stringPtr, FloatToString( *var_a.floatPtr ), MAX_STRING_LEN );
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_BTOS:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_BTOS ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->stringPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 				if ( *var_a.floatPtr != 0.0f ) {
 					idStr::Copynz( var_b.evalPtr->stringPtr, "true", MAX_STRING_LEN );
 				} else {
 					idStr::Copynz( var_b.evalPtr->stringPtr, "false", MAX_STRING_LEN );
 				}
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_VTOS:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_VTOS ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->stringPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 				idStr::Copynz( var_b.evalPtr->stringPtr, var_a.vectorPtr->ToString(), MAX_STRING_LEN );
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_FTOBOOL:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_FTOBOOL ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->intPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 				if ( *var_a.floatPtr != 0.0f ) {
 					*var_b.evalPtr->intPtr = 1;
 				} else {
 					*var_b.evalPtr->intPtr = 0;
 				}
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_BOOLTOF:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_BOOLTOF ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->floatPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 				*var_b.evalPtr->floatPtr = static_cast<float>( *var_a.intPtr );
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_OBJ:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_OBJ ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->entityNumberPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 				*var_b.evalPtr->entityNumberPtr = *var_a.entityNumberPtr;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_STOREP_OBJENT:
-			var_b = GetVariable( st->b );
+		SCRIPT_OP( OP_STOREP_OBJENT ):
+			var_b = GetOperand( inst, 1 );
 			if ( var_b.evalPtr && var_b.evalPtr->entityNumberPtr ) {
-				var_a = GetVariable( st->a );
+				var_a = GetOperand( inst, 0 );
 				obj = GetScriptObject( *var_a.entityNumberPtr );
 				if ( !obj ) {
 					*var_b.evalPtr->entityNumberPtr = 0;
@@ -1946,156 +2077,257 @@ bool idInterpreter::Execute( void ) {
 					*var_b.evalPtr->entityNumberPtr = *var_a.entityNumberPtr;
 				}
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_ADDRESS:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_ADDRESS ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( obj ) {
-				var_c.evalPtr->bytePtr = &obj->data[ st->b->value.ptrOffset ];
+				var_c.evalPtr->bytePtr = &obj->data[ inst->operands[ 1 ].ptrOffset ];
 			} else {
 				var_c.evalPtr->bytePtr = NULL;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_INDIRECT_F:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_INDIRECT_F ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( obj ) {
-				var.bytePtr = &obj->data[ st->b->value.ptrOffset ];
+				var.bytePtr = &obj->data[ inst->operands[ 1 ].ptrOffset ];
 				*var_c.floatPtr = *var.floatPtr;
 			} else {
 				*var_c.floatPtr = 0.0f;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_INDIRECT_ENT:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_INDIRECT_ENT ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( obj ) {
-				var.bytePtr = &obj->data[ st->b->value.ptrOffset ];
+				var.bytePtr = &obj->data[ inst->operands[ 1 ].ptrOffset ];
 				*var_c.entityNumberPtr = *var.entityNumberPtr;
 			} else {
 				*var_c.entityNumberPtr = 0;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_INDIRECT_BOOL:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_INDIRECT_BOOL ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( obj ) {
-				var.bytePtr = &obj->data[ st->b->value.ptrOffset ];
+				var.bytePtr = &obj->data[ inst->operands[ 1 ].ptrOffset ];
 				*var_c.intPtr = *var.intPtr;
 			} else {
 				*var_c.intPtr = 0;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_INDIRECT_S:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_INDIRECT_S ):
+			var_a = GetOperand( inst, 0 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( obj ) {
-				var.bytePtr = &obj->data[ st->b->value.ptrOffset ];
+				var.bytePtr = &obj->data[ inst->operands[ 1 ].ptrOffset ];
 				SetString( st->c, var.stringPtr );
 			} else {
 				SetString( st->c, "" );
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_INDIRECT_V:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_INDIRECT_V ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( obj ) {
-				var.bytePtr = &obj->data[ st->b->value.ptrOffset ];
+				var.bytePtr = &obj->data[ inst->operands[ 1 ].ptrOffset ];
 				*var_c.vectorPtr = *var.vectorPtr;
 			} else {
 				var_c.vectorPtr->Zero();
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_INDIRECT_OBJ:
-			var_a = GetVariable( st->a );
-			var_c = GetVariable( st->c );
+		SCRIPT_OP( OP_INDIRECT_OBJ ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
 			obj = GetScriptObject( *var_a.entityNumberPtr );
 			if ( !obj ) {
 				*var_c.entityNumberPtr = 0;
 			} else {
-				var.bytePtr = &obj->data[ st->b->value.ptrOffset ];
+				var.bytePtr = &obj->data[ inst->operands[ 1 ].ptrOffset ];
 				*var_c.entityNumberPtr = *var.entityNumberPtr;
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_PUSH_F:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_PUSH_F ):
+			var_a = GetOperand( inst, 0 );
 			Push( *var_a.intPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_PUSH_FTOS:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_PUSH_FTOS ):
+			var_a = GetOperand( inst, 0 );
 			PushString( FloatToString( *var_a.floatPtr ) );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_PUSH_BTOF:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_PUSH_BTOF ):
+			var_a = GetOperand( inst, 0 );
 			floatVal = *var_a.intPtr;
 			Push( *reinterpret_cast<int *>( &floatVal ) );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_PUSH_FTOB:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_PUSH_FTOB ):
+			var_a = GetOperand( inst, 0 );
 			if ( *var_a.floatPtr != 0.0f ) {
 				Push( 1 );
 			} else {
 				Push( 0 );
 			}
-			break;
+			SCRIPT_NEXT;
 
-		case OP_PUSH_VTOS:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_PUSH_VTOS ):
+			var_a = GetOperand( inst, 0 );
 			PushString( var_a.vectorPtr->ToString() );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_PUSH_BTOS:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_PUSH_BTOS ):
+			var_a = GetOperand( inst, 0 );
 			PushString( *var_a.intPtr ? "true" : "false" );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_PUSH_ENT:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_PUSH_ENT ):
+			var_a = GetOperand( inst, 0 );
 			Push( *var_a.entityNumberPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_PUSH_S:
+		SCRIPT_OP( OP_PUSH_S ):
 			PushString( GetString( st->a ) );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_PUSH_V:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_PUSH_V ):
+			var_a = GetOperand( inst, 0 );
 			PushVector(*var_a.vectorPtr);
-			break;
+			SCRIPT_NEXT;
 
-		case OP_PUSH_OBJ:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_PUSH_OBJ ):
+			var_a = GetOperand( inst, 0 );
 			Push( *var_a.entityNumberPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_PUSH_OBJENT:
-			var_a = GetVariable( st->a );
+		SCRIPT_OP( OP_PUSH_OBJENT ):
+			var_a = GetOperand( inst, 0 );
 			Push( *var_a.entityNumberPtr );
-			break;
+			SCRIPT_NEXT;
 
-		case OP_BREAK:
-		case OP_CONTINUE:
+		SCRIPT_OP( OP_EQ_F_IF ):
+		SCRIPT_OP( OP_EQ_F_IFNOT ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
+			*var_c.floatPtr = ( *var_a.floatPtr == *var_b.floatPtr );
+			SCRIPT_BRANCH( op == OP_EQ_F_IF );
+			SCRIPT_NEXT;
+
+		SCRIPT_OP( OP_NE_F_IF ):
+		SCRIPT_OP( OP_NE_F_IFNOT ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
+			*var_c.floatPtr = ( *var_a.floatPtr != *var_b.floatPtr );
+			SCRIPT_BRANCH( op == OP_NE_F_IF );
+			SCRIPT_NEXT;
+
+		SCRIPT_OP( OP_LT_IF ):
+		SCRIPT_OP( OP_LT_IFNOT ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
+			*var_c.floatPtr = ( *var_a.floatPtr < *var_b.floatPtr );
+			SCRIPT_BRANCH( op == OP_LT_IF );
+			SCRIPT_NEXT;
+
+		SCRIPT_OP( OP_LE_IF ):
+		SCRIPT_OP( OP_LE_IFNOT ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
+			*var_c.floatPtr = ( *var_a.floatPtr <= *var_b.floatPtr );
+			SCRIPT_BRANCH( op == OP_LE_IF );
+			SCRIPT_NEXT;
+
+		SCRIPT_OP( OP_GT_IF ):
+		SCRIPT_OP( OP_GT_IFNOT ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
+			*var_c.floatPtr = ( *var_a.floatPtr > *var_b.floatPtr );
+			SCRIPT_BRANCH( op == OP_GT_IF );
+			SCRIPT_NEXT;
+
+		SCRIPT_OP( OP_GE_IF ):
+		SCRIPT_OP( OP_GE_IFNOT ):
+			var_a = GetOperand( inst, 0 );
+			var_b = GetOperand( inst, 1 );
+			var_c = GetOperand( inst, 2 );
+			*var_c.floatPtr = ( *var_a.floatPtr >= *var_b.floatPtr );
+			SCRIPT_BRANCH( op == OP_GE_IF );
+			SCRIPT_NEXT;
+
+		SCRIPT_OP( OP_ADDRESS_STOREP_INT ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
+			obj = GetScriptObject( *var_a.entityNumberPtr );
+			if ( obj ) {
+				var_c.evalPtr->bytePtr = &obj->data[ inst->operands[ 1 ].ptrOffset ];
+			} else {
+				var_c.evalPtr->bytePtr = NULL;
+			}
+			SCRIPT_SKIP();
+			if ( var_c.evalPtr->intPtr ) {
+				var_a = GetOperand( inst, 0 );
+				*var_c.evalPtr->intPtr = *var_a.intPtr;
+			}
+			SCRIPT_NEXT;
+
+		SCRIPT_OP( OP_ADDRESS_STOREP_V ):
+			var_a = GetOperand( inst, 0 );
+			var_c = GetOperand( inst, 2 );
+			obj = GetScriptObject( *var_a.entityNumberPtr );
+			if ( obj ) {
+				var_c.evalPtr->bytePtr = &obj->data[ inst->operands[ 1 ].ptrOffset ];
+			} else {
+				var_c.evalPtr->bytePtr = NULL;
+			}
+			SCRIPT_SKIP();
+			if ( var_c.evalPtr->vectorPtr ) {
+				var_a = GetOperand( inst, 0 );
+				*var_c.evalPtr->vectorPtr = *var_a.vectorPtr;
+			}
+			SCRIPT_NEXT;
+
+		SCRIPT_OP( OP_BREAK ):
+		SCRIPT_OP( OP_CONTINUE ):
 		default:
 			Error( "Bad opcode %i", st->op );
-			break;
+			SCRIPT_NEXT;
 		}
 	}
 
+#ifdef SCRIPT_COMPUTED_GOTO
+done:
+#endif
+	statementCount += 5000000 - runaway;
+
+	if ( profiling ) {
+		scriptProfiler.EndExecute( this );
+	}
+
 	return threadDying;
-}
\ No newline at end of file
+}
+
+#undef SCRIPT_FETCH
+#undef SCRIPT_SKIP
+#undef SCRIPT_BRANCH
+#undef SCRIPT_OP
+#undef SCRIPT_NEXT
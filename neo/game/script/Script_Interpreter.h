@@ -71,6 +71,7 @@ private:
 	void				SetString( idVarDef *def, const char *from );
 	const char			*GetString( idVarDef *def );
 	varEval_t			GetVariable( idVarDef *def );
+	varEval_t			GetOperand( const scriptInstruction_t *inst, int operand );
 	idEntity			*GetEntity( int entnum ) const;
 	idScriptObject		*GetScriptObject( int entnum ) const;
 	void				NextInstruction( int position );
@@ -78,12 +79,14 @@ private:
 	void				LeaveFunction( idVarDef *returnDef );
 	void				CallEvent( const function_t *func, int argsize );
 	void				CallSysEvent( const function_t *func, int argsize );
+	void				DebugStatement( void );
 
 public:
 	bool				doneProcessing;
 	bool				threadDying;
 	bool				terminateOnExit;
 	bool				debug;
+	int					statementCount;		// number of statements executed
 
 						idInterpreter();
 
@@ -267,6 +270,21 @@ ID_INLINE varEval_t idInterpreter::GetVariable( idVarDef *def ) {
 	}
 }
 
+/*
+====================
+idInterpreter::GetOperand
+====================
+*/
+ID_INLINE varEval_t idInterpreter::GetOperand( const scriptInstruction_t *inst, int operand ) {
+	if ( inst->stackOperands & ( 1 << operand ) ) {
+		varEval_t val;
+		val.intPtr = ( int * )&localstack[ localstackBase + inst->operands[ operand ].stackOffset ];
+		return val;
+	} else {
+		return inst->operands[ operand ];
+	}
+}
+
 /*
 ================
 idInterpreter::GetEntity
@@ -0,0 +1,588 @@
+/*
+===========================================================================
+
+Doom 3 GPL Source Code
+Copyright (C) 1999-2011 id Software LLC, a ZeniMax Media company.
+
+This file is part of the Doom 3 GPL Source Code ("Doom 3 Source Code").
+
+Doom 3 Source Code is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Doom 3 Source Code is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Doom 3 Source Code.  If not, see <http://www.gnu.org/licenses/>.
+
+In addition, the Doom 3 Source Code is also subject to certain additional terms. You should have received a copy of these additional terms immediately following the terms and conditions of the GNU General Public License which accompanied the Doom 3 Source Code.  If not, please request a copy in writing from id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+
+===========================================================================
+*/
+
+
+#include "precompiled.h"
+#pragma hdrstop
+
+#include "../Game_local.h"
+
+idScriptProfiler	scriptProfiler;
+
+/*
+================
+idScriptProfiler::idScriptProfiler
+================
+*/
+idScriptProfiler::idScriptProfiler( void ) {
+	active = false;
+	startFrame = 0;
+	numFrames = 0;
+	current = 0;
+	lastTicks = 0.0;
+}
+
+/*
+================
+idScriptProfiler::Start
+================
+*/
+void idScriptProfiler::Start( void ) {
+	if ( active ) {
+		return;
+	}
+	if ( !nodes.Num() ) {
+		Clear();
+	}
+	active = true;
+	startFrame = gameLocal.framenum;
+	contexts.SetNum( 0, false );
+	current = 0;
+}
+
+/*
+================
+idScriptProfiler::Stop
+================
+*/
+void idScriptProfiler::Stop( void ) {
+	if ( !active ) {
+		return;
+	}
+	active = false;
+	numFrames += gameLocal.framenum - startFrame;
+	contexts.SetNum( 0, false );
+	current = 0;
+}
+
+/*
+================
+idScriptProfiler::Clear
+================
+*/
+void idScriptProfiler::Clear( void ) {
+	profileNode_t root;
+
+	nodes.Clear();
+	nodeHash.Clear();
+	contexts.Clear();
+
+	root.key = NULL;
+	root.parent = -1;
+	root.event = false;
+	root.calls = 0;
+	root.exclusive = 0.0;
+	nodes.Append( root );
+
+	current = 0;
+	numFrames = 0;
+	startFrame = gameLocal.framenum;
+}
+
+/*
+================
+idScriptProfiler::FreeFunctions
+
+The nodes are kept for the report but are no longer found by their function or event.
+================
+*/
+void idScriptProfiler::FreeFunctions( void ) {
+	for ( int i = 0; i < nodes.Num(); i++ ) {
+		nodes[i].key = NULL;
+	}
+	nodeHash.Clear();
+	contexts.SetNum( 0, false );
+	current = 0;
+}
+
+/*
+================
+idScriptProfiler::Charge
+================
+*/
+void idScriptProfiler::Charge( void ) {
+	double ticks = idLib::sys->GetClockTicks();
+
+	nodes[current].exclusive += ticks - lastTicks;
+	lastTicks = ticks;
+}
+
+/*
+================
+idScriptProfiler::FindNode
+================
+*/
+int idScriptProfiler::FindNode( int parent, const void *key, const char *name, bool event ) {
+	int hash, i;
+
+	hash = nodeHash.GenerateKey( (int)(intptr_t)key, parent );
+	for ( i = nodeHash.First( hash ); i != -1; i = nodeHash.Next( i ) ) {
+		if ( nodes[i].key == key && nodes[i].parent == parent ) {
+			return i;
+		}
+	}
+
+	i = nodes.Num();
+	profileNode_t &node = nodes.Alloc();
+	node.key = key;
+	node.parent = parent;
+	node.event = event;
+	node.name = name;
+	node.calls = 0;
+	node.exclusive = 0.0;
+	nodeHash.Add( hash, i );
+
+	return i;
+}
+
+/*
+================
+idScriptProfiler::FunctionNode
+
+Returns the node of the current function of the interpreter below the base node.
+================
+*/
+int idScriptProfiler::FunctionNode( const idInterpreter *interpreter, int base ) {
+	const prstack_t *	callStack;
+	const function_t *	func;
+	int					i, node;
+
+	func = interpreter->GetCurrentFunction();
+	if ( !func ) {
+		return base;
+	}
+
+	// the first entry holds the function the interpreter was reset with
+	callStack = interpreter->GetCallstack();
+	node = base;
+	for ( i = 1; i < interpreter->GetCallstackDepth(); i++ ) {
+		node = FindNode( node, callStack[i].f, callStack[i].f->Name(), false );
+	}
+	return FindNode( node, func, func->Name(), false );
+}
+
+/*
+================
+idScriptProfiler::BeginExecute
+================
+*/
+void idScriptProfiler::BeginExecute( const idInterpreter *interpreter, bool entered ) {
+	profileContext_t context;
+
+	if ( !contexts.Num() ) {
+		lastTicks = idLib::sys->GetClockTicks();
+		current = 0;
+	} else {
+		Charge();
+	}
+
+	context.interpreter = interpreter;
+	context.node = current;
+	contexts.Append( context );
+
+	current = FunctionNode( interpreter, current );
+	if ( entered ) {
+		nodes[current].calls++;
+	}
+}
+
+/*
+================
+idScriptProfiler::EndExecute
+================
+*/
+void idScriptProfiler::EndExecute( const idInterpreter *interpreter ) {
+	if ( !contexts.Num() || contexts[contexts.Num() - 1].interpreter != interpreter ) {
+		return;
+	}
+
+	Charge();
+	current = contexts[contexts.Num() - 1].node;
+	contexts.SetNum( contexts.Num() - 1, false );
+}
+
+/*
+================
+idScriptProfiler::EnterFunction
+================
+*/
+void idScriptProfiler::EnterFunction( const idInterpreter *interpreter, const function_t *func ) {
+	if ( !contexts.Num() || contexts[contexts.Num() - 1].interpreter != interpreter ) {
+		return;
+	}
+
+	Charge();
+	current = FindNode( current, func, func->Name(), false );
+	nodes[current].calls++;
+}
+
+/*
+================
+idScriptProfiler::LeaveFunction
+================
+*/
+void idScriptProfiler::LeaveFunction( const idInterpreter *interpreter ) {
+	const profileContext_t *context;
+
+	if ( !contexts.Num() || contexts[contexts.Num() - 1].interpreter != interpreter ) {
+		return;
+	}
+
+	context = &contexts[contexts.Num() - 1];
+	Charge();
+	if ( current != context->node ) {
+		current = nodes[current].parent;
+	}
+}
+
+/*
+================
+idScriptProfiler::BeginEvent
+
+Returns the node of the event which has to be passed to EndEvent.
+================
+*/
+int idScriptProfiler::BeginEvent( const idEventDef *evdef, bool sysEvent ) {
+	if ( !contexts.Num() ) {
+		return -1;
+	}
+
+	Charge();
+	current = FindNode( current, evdef, sysEvent ? va( "sys.%s", evdef->GetName() ) : evdef->GetName(), true );
+	nodes[current].calls++;
+
+	return current;
+}
+
+/*
+================
+idScriptProfiler::EndEvent
+================
+*/
+void idScriptProfiler::EndEvent( const idInterpreter *interpreter, int node ) {
+	const profileContext_t *context;
+
+	if ( node < 0 || !contexts.Num() || contexts[contexts.Num() - 1].interpreter != interpreter ) {
+		return;
+	}
+
+	Charge();
+	current = nodes[node].parent;
+
+	// the event may have entered a function on the interpreter or killed the thread
+	if ( nodes[current].key != interpreter->GetCurrentFunction() ) {
+		context = &contexts[contexts.Num() - 1];
+		current = FunctionNode( interpreter, context->node );
+	}
+}
+
+/*
+================
+idScriptProfiler::ProfiledFrames
+================
+*/
+int idScriptProfiler::ProfiledFrames( void ) const {
+	int frames = numFrames;
+
+	if ( active ) {
+		frames += gameLocal.framenum - startFrame;
+	}
+	return Max( frames, 1 );
+}
+
+/*
+================
+idScriptProfiler::GetInclusive
+
+Children are always added after their parent so the times can be summed up in reverse order.
+================
+*/
+void idScriptProfiler::GetInclusive( idList<double> &inclusive ) const {
+	int i;
+
+	inclusive.SetNum( nodes.Num() );
+	for ( i = 0; i < nodes.Num(); i++ ) {
+		inclusive[i] = nodes[i].exclusive;
+	}
+	for ( i = nodes.Num() - 1; i > 0; i-- ) {
+		inclusive[nodes[i].parent] += inclusive[i];
+	}
+}
+
+/*
+================
+AddProfileTotal
+================
+*/
+template< class type >
+static type &AddProfileTotal( idList<type> &totals, idHashIndex &hash, const char *name ) {
+	int key, i;
+
+	key = hash.GenerateKey( name );
+	for ( i = hash.First( key ); i != -1; i = hash.Next( i ) ) {
+		if ( !idStr::Cmp( totals[i].name, name ) ) {
+			return totals[i];
+		}
+	}
+
+	hash.Add( key, totals.Num() );
+	type &total = totals.Alloc();
+	total.name = name;
+	total.calls = 0;
+	total.inclusive = 0.0;
+	total.exclusive = 0.0;
+	return total;
+}
+
+/*
+================
+idScriptProfiler::GetTotals
+
+Adds up the nodes per name. The inclusive time of recursive calls is only counted for the outermost call.
+================
+*/
+void idScriptProfiler::GetTotals( bool events, idList<profileTotal_t> &totals ) const {
+	idList<double>	inclusive;
+	idHashIndex		hash;
+	int				i, p;
+
+	GetInclusive( inclusive );
+
+	totals.Clear();
+	for ( i = 1; i < nodes.Num(); i++ ) {
+		const profileNode_t &node = nodes[i];
+		if ( node.event != events ) {
+			continue;
+		}
+
+		profileTotal_t &total = AddProfileTotal( totals, hash, node.name );
+		total.calls += node.calls;
+		total.exclusive += node.exclusive;
+
+		for ( p = node.parent; p > 0; p = nodes[p].parent ) {
+			if ( nodes[p].event == node.event && nodes[p].name == node.name ) {
+				break;
+			}
+		}
+		if ( p <= 0 ) {
+			total.inclusive += inclusive[i];
+		}
+	}
+}
+
+/*
+================
+idScriptProfiler::SortByExclusive
+================
+*/
+int idScriptProfiler::SortByExclusive( const profileTotal_t *a, const profileTotal_t *b ) {
+	if ( a->exclusive > b->exclusive ) {
+		return -1;
+	} else if ( a->exclusive < b->exclusive ) {
+		return 1;
+	}
+	return idStr::Cmp( a->name, b->name );
+}
+
+/*
+================
+idScriptProfiler::SortByInclusive
+================
+*/
+int idScriptProfiler::SortByInclusive( const profileTotal_t *a, const profileTotal_t *b ) {
+	if ( a->inclusive > b->inclusive ) {
+		return -1;
+	} else if ( a->inclusive < b->inclusive ) {
+		return 1;
+	}
+	return idStr::Cmp( a->name, b->name );
+}
+
+/*
+================
+idScriptProfiler::PrintTotals
+================
+*/
+void idScriptProfiler::PrintTotals( const char *title, idList<profileTotal_t> &totals, int count, bool inclusive ) const {
+	double	msPerTick, total;
+	int		i, frames;
+
+	msPerTick = 1000.0 / idLib::sys->ClockTicksPerSecond();
+	frames = ProfiledFrames();
+
+	total = 0.0;
+	for ( i = 0; i < nodes.Num(); i++ ) {
+		total += nodes[i].exclusive;
+	}
+
+	totals.Sort( inclusive ? SortByInclusive : SortByExclusive );
+	if ( count <= 0 || count > totals.Num() ) {
+		count = totals.Num();
+	}
+
+	gameLocal.Printf( "%s over %d frames, %1.3f ms script time per frame\n", title, frames, total * msPerTick / frames );
+	gameLocal.Printf( "     calls   incl ms   excl ms  incl/frame  excl/frame  name\n" );
+	gameLocal.Printf( "----------------------------------------------------------------------\n" );
+	for ( i = 0; i < count; i++ ) {
+		const profileTotal_t &t = totals[i];
+		gameLocal.Printf( "%10d %9.2f %9.2f %11.3f %11.3f  %s\n", t.calls, t.inclusive * msPerTick, t.exclusive * msPerTick,
+							t.inclusive * msPerTick / frames, t.exclusive * msPerTick / frames, t.name );
+	}
+	gameLocal.Printf( "%d of %d shown\n", count, totals.Num() );
+}
+
+/*
+================
+idScriptProfiler::PrintFunctions
+================
+*/
+void idScriptProfiler::PrintFunctions( int count, bool inclusive ) const {
+	idList<profileTotal_t> totals;
+
+	GetTotals( false, totals );
+	PrintTotals( "Script functions", totals, count, inclusive );
+}
+
+/*
+================
+idScriptProfiler::PrintEvents
+================
+*/
+void idScriptProfiler::PrintEvents( int count, bool inclusive ) const {
+	idList<profileTotal_t> totals;
+
+	GetTotals( true, totals );
+	PrintTotals( "Script events", totals, count, inclusive );
+}
+
+/*
+================
+idScriptProfiler::PrintCallGraph
+
+Prints the callers and the callees of a function or event.
+================
+*/
+void idScriptProfiler::PrintCallGraph( const char *name ) const {
+	idList<double>			inclusive;
+	idList<profileTotal_t>	callers;
+	idList<profileTotal_t>	callees;
+	idHashIndex				callerHash;
+	idHashIndex				calleeHash;
+	double					msPerTick;
+	int						i, calls;
+
+	GetInclusive( inclusive );
+
+	calls = 0;
+	for ( i = 1; i < nodes.Num(); i++ ) {
+		const profileNode_t &node = nodes[i];
+		if ( node.name == name ) {
+			calls += node.calls;
+			profileTotal_t &caller = AddProfileTotal( callers, callerHash, node.parent > 0 ? nodes[node.parent].name.c_str() : "<thread>" );
+			caller.calls += node.calls;
+			caller.inclusive += inclusive[i];
+			caller.exclusive += node.exclusive;
+		}
+		if ( node.parent > 0 && nodes[node.parent].name == name ) {
+			profileTotal_t &callee = AddProfileTotal( callees, calleeHash, node.name );
+			callee.calls += node.calls;
+			callee.inclusive += inclusive[i];
+			callee.exclusive += node.exclusive;
+		}
+	}
+
+	if ( !callers.Num() ) {
+		gameLocal.Printf( "'%s' has not been profiled\n", name );
+		return;
+	}
+
+	msPerTick = 1000.0 / idLib::sys->ClockTicksPerSecond();
+
+	callers.Sort( SortByInclusive );
+	callees.Sort( SortByInclusive );
+
+	gameLocal.Printf( "%s: %d calls\n", name, calls );
+	gameLocal.Printf( "called from:\n" );
+	for ( i = 0; i < callers.Num(); i++ ) {
+		gameLocal.Printf( "%10d %9.2f ms  %s\n", callers[i].calls, callers[i].inclusive * msPerTick, callers[i].name );
+	}
+	gameLocal.Printf( "calls:\n" );
+	for ( i = 0; i < callees.Num(); i++ ) {
+		gameLocal.Printf( "%10d %9.2f ms  %s\n", callees[i].calls, callees[i].inclusive * msPerTick, callees[i].name );
+	}
+}
+
+/*
+================
+idScriptProfiler::GetPath
+================
+*/
+void idScriptProfiler::GetPath( int node, idStr &path ) const {
+	if ( nodes[node].parent > 0 ) {
+		GetPath( nodes[node].parent, path );
+		path += ";";
+	}
+	path += nodes[node].name;
+}
+
+/*
+================
+idScriptProfiler::WriteCollapsedStacks
+
+Writes one line per call path with its exclusive time in microseconds, as read by flamegraph.pl.
+================
+*/
+void idScriptProfiler::WriteCollapsedStacks( const char *filename ) const {
+	idFile *	f;
+	idStr		path;
+	double		usPerTick;
+	int			i, lines;
+
+	f = fileSystem->OpenFileWrite( filename );
+	if ( !f ) {
+		gameLocal.Warning( "couldn't open %s", filename );
+		return;
+	}
+
+	usPerTick = 1000000.0 / idLib::sys->ClockTicksPerSecond();
+
+	lines = 0;
+	for ( i = 1; i < nodes.Num(); i++ ) {
+		if ( nodes[i].exclusive * usPerTick < 1.0 ) {
+			continue;
+		}
+		path.Clear();
+		GetPath( i, path );
+		f->Printf( "%s %1.0f\n", path.c_str(), nodes[i].exclusive * usPerTick );
+		lines++;
+	}
+
+	fileSystem->CloseFile( f );
+
+	gameLocal.Printf( "wrote %d call paths to %s\n", lines, filename );
+}
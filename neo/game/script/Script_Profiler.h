@@ -0,0 +1,121 @@
+/*
+===========================================================================
+
+Doom 3 GPL Source Code
+Copyright (C) 1999-2011 id Software LLC, a ZeniMax Media company.
+
+This file is part of the Doom 3 GPL Source Code ("Doom 3 Source Code").
+
+Doom 3 Source Code is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Doom 3 Source Code is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Doom 3 Source Code.  If not, see <http://www.gnu.org/licenses/>.
+
+In addition, the Doom 3 Source Code is also subject to certain additional terms. You should have received a copy of these additional terms immediately following the terms and conditions of the GNU General Public License which accompanied the Doom 3 Source Code.  If not, please request a copy in writing from id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+
+===========================================================================
+*/
+
+
+#ifndef __SCRIPT_PROFILER_H__
+#define __SCRIPT_PROFILER_H__
+
+/*
+===============================================================================
+
+	Script profiler.
+
+	While active, the time spent executing script is charged to a call tree
+	built from the call stacks of the interpreters. Every node of the tree is
+	a script function or an event called from script. Script threads started
+	from an event, for instance through a trigger, are added below the event.
+
+	The tables add the nodes up per function or event name. Exclusive time
+	is the time spent in the function itself, inclusive time also contains
+	the functions and events it called. The call tree can also be written
+	as collapsed stacks for flame graph tools.
+
+===============================================================================
+*/
+
+class idScriptProfiler {
+public:
+							idScriptProfiler( void );
+
+	bool					IsActive( void ) const { return active; }
+	void					Start( void );
+	void					Stop( void );
+	void					Clear( void );
+							// the function pointers are about to be freed
+	void					FreeFunctions( void );
+
+							// called by the interpreter while the profiler is active
+	void					BeginExecute( const idInterpreter *interpreter, bool entered );
+	void					EndExecute( const idInterpreter *interpreter );
+	void					EnterFunction( const idInterpreter *interpreter, const function_t *func );
+	void					LeaveFunction( const idInterpreter *interpreter );
+	int						BeginEvent( const idEventDef *evdef, bool sysEvent );
+	void					EndEvent( const idInterpreter *interpreter, int node );
+
+	void					PrintFunctions( int count, bool inclusive ) const;
+	void					PrintEvents( int count, bool inclusive ) const;
+	void					PrintCallGraph( const char *name ) const;
+	void					WriteCollapsedStacks( const char *filename ) const;
+
+private:
+	typedef struct profileNode_s {
+		const void *		key;				// function_t or idEventDef, NULL once freed
+		int					parent;
+		bool				event;
+		idStr				name;
+		int					calls;
+		double				exclusive;			// clock ticks
+	} profileNode_t;
+
+	typedef struct profileContext_s {
+		const idInterpreter *interpreter;
+		int					node;				// node the execution was started from
+	} profileContext_t;
+
+	typedef struct profileTotal_s {
+		const char *		name;
+		int					calls;
+		double				inclusive;
+		double				exclusive;
+	} profileTotal_t;
+
+	bool					active;
+	int						startFrame;
+	int						numFrames;			// game frames profiled before the last start
+	idList<profileNode_t>	nodes;
+	idHashIndex				nodeHash;
+	idList<profileContext_t> contexts;			// nested executions
+	int						current;			// node time is currently charged to
+	double					lastTicks;
+
+	void					Charge( void );
+	int						FindNode( int parent, const void *key, const char *name, bool event );
+	int						FunctionNode( const idInterpreter *interpreter, int base );
+	int						ProfiledFrames( void ) const;
+	void					GetInclusive( idList<double> &inclusive ) const;
+	void					GetTotals( bool events, idList<profileTotal_t> &totals ) const;
+	void					PrintTotals( const char *title, idList<profileTotal_t> &totals, int count, bool inclusive ) const;
+	void					GetPath( int node, idStr &path ) const;
+
+	static int				SortByExclusive( const profileTotal_t *a, const profileTotal_t *b );
+	static int				SortByInclusive( const profileTotal_t *a, const profileTotal_t *b );
+};
+
+extern idScriptProfiler		scriptProfiler;
+
+#endif /* !__SCRIPT_PROFILER_H__ */
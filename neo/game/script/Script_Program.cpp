@@ -76,6 +76,28 @@ idVarDef	def_jumpoffset( &type_jumpoffset );		// only used for jump opcodes
 idVarDef	def_argsize( &type_argsize );
 idVarDef	def_boolean( &type_boolean );
 
+// the simple types and defs are referenced from a program image with negative numbers
+static idTypeDef *imageTypes[] = {
+	&type_void, &type_scriptevent, &type_namespace, &type_string, &type_float, &type_vector, &type_entity, &type_field,
+	&type_function, &type_virtualfunction, &type_pointer, &type_object, &type_jumpoffset, &type_argsize, &type_boolean
+};
+
+static idVarDef *imageDefs[] = {
+	&def_void, &def_scriptevent, &def_namespace, &def_string, &def_float, &def_vector, &def_entity, &def_field,
+	&def_function, &def_virtualfunction, &def_pointer, &def_object, &def_jumpoffset, &def_argsize, &def_boolean
+};
+
+#define SCRIPT_IMAGE_ID				"PRGI"
+#define SCRIPT_IMAGE_VERSION		2
+
+// how the value of a var def is stored in a program image
+typedef enum {
+	IMAGE_VALUE_NULL,
+	IMAGE_VALUE_INT,
+	IMAGE_VALUE_GLOBAL,
+	IMAGE_VALUE_FUNCTION
+} imageValue_t;
+
 /***********************************************************************
 
   function_t
@@ -1344,7 +1366,7 @@ reserves memory for global variables and returns the starting pointer
 byte *idProgram::ReserveMem(int size) {
 	byte *res = &variables[ numVariables ];
 	numVariables += size;
-	if ( numVariables > sizeof( variables ) ) {
+	if ( numVariables > (int)sizeof( variables ) ) {
 		throw idCompileError( va( "Exceeded global memory size (%zd bytes)", sizeof( variables ) ) );
 	}
 
@@ -1749,6 +1771,106 @@ statement_t *idProgram::AllocStatement( void ) {
 	return ret;
 }
 
+/*
+================
+SuperInstruction
+
+Returns the superinstruction that executes both statements, or the op of the first statement.
+================
+*/
+static int SuperInstruction( const statement_t *statement, const statement_t *next ) {
+	int first;
+
+	switch( statement->op ) {
+		case OP_EQ_F:
+			first = OP_EQ_F_IF;
+			break;
+		case OP_NE_F:
+			first = OP_NE_F_IF;
+			break;
+		case OP_LT:
+			first = OP_LT_IF;
+			break;
+		case OP_LE:
+			first = OP_LE_IF;
+			break;
+		case OP_GT:
+			first = OP_GT_IF;
+			break;
+		case OP_GE:
+			first = OP_GE_IF;
+			break;
+		case OP_ADDRESS:
+			// storing to the field that was just addressed
+			if ( next->b != statement->c ) {
+				return statement->op;
+			}
+			switch( next->op ) {
+				case OP_STOREP_F:
+				case OP_STOREP_ENT:
+				case OP_STOREP_FLD:
+				case OP_STOREP_BOOL:
+					return OP_ADDRESS_STOREP_INT;
+				case OP_STOREP_V:
+					return OP_ADDRESS_STOREP_V;
+			}
+			return statement->op;
+		default:
+			return statement->op;
+	}
+
+	// branching on the result of the compare
+	if ( next->a != statement->c ) {
+		return statement->op;
+	}
+	if ( next->op == OP_IF ) {
+		return first;
+	}
+	if ( next->op == OP_IFNOT ) {
+		return first + 1;
+	}
+	return statement->op;
+}
+
+/*
+================
+idProgram::DecodeStatements
+================
+*/
+void idProgram::DecodeStatements( void ) {
+	int i, j;
+	const statement_t *statement;
+	const idVarDef *operand;
+	scriptInstruction_t *instruction;
+
+	instructions.SetNum( statements.Num() );
+
+	for ( i = 0; i < statements.Num(); i++ ) {
+		statement = &statements[ i ];
+		instruction = &instructions[ i ];
+
+		instruction->op = statement->op;
+		if ( i + 1 < statements.Num() ) {
+			instruction->op = SuperInstruction( statement, &statements[ i + 1 ] );
+		}
+
+		instruction->stackOperands = 0;
+		for ( j = 0; j < 3; j++ ) {
+			operand = ( j == 0 ) ? statement->a : ( ( j == 1 ) ? statement->b : statement->c );
+			memset( &instruction->operands[ j ], 0, sizeof( instruction->operands[ j ] ) );
+			if ( !operand ) {
+				continue;
+			}
+			if ( operand->initialized == idVarDef::stackVariable ) {
+				instruction->operands[ j ].stackOffset = operand->value.stackOffset;
+				instruction->stackOperands |= 1 << j;
+			} else {
+				instruction->operands[ j ] = operand->value;
+			}
+		}
+	}
+}
+
 /*
 ==============
 idProgram::BeginCompilation
@@ -1945,6 +2067,9 @@ bool idProgram::CompileText( const char *source, const char *text, bool console
 	ospath = fileSystem->RelativePathToOSPath( source );
 	filenum = GetFilenum( ospath );
 
+	// the compiler may patch statements that were already decoded
+	instructions.Clear();
+
 	try {
 		compiler.CompileFile( text, ospath.c_str(), console );
 
@@ -2068,7 +2193,10 @@ void idProgram::FreeData( void ) {
 
 	filename.Clear();
 	fileList.Clear();
+	includedFiles.Clear();
 	statements.Clear();
+	instructions.Clear();
+	scriptProfiler.FreeFunctions();
 	functions.Clear();
 
 	top_functions	= 0;
@@ -2086,6 +2214,8 @@ idProgram::Startup
 ================
 */
 void idProgram::Startup( const char *defaultScript ) {
+	idStr imageName;
+
 	gameLocal.Printf( "Initializing scripts\n" );
 
 	// make sure all data is freed up
@@ -2097,12 +2227,21 @@ void idProgram::Startup( const char *defaultScript ) {
 	globalOutputRunningSize = 0;
 #endif //HUMANHEAD END
 
-	// get ready for loading scripts
-	BeginCompilation();
-
-	// load the default script
+	// load the default script from the program image if none of the scripts changed
 	if ( defaultScript && *defaultScript ) {
-		CompileFile( defaultScript );
+		imageName = defaultScript;
+		imageName.SetFileExtension( "prg" );
+	}
+
+	if ( !imageName.Length() || !LoadImage( imageName ) ) {
+		// get ready for loading scripts
+		BeginCompilation();
+
+		// load the default script
+		if ( defaultScript && *defaultScript ) {
+			CompileFile( defaultScript );
+			WriteImage( imageName );
+		}
 	}
 
 	FinishCompilation();
@@ -2260,6 +2399,565 @@ int idProgram::CalculateChecksum( bool forOldSavegame ) const {
 	return result;
 }
 
+/*
+================
+idProgram::ImageTypeNum
+================
+*/
+int idProgram::ImageTypeNum( const idTypeDef *type ) const {
+	int i;
+
+	if ( !type ) {
+		return -1;
+	}
+	for ( i = 0; i < (int)ARRAY_COUNT( imageTypes ); i++ ) {
+		if ( imageTypes[i] == type ) {
+			return -2 - i;
+		}
+	}
+	i = types.FindIndex( const_cast<idTypeDef *>( type ) );
+	if ( i == -1 ) {
+		throw idCompileError( va( "type '%s' is not part of the program", type->Name() ) );
+	}
+	return i;
+}
+
+/*
+================
+idProgram::ImageDefNum
+================
+*/
+int idProgram::ImageDefNum( const idVarDef *def ) const {
+	int i;
+
+	if ( !def ) {
+		return -1;
+	}
+	for ( i = 0; i < (int)ARRAY_COUNT( imageDefs ); i++ ) {
+		if ( imageDefs[i] == def ) {
+			return -2 - i;
+		}
+	}
+	if ( def->num < 0 || def->num >= varDefs.Num() || varDefs[def->num] != def ) {
+		throw idCompileError( "def is not part of the program" );
+	}
+	return def->num;
+}
+
+/*
+================
+idProgram::ImageType
+================
+*/
+idTypeDef *idProgram::ImageType( int num ) const {
+	if ( num == -1 ) {
+		return NULL;
+	}
+	if ( num < -1 ) {
+		num = -2 - num;
+		if ( num >= (int)ARRAY_COUNT( imageTypes ) ) {
+			throw idCompileError( "bad type number" );
+		}
+		return imageTypes[num];
+	}
+	if ( num >= types.Num() ) {
+		throw idCompileError( "bad type number" );
+	}
+	return types[num];
+}
+
+/*
+================
+idProgram::ImageDef
+================
+*/
+idVarDef *idProgram::ImageDef( int num ) const {
+	if ( num == -1 ) {
+		return NULL;
+	}
+	if ( num < -1 ) {
+		num = -2 - num;
+		if ( num >= (int)ARRAY_COUNT( imageDefs ) ) {
+			throw idCompileError( "bad def number" );
+		}
+		return imageDefs[num];
+	}
+	if ( num >= varDefs.Num() ) {
+		throw idCompileError( "bad def number" );
+	}
+	return varDefs[num];
+}
+
+/*
+================
+ScriptEventChecksum
+
+The compiler binds script events by name, so any change in the event definitions invalidates the image.
+================
+*/
+static unsigned int ScriptEventChecksum( void ) {
+	int i;
+	idStr events;
+	const idEventDef *ev;
+
+	for ( i = 0; i < idEventDef::NumEventCommands(); i++ ) {
+		ev = idEventDef::GetEventCommand( i );
+		events += ev->GetName();
+		events += '(';
+		events += ev->GetArgFormat();
+		events += ')';
+		events += ev->GetReturnType();
+	}
+
+	return MD4_BlockChecksum( events.c_str(), events.Length() );
+}
+
+/*
+================
+ScriptFileChecksum
+================
+*/
+static bool ScriptFileChecksum( const char *filename, unsigned int &checksum ) {
+	void *buffer;
+	int length;
+
+	length = fileSystem->ReadFile( filename, &buffer, NULL );
+	if ( length < 0 ) {
+		return false;
+	}
+	checksum = MD4_BlockChecksum( buffer, length );
+	fileSystem->FreeFile( buffer );
+
+	return true;
+}
+
+/*
+================
+WriteImageFileList
+================
+*/
+static void WriteImageFileList( idFile *file, const idStrList &list ) {
+	int i;
+	unsigned int checksum;
+
+	file->WriteInt( list.Num() );
+	for ( i = 0; i < list.Num(); i++ ) {
+		if ( !ScriptFileChecksum( list[i], checksum ) ) {
+			throw idCompileError( va( "couldn't read '%s'", list[i].c_str() ) );
+		}
+		file->WriteString( list[i] );
+		file->WriteUnsignedInt( checksum );
+	}
+}
+
+/*
+================
+ReadImageFileList
+
+Throws an idCompileError if one of the files changed.
+================
+*/
+static void ReadImageFileList( idFile *file, idStrList &list ) {
+	int i, num;
+	unsigned int checksum, savedChecksum;
+	idStr name;
+
+	file->ReadInt( num );
+	for ( i = 0; i < num; i++ ) {
+		file->ReadString( name );
+		file->ReadUnsignedInt( savedChecksum );
+		if ( !ScriptFileChecksum( name, checksum ) || checksum != savedChecksum ) {
+			throw idCompileError( va( "'%s' changed", name.c_str() ) );
+		}
+		list.Append( name );
+	}
+}
+
+/*
+================
+idProgram::WriteImageFile
+
+Writes the compiled program with all pointers replaced by indices. The image starts with the checksums
+of everything the compiler used, so it can be thrown away as soon as one of the script files changes.
+================
+*/
+void idProgram::WriteImageFile( idFile *file ) const {
+	int i, j;
+	const idTypeDef *type;
+	const idVarDef *def;
+	const function_t *func;
+	const statement_t *statement;
+	varEval_t value;
+
+	file->Write( SCRIPT_IMAGE_ID, 4 );
+	file->WriteInt( SCRIPT_IMAGE_VERSION );
+	file->WriteInt( sizeof( intptr_t ) );
+	file->WriteInt( NUM_OPCODES );
+	file->WriteUnsignedInt( ScriptEventChecksum() );
+
+	// the included headers with only defines in them never show up in the file list
+	WriteImageFileList( file, fileList );
+	WriteImageFileList( file, includedFiles );
+
+	file->WriteInt( CalculateChecksum( false ) );
+
+	file->WriteInt( types.Num() );
+	file->WriteInt( varDefs.Num() );
+	file->WriteInt( functions.Num() );
+	file->WriteInt( statements.Num() );
+	file->WriteInt( numVariables );
+
+	for ( i = 0; i < types.Num(); i++ ) {
+		type = types[i];
+		file->WriteInt( type->type );
+		file->WriteString( type->name );
+		file->WriteInt( type->size );
+		file->WriteInt( ImageTypeNum( type->auxType ) );
+		file->WriteInt( ImageDefNum( type->def ) );
+		file->WriteInt( type->parmTypes.Num() );
+		for ( j = 0; j < type->parmTypes.Num(); j++ ) {
+			file->WriteInt( ImageTypeNum( type->parmTypes[j] ) );
+			file->WriteString( type->parmNames[j] );
+		}
+		file->WriteInt( type->functions.Num() );
+		for ( j = 0; j < type->functions.Num(); j++ ) {
+			file->WriteInt( type->functions[j] - functions.Ptr() );
+		}
+	}
+
+	for ( i = 0; i < varDefs.Num(); i++ ) {
+		def = varDefs[i];
+		file->WriteInt( ImageTypeNum( def->TypeDef() ) );
+		file->WriteInt( ImageDefNum( def->scope ) );
+		file->WriteString( def->Name() );
+		file->WriteInt( def->numUsers );
+		file->WriteInt( def->initialized );
+
+		memset( &value, 0, sizeof( value ) );
+		value.argSize = def->value.argSize;
+		if ( def->value.bytePtr == NULL ) {
+			file->WriteInt( IMAGE_VALUE_NULL );
+		} else if ( def->value.bytePtr >= variables && def->value.bytePtr <= variables + numVariables ) {
+			file->WriteInt( IMAGE_VALUE_GLOBAL );
+			file->WriteInt( def->value.bytePtr - variables );
+		} else if ( def->value.functionPtr >= functions.Ptr() && def->value.functionPtr < functions.Ptr() + functions.Num() ) {
+			file->WriteInt( IMAGE_VALUE_FUNCTION );
+			file->WriteInt( def->value.functionPtr - functions.Ptr() );
+		} else if ( memcmp( &value, &def->value, sizeof( value ) ) == 0 ) {
+			file->WriteInt( IMAGE_VALUE_INT );
+			file->WriteInt( value.argSize );
+		} else {
+			throw idCompileError( va( "can't store the value of '%s'", def->GlobalName() ) );
+		}
+	}
+
+	for ( i = 0; i < functions.Num(); i++ ) {
+		func = &functions[i];
+		file->WriteString( func->Name() );
+		file->WriteString( func->eventdef ? func->eventdef->GetName() : "" );
+		file->WriteInt( ImageDefNum( func->def ) );
+		file->WriteInt( ImageTypeNum( func->type ) );
+		file->WriteInt( func->firstStatement );
+		file->WriteInt( func->numStatements );
+		file->WriteInt( func->parmTotal );
+		file->WriteInt( func->locals );
+		file->WriteInt( func->filenum );
+		file->WriteInt( func->parmSize.Num() );
+		for ( j = 0; j < func->parmSize.Num(); j++ ) {
+			file->WriteInt( func->parmSize[j] );
+		}
+	}
+
+	for ( i = 0; i < statements.Num(); i++ ) {
+		statement = &statements[i];
+		file->WriteUnsignedShort( statement->op );
+		file->WriteUnsignedShort( statement->flags );
+		file->WriteUnsignedShort( statement->linenumber );
+		file->WriteUnsignedShort( statement->file );
+		file->WriteInt( ImageDefNum( statement->a ) );
+		file->WriteInt( ImageDefNum( statement->b ) );
+		file->WriteInt( ImageDefNum( statement->c ) );
+	}
+
+	file->Write( variables, numVariables );
+
+	file->WriteInt( ImageDefNum( returnDef ) );
+	file->WriteInt( ImageDefNum( returnStringDef ) );
+	file->WriteInt( ImageDefNum( sysDef ) );
+
+	file->Write( SCRIPT_IMAGE_ID, 4 );
+}
+
+/*
+================
+idProgram::ReadImageFile
+
+Throws an idCompileError if the image is out of date or broken, the program has to be freed afterwards.
+================
+*/
+void idProgram::ReadImageFile( idFile *file ) {
+	int i, j, num, numTypes, numDefs, numFunctions, numStatements, value, checksum;
+	unsigned int savedFileChecksum;
+	char id[4];
+	idStr name;
+	idTypeDef *type;
+	idVarDef *def;
+	function_t *func;
+	statement_t *statement;
+
+	if ( file->Read( id, 4 ) != 4 || memcmp( id, SCRIPT_IMAGE_ID, 4 ) != 0 ) {
+		throw idCompileError( "not a program image" );
+	}
+	file->ReadInt( value );
+	if ( value != SCRIPT_IMAGE_VERSION ) {
+		throw idCompileError( "wrong version" );
+	}
+	file->ReadInt( value );
+	if ( value != sizeof( intptr_t ) ) {
+		throw idCompileError( "built for a different architecture" );
+	}
+	file->ReadInt( value );
+	if ( value != NUM_OPCODES ) {
+		throw idCompileError( "opcodes changed" );
+	}
+	file->ReadUnsignedInt( savedFileChecksum );
+	if ( savedFileChecksum != ScriptEventChecksum() ) {
+		throw idCompileError( "script events changed" );
+	}
+
+	// make sure none of the script files changed
+	ReadImageFileList( file, fileList );
+	ReadImageFileList( file, includedFiles );
+
+	file->ReadInt( checksum );
+
+	file->ReadInt( numTypes );
+	file->ReadInt( numDefs );
+	file->ReadInt( numFunctions );
+	file->ReadInt( numStatements );
+	file->ReadInt( numVariables );
+	if ( numTypes < 0 || numDefs < 0 || numFunctions < 0 || numFunctions > functions.Max() ||
+			numStatements < 1 || numStatements > statements.Max() || numVariables < 0 || numVariables > (int)sizeof( variables ) ) {
+		throw idCompileError( "bad program size" );
+	}
+
+	// allocate everything first so the references can be resolved while reading
+	types.SetNum( numTypes );
+	for ( i = 0; i < numTypes; i++ ) {
+		types[i] = new idTypeDef( ev_void, NULL, "", 0, NULL );
+	}
+	varDefs.SetNum( numDefs );
+	for ( i = 0; i < numDefs; i++ ) {
+		varDefs[i] = new idVarDef();
+		varDefs[i]->num = i;
+	}
+	functions.SetNum( numFunctions );
+	statements.SetNum( numStatements );
+
+	for ( i = 0; i < numTypes; i++ ) {
+		type = types[i];
+		file->ReadInt( value );
+		type->type = ( etype_t )value;
+		file->ReadString( type->name );
+		file->ReadInt( type->size );
+		file->ReadInt( value );
+		type->auxType = ImageType( value );
+		file->ReadInt( value );
+		type->def = ImageDef( value );
+		file->ReadInt( num );
+		for ( j = 0; j < num; j++ ) {
+			file->ReadInt( value );
+			file->ReadString( name );
+			type->parmTypes.Append( ImageType( value ) );
+			type->parmNames.Append( name );
+		}
+		file->ReadInt( num );
+		for ( j = 0; j < num; j++ ) {
+			file->ReadInt( value );
+			if ( value < 0 || value >= numFunctions ) {
+				throw idCompileError( "bad function number" );
+			}
+			type->functions.Append( &functions[value] );
+		}
+	}
+
+	// the defs are added to the name lists in the same order the compiler allocated them
+	for ( i = 0; i < numDefs; i++ ) {
+		def = varDefs[i];
+		file->ReadInt( value );
+		def->SetTypeDef( ImageType( value ) );
+		file->ReadInt( value );
+		def->scope = ImageDef( value );
+		file->ReadString( name );
+		AddDefToNameList( def, name );
+		file->ReadInt( def->numUsers );
+		file->ReadInt( value );
+		def->initialized = ( idVarDef::initialized_t )value;
+
+		file->ReadInt( num );
+		switch( num ) {
+			case IMAGE_VALUE_NULL:
+				break;
+			case IMAGE_VALUE_INT:
+				file->ReadInt( def->value.argSize );
+				break;
+			case IMAGE_VALUE_GLOBAL:
+				file->ReadInt( value );
+				if ( value < 0 || value > numVariables ) {
+					throw idCompileError( "bad global offset" );
+				}
+				def->value.bytePtr = variables + value;
+				break;
+			case IMAGE_VALUE_FUNCTION:
+				file->ReadInt( value );
+				if ( value < 0 || value >= numFunctions ) {
+					throw idCompileError( "bad function number" );
+				}
+				def->value.functionPtr = &functions[value];
+				break;
+			default:
+				throw idCompileError( "bad value" );
+		}
+	}
+
+	for ( i = 0; i < numFunctions; i++ ) {
+		func = &functions[i];
+		file->ReadString( name );
+		func->SetName( name );
+		file->ReadString( name );
+		func->eventdef = NULL;
+		if ( name.Length() ) {
+			func->eventdef = idEventDef::FindEvent( name );
+			if ( !func->eventdef ) {
+				throw idCompileError( va( "unknown event '%s'", name.c_str() ) );
+			}
+		}
+		file->ReadInt( value );
+		func->def = ImageDef( value );
+		file->ReadInt( value );
+		func->type = ImageType( value );
+		file->ReadInt( func->firstStatement );
+		file->ReadInt( func->numStatements );
+		file->ReadInt( func->parmTotal );
+		file->ReadInt( func->locals );
+		file->ReadInt( func->filenum );
+		file->ReadInt( num );
+		func->parmSize.SetGranularity( 1 );
+		func->parmSize.SetNum( num );
+		for ( j = 0; j < num; j++ ) {
+			file->ReadInt( func->parmSize[j] );
+		}
+		if ( func->firstStatement < 0 || func->numStatements < 0 || func->firstStatement + func->numStatements > numStatements ) {
+			throw idCompileError( "bad function statements" );
+		}
+	}
+
+	for ( i = 0; i < numStatements; i++ ) {
+		statement = &statements[i];
+		file->ReadUnsignedShort( statement->op );
+		file->ReadUnsignedShort( statement->flags );
+		file->ReadUnsignedShort( statement->linenumber );
+		file->ReadUnsignedShort( statement->file );
+		if ( statement->op >= NUM_OPCODES || statement->file >= fileList.Num() ) {
+			throw idCompileError( "bad statement" );
+		}
+		file->ReadInt( value );
+		statement->a = ImageDef( value );
+		file->ReadInt( value );
+		statement->b = ImageDef( value );
+		file->ReadInt( value );
+		statement->c = ImageDef( value );
+	}
+
+	if ( file->Read( variables, numVariables ) != numVariables ) {
+		throw idCompileError( "truncated" );
+	}
+
+	file->ReadInt( value );
+	returnDef = ImageDef( value );
+	file->ReadInt( value );
+	returnStringDef = ImageDef( value );
+	file->ReadInt( value );
+	sysDef = ImageDef( value );
+
+	if ( file->Read( id, 4 ) != 4 || memcmp( id, SCRIPT_IMAGE_ID, 4 ) != 0 ) {
+		throw idCompileError( "truncated" );
+	}
+
+	// the statements have to produce the same checksum the compiled program had
+	if ( CalculateChecksum( false ) != checksum ) {
+		throw idCompileError( "checksum mismatch" );
+	}
+}
+
+/*
+================
+idProgram::LoadImage
+
+Replaces compiling the scripts with loading the program from the image written after the last compile.
+Returns false if there is no image or it is out of date.
+================
+*/
+bool idProgram::LoadImage( const char *imageName ) {
+	void *buffer;
+	int length;
+
+	if ( !g_scriptCache.GetBool() ) {
+		return false;
+	}
+
+	length = fileSystem->ReadFile( imageName, &buffer, NULL );
+	if ( length <= 0 ) {
+		return false;
+	}
+
+	idFile_Memory file( imageName, ( const char * )buffer, length );
+
+	FreeData();
+
+	try {
+		ReadImageFile( &file );
+	}
+
+	catch( idCompileError &err ) {
+		gameLocal.Printf( "Not using script image %s: %s\n", imageName, err.error );
+		fileSystem->FreeFile( buffer );
+		FreeData();
+		return false;
+	}
+
+	fileSystem->FreeFile( buffer );
+
+	gameLocal.Printf( "Loaded script image %s\n", imageName );
+	CompileStats();
+
+	return true;
+}
+
+/*
+================
+idProgram::WriteImage
+================
+*/
+void idProgram::WriteImage( const char *imageName ) const {
+	if ( !g_scriptCache.GetBool() ) {
+		return;
+	}
+
+	idFile_Memory file( imageName );
+
+	try {
+		WriteImageFile( &file );
+	}
+
+	catch( idCompileError &err ) {
+		gameLocal.Warning( "Couldn't write script image %s: %s", imageName, err.error );
+		return;
+	}
+
+	fileSystem->WriteFile( imageName, file.GetDataPtr(), file.Length() );
+}
+
 /*
 ==============
 idProgram::Restart
@@ -2287,12 +2985,14 @@ void idProgram::Restart( void ) {
 	}
 	varDefs.SetNum( top_defs, false );
 
+	scriptProfiler.FreeFunctions();
 	for( i = top_functions; i < functions.Num(); i++ ) {
 		functions[ i ].Clear();
 	}
 	functions.SetNum( top_functions	);
 
 	statements.SetNum( top_statements );
+	instructions.Clear();
 	fileList.SetNum( top_files, false );
 	filename.Clear();
 
@@ -2328,6 +3028,22 @@ int idProgram::GetFilenum( const char *name ) {
 	return filenum;
 }
 
+/*
+================
+idProgram::AddIncludedFile
+================
+*/
+void idProgram::AddIncludedFile( const char *name ) {
+	idStr strippedName;
+
+	strippedName = fileSystem->OSPathToRelativePath( name );
+	if ( !strippedName.Length() ) {
+		includedFiles.AddUnique( name );
+	} else {
+		includedFiles.AddUnique( strippedName );
+	}
+}
+
 /*
 ================
 idProgram::idProgram
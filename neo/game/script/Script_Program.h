@@ -98,6 +98,8 @@ Contains type information for variables and functions.
 ***********************************************************************/
 
 class idTypeDef {
+	friend class idProgram;
+
 private:
 	etype_t						type;
 	idStr						name;
@@ -501,6 +503,24 @@ typedef struct statement_s {
 
 /***********************************************************************
 
+scriptInstruction_t
+
+A statement decoded for the interpreter.  The operands hold the value of
+their def, or the offset on the local stack for stack variables, so the
+interpreter doesn't have to look at the defs.  Common pairs of statements
+are decoded into a superinstruction at the first statement, the second
+statement is still decoded on its own for jumps that land on it.
+
+***********************************************************************/
+
+typedef struct scriptInstruction_s {
+	unsigned short	op;					// statement op or superinstruction
+	unsigned short	stackOperands;		// bit n is set if operand n is on the local stack
+	varEval_t		operands[ 3 ];
+} scriptInstruction_t;
+
+/***********************************************************************
+
 idProgram
 
 Handles compiling and storage of script data.  Multiple idProgram objects
@@ -513,6 +533,7 @@ single idProgram.
 class idProgram {
 private:
 	idStrList									fileList;
+	idStrList									includedFiles;		// headers opened by the compiler, only used by the program image
 	idStr										filename;
 	int											filenum;
 
@@ -521,6 +542,7 @@ private:
 	idStaticList<byte,MAX_GLOBALS>				variableDefaults;
 	idStaticList<function_t,MAX_FUNCS>			functions;
 	idStaticList<statement_t,MAX_STATEMENTS>	statements;
+	idStaticList<scriptInstruction_t,MAX_STATEMENTS>	instructions;		// statements decoded for the interpreter
 	idList<idTypeDef *>							types;
 	idList<idVarDefName *>						varDefNames;
 	idHashIndex									varDefNameHash;
@@ -538,6 +560,18 @@ private:
 	byte										*ReserveMem(int size);
 	idVarDef									*AllocVarDef(idTypeDef *type, const char *name, idVarDef *scope);
 
+	// precompiled program image
+	int											ImageTypeNum( const idTypeDef *type ) const;
+	int											ImageDefNum( const idVarDef *def ) const;
+	idTypeDef									*ImageType( int num ) const;
+	idVarDef									*ImageDef( int num ) const;
+	void										WriteImageFile( idFile *file ) const;
+	void										ReadImageFile( idFile *file );
+
+	void										DecodeStatements( void );
+	bool										LoadImage( const char *imageName );
+	void										WriteImage( const char *imageName ) const;
+
 public:
 	idVarDef									*returnDef;
 	idVarDef									*returnStringDef;
@@ -564,6 +598,7 @@ public:
 
 	const char									*GetFilename( int num );
 	int											GetFilenum( const char *name );
+	void										AddIncludedFile( const char *name );
 	int											GetLineNumberForStatement( int index );
 	const char									*GetFilenameForStatement( int index );
 
@@ -590,6 +625,7 @@ public:
 	statement_t									*AllocStatement( void );
 	statement_t									&GetStatement( int index );
 	int											NumStatements( void ) { return statements.Num(); }
+	const scriptInstruction_t					*GetInstructions( void );
 
 	int 										GetReturnedInteger( void );
 
@@ -619,6 +655,20 @@ ID_INLINE statement_t &idProgram::GetStatement( int index ) {
 	return statements[ index ];
 }
 
+/*
+================
+idProgram::GetInstructions
+
+Returns the decoded statements, decodes them again if any statements were added since.
+================
+*/
+ID_INLINE const scriptInstruction_t *idProgram::GetInstructions( void ) {
+	if ( instructions.Num() != statements.Num() ) {
+		DecodeStatements();
+	}
+	return instructions.Ptr();
+}
+
 /*
 ================
 idProgram::GetFunction
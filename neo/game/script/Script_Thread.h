@@ -273,6 +273,7 @@ public:
 	void						ContinueProcessing( void ) { interpreter.doneProcessing = false; };
 	bool						ThreadDying( void ) { return interpreter.threadDying; };
 	void						EndThread( void ) { interpreter.threadDying = true; };
+	int							GetStatementCount( void ) const { return interpreter.statementCount; };
 	bool						IsWaiting( void );
 	void						ClearWaitFor( void );
 	bool						IsWaitingFor( idEntity *obj );
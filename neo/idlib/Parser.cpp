@@ -1032,6 +1032,7 @@ int idParser::Directive_include( void ) {
 	}
 	script->SetFlags( idParser::flags );
 	script->SetPunctuations( idParser::punctuations );
+	idParser::includedFiles.Append( script->GetFileName() );
 	idParser::PushScript( script );
 	return true;
 }
@@ -3132,6 +3133,7 @@ void idParser::FreeSource( bool keepDefines ) {
 		indentstack = indentstack->next;
 		Mem_Free( indent );
 	}
+	includedFiles.Clear();
 	if ( !keepDefines ) {
 		// free hash table
 		if ( definehash ) {
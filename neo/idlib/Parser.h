@@ -158,6 +158,8 @@ public:
 	int				GetFlags( void ) const;
 					// returns the current filename
 	const char *	GetFileName( void ) const;
+					// returns the files opened with #include since the source was loaded
+	const idList<idStr> &GetIncludedFiles( void ) const { return includedFiles; }
 					// get current offset in current script
 	const int		GetFileOffset( void ) const;
 					// get file time for current script
@@ -186,6 +188,7 @@ private:
 	const punctuation_t *punctuations;			// punctuations to use
 	int				flags;						// flags used for script parsing
 	idLexer *		scriptstack;				// stack with scripts of the source
+	idList<idStr>	includedFiles;				// names of the included scripts
 	idToken *		tokens;						// tokens to read first
 	define_t *		defines;					// list with macro definitions
 	define_t **		definehash;					// hash chain with defines
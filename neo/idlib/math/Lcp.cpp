@@ -83,7 +83,7 @@ idLCP_Square::FactorClamped
 ============
 */
 bool idLCP_Square::FactorClamped( void ) {
-	int i, j, k;
+	int i, j;
 	float s, d;
 
 	for ( i = 0; i < numClamped; i++ ) {
@@ -104,10 +104,7 @@ bool idLCP_Square::FactorClamped( void ) {
 		}
 
 		for ( j = i + 1; j < numClamped; j++ ) {
-			d = clamped[j][i];
-			for ( k = i + 1; k < numClamped; k++ ) {
-				clamped[j][k] -= d * clamped[i][k];
-			}
+			SIMDProcessor->MulSub( clamped[j] + i + 1, clamped[j][i], clamped[i] + i + 1, numClamped - i - 1 );
 		}
 	}
 
@@ -120,25 +117,16 @@ idLCP_Square::SolveClamped
 ============
 */
 void idLCP_Square::SolveClamped( idVecX &x, const float *b ) {
-	int i, j;
-	float sum;
+	int i;
+	float dot;
 
 	// solve L
-	for ( i = 0; i < numClamped; i++ ) {
-		sum = b[i];
-		for ( j = 0; j < i; j++ ) {
-			sum -= clamped[i][j] * x[j];
-		}
-		x[i] = sum;
-	}
+	SIMDProcessor->MatX_LowerTriangularSolve( clamped, x.ToFloatPtr(), b, numClamped );
 
 	// solve U
 	for ( i = numClamped - 1; i >= 0; i-- ) {
-		sum = x[i];
-		for ( j = i + 1; j < numClamped; j++ ) {
-			sum -= clamped[i][j] * x[j];
-		}
-		x[i] = sum * diagonal[i];
+		SIMDProcessor->Dot( dot, clamped[i] + i + 1, x.ToFloatPtr() + i + 1, numClamped - i - 1 );
+		x[i] = ( x[i] - dot ) * diagonal[i];
 	}
 }
 
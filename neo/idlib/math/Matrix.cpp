@@ -2935,9 +2935,8 @@ const char *idMat6::ToString( int precision ) const {
 //
 //===============================================================
 
-float	idMatX::temp[MATX_MAX_TEMP+4];
-float *	idMatX::tempPtr = (float *) ( ( (intptr_t) idMatX::temp + 15 ) & ~15 );
-int		idMatX::tempIndex = 0;
+ALIGN16( thread_local float idMatX::temp[MATX_MAX_TEMP+4] );
+thread_local int		idMatX::tempIndex = 0;
 
 
 /*
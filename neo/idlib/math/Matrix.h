@@ -2004,9 +2004,9 @@ private:
 	int				alloced;				// floats allocated, if -1 then mat points to data set with SetData
 	float *			mat;					// memory the matrix is stored
 
-	static float	temp[MATX_MAX_TEMP+4];	// used to store intermediate results
-	static float *	tempPtr;				// pointer to 16 byte aligned temporary memory
-	static int		tempIndex;				// index into memory pool, wraps around
+							// the memory pool is per thread so jobs don't overwrite each other's intermediate results
+	ALIGN16( static thread_local float temp[MATX_MAX_TEMP+4] );	// 16 byte aligned memory used to store intermediate results
+	static thread_local int tempIndex;		// index into memory pool, wraps around
 
 private:
 	void			SetTempSize( int rows, int columns );
@@ -2030,7 +2030,7 @@ ID_INLINE idMatX::idMatX( void ) {
 
 ID_INLINE idMatX::~idMatX( void ) {
 	// if not temp memory
-	if ( mat != NULL && ( mat < idMatX::tempPtr || mat > idMatX::tempPtr + MATX_MAX_TEMP ) && alloced != -1 ) {
+	if ( mat != NULL && ( mat < idMatX::temp || mat > idMatX::temp + MATX_MAX_TEMP ) && alloced != -1 ) {
 		Mem_Free16( mat );
 	}
 }
@@ -2277,7 +2277,7 @@ ID_INLINE bool idMatX::operator!=( const idMatX &a ) const {
 }
 
 ID_INLINE void idMatX::SetSize( int rows, int columns ) {
-	assert( mat < idMatX::tempPtr || mat > idMatX::tempPtr + MATX_MAX_TEMP );
+	assert( mat < idMatX::temp || mat > idMatX::temp + MATX_MAX_TEMP );
 	int alloc = ( rows * columns + 3 ) & ~3;
 	if ( alloc > alloced && alloced != -1 ) {
 		if ( mat != NULL ) {
@@ -2299,7 +2299,7 @@ ID_INLINE void idMatX::SetTempSize( int rows, int columns ) {
 	if ( idMatX::tempIndex + newSize > MATX_MAX_TEMP ) {
 		idMatX::tempIndex = 0;
 	}
-	mat = idMatX::tempPtr + idMatX::tempIndex;
+	mat = idMatX::temp + idMatX::tempIndex;
 	idMatX::tempIndex += newSize;
 	alloced = newSize;
 	numRows = rows;
@@ -2308,7 +2308,7 @@ ID_INLINE void idMatX::SetTempSize( int rows, int columns ) {
 }
 
 ID_INLINE void idMatX::SetData( int rows, int columns, float *data ) {
-	assert( mat < idMatX::tempPtr || mat > idMatX::tempPtr + MATX_MAX_TEMP );
+	assert( mat < idMatX::temp || mat > idMatX::temp + MATX_MAX_TEMP );
 	if ( mat != NULL && alloced != -1 ) {
 		Mem_Free16( mat );
 	}
@@ -34,6 +34,7 @@ If you have questions concerning this license or the applicable additional terms
 #include "Simd_SSE.h"
 #include "Simd_SSE2.h"
 #include "Simd_SSE3.h"
+#include "Simd_AVX2.h"
 
 idSIMDProcessor	*	processor = NULL;			// pointer to SIMD processor
 idSIMDProcessor *	generic = NULL;				// pointer to generic SIMD implementation
@@ -69,6 +70,11 @@ void idSIMD::InitProcessor( const char *module, bool forceGeneric ) {
 	} else {
 
 		if ( !processor ) {
+#ifdef ID_SIMD_AVX2
+			if ( ( cpuid & CPUID_MMX ) && ( cpuid & CPUID_SSE ) && ( cpuid & CPUID_SSE2 ) && ( cpuid & CPUID_SSE3 ) && ( cpuid & CPUID_AVX2 ) && ( cpuid & CPUID_FMA3 ) ) {
+				processor = new idSIMD_AVX2;
+			} else
+#endif
 			if ( ( cpuid & CPUID_MMX ) && ( cpuid & CPUID_SSE ) && ( cpuid & CPUID_SSE2 ) && ( cpuid & CPUID_SSE3 ) ) {
 				processor = new idSIMD_SSE3;
 			} else if ( ( cpuid & CPUID_MMX ) && ( cpuid & CPUID_SSE ) && ( cpuid & CPUID_SSE2 ) ) {
@@ -2147,6 +2153,101 @@ void TestMatXLDLTFactor( void ) {
 	}
 }
 
+#define LCP_SIMD_EPSILON				0.1f
+#define LCP_MAX_CONSTRAINTS				96
+#define LCP_NUMTESTS					64
+
+/*
+============
+TestLCP
+
+  solves constraint systems shaped like the ones of an articulated figure
+  once with the generic processor and once with the SIMD processor:
+  a chain of bodies connected by ball and socket joints with a limit row
+  after every joint, so the matrix is banded and one in four rows is boxed
+============
+*/
+void TestLCP( void ) {
+	int i, j, k, n, numBodies;
+	TIME_TYPE start, end, bestClocksGeneric, bestClocksSIMD;
+	const char *result;
+	idMatX J, A;
+	idVecX b, lo, hi, x1, x2;
+	idLCP *lcp;
+	idSIMDProcessor *oldProcessor;
+	idRandom srnd( RANDOM_SEED );
+
+	idLib::common->Printf("====================================\n" );
+
+	oldProcessor = SIMDProcessor;
+
+	for ( n = 8; n <= LCP_MAX_CONSTRAINTS; n += 8 ) {
+
+		// every body has 6 degrees of freedom, every joint has three rows and a limit row
+		numBodies = n / 4 + 1;
+		J.Zero( n, numBodies * 6 );
+		for ( i = 0; i < n; i++ ) {
+			for ( j = ( i / 4 ) * 6; j < ( i / 4 ) * 6 + 12; j++ ) {
+				J[i][j] = srnd.CRandomFloat();
+			}
+		}
+		A.SetSize( n, n );
+		J.Multiply( A, J.Transpose() );
+		for ( i = 0; i < n; i++ ) {
+			A[i][i] += 1e-2f;
+		}
+
+		b.SetSize( n );
+		lo.SetSize( n );
+		hi.SetSize( n );
+		for ( i = 0; i < n; i++ ) {
+			b[i] = srnd.CRandomFloat() * 10.0f;
+			if ( ( i & 3 ) == 3 ) {
+				lo[i] = -1.0f;
+				hi[i] = 1.0f;
+			} else {
+				lo[i] = -idMath::INFINITY;
+				hi[i] = idMath::INFINITY;
+			}
+		}
+		x1.SetSize( n );
+		x2.SetSize( n );
+
+		for ( k = 0; k < 2; k++ ) {
+			lcp = ( k == 0 ) ? idLCP::AllocSymmetric() : idLCP::AllocSquare();
+
+			SIMDProcessor = p_generic;
+			bestClocksGeneric = 0;
+			for ( j = 0; j < LCP_NUMTESTS; j++ ) {
+				x1.Zero();
+				StartRecordTime( start );
+				lcp->Solve( A, x1, b, lo, hi );
+				StopRecordTime( end );
+				GetBest( start, end, bestClocksGeneric );
+			}
+
+			PrintClocks( va( "generic->LCP_%s %dx%d", ( k == 0 ) ? "Symmetric" : "Square", n, n ), 1, bestClocksGeneric );
+
+			SIMDProcessor = p_simd;
+			bestClocksSIMD = 0;
+			for ( j = 0; j < LCP_NUMTESTS; j++ ) {
+				x2.Zero();
+				StartRecordTime( start );
+				lcp->Solve( A, x2, b, lo, hi );
+				StopRecordTime( end );
+				GetBest( start, end, bestClocksSIMD );
+			}
+
+			result = x1.Compare( x2, LCP_SIMD_EPSILON ) ? "ok" :  S_COLOR_RED "X";
+			PrintClocks( va( "   simd->LCP_%s %dx%d %s", ( k == 0 ) ? "Symmetric" : "Square", n, n, result ), 1, bestClocksSIMD, bestClocksGeneric );
+
+			delete lcp;
+		}
+	}
+
+	SIMDProcessor = oldProcessor;
+}
+
 /*
 ============
 TestBlendJoints
@@ -3206,6 +3307,123 @@ void TestCreateShadowCache( void ) {
 	PrintClocks( va( "   simd->CreateVertexProgramShadowCache() %s", result ), COUNT, bestClocksSIMD, bestClocksGeneric );
 }
 
+/*
+============
+TestShadowPointCull
+============
+*/
+void TestShadowPointCull( void ) {
+	int i, j;
+	TIME_TYPE start, end, bestClocksGeneric, bestClocksSIMD;
+	ALIGN16( idPlane planes[6] );
+	ALIGN16( idDrawVert drawVerts[COUNT] );
+	ALIGN16( unsigned short pointCull1[COUNT] );
+	ALIGN16( unsigned short pointCull2[COUNT] );
+	const char *result;
+
+	idRandom srnd( RANDOM_SEED );
+
+	planes[0].SetNormal( idVec3(  1,  0,  0 ) );
+	planes[1].SetNormal( idVec3( -1,  0,  0 ) );
+	planes[2].SetNormal( idVec3(  0,  1,  0 ) );
+	planes[3].SetNormal( idVec3(  0, -1,  0 ) );
+	planes[4].SetNormal( idVec3(  0,  0,  1 ) );
+	planes[5].SetNormal( idVec3(  0,  0, -1 ) );
+	planes[0][3] = 5.3f;
+	planes[1][3] = 5.3f;
+	planes[2][3] = 4.4f;
+	planes[3][3] = 4.4f;
+	planes[4][3] = 3.5f;
+	planes[5][3] = 3.5f;
+
+	for ( i = 0; i < COUNT; i++ ) {
+		for ( j = 0; j < 3; j++ ) {
+			drawVerts[i].xyz[j] = srnd.CRandomFloat() * 10.0f;
+		}
+	}
+
+	// plane 5 is known to have everything in front
+	const int frontBits = 1 << ( 5 + 6 );
+
+	bestClocksGeneric = 0;
+	for ( i = 0; i < NUMTESTS; i++ ) {
+		StartRecordTime( start );
+		p_generic->ShadowPointCull( pointCull1, planes, frontBits, 0.1f, drawVerts, COUNT - 3 );
+		StopRecordTime( end );
+		GetBest( start, end, bestClocksGeneric );
+	}
+	PrintClocks( "generic->ShadowPointCull()", COUNT, bestClocksGeneric );
+
+	bestClocksSIMD = 0;
+	for ( i = 0; i < NUMTESTS; i++ ) {
+		StartRecordTime( start );
+		p_simd->ShadowPointCull( pointCull2, planes, frontBits, 0.1f, drawVerts, COUNT - 3 );
+		StopRecordTime( end );
+		GetBest( start, end, bestClocksSIMD );
+	}
+
+	for ( i = 0; i < COUNT - 3; i++ ) {
+		if ( pointCull1[i] != pointCull2[i] ) {
+			break;
+		}
+	}
+	result = ( i >= COUNT - 3 ) ? "ok" :  S_COLOR_RED "X";
+	PrintClocks( va( "   simd->ShadowPointCull() %s", result ), COUNT, bestClocksSIMD, bestClocksGeneric );
+}
+
+/*
+============
+TestShadowTriangleCull
+============
+*/
+void TestShadowTriangleCull( void ) {
+	int i;
+	TIME_TYPE start, end, bestClocksGeneric, bestClocksSIMD;
+	ALIGN16( int indexes[COUNT*3] );
+	ALIGN16( byte facing[COUNT] );
+	ALIGN16( unsigned short pointCull[COUNT+1] );
+	unsigned int castBits1[COUNT/32+1], clipBits1[COUNT/32+1];
+	unsigned int castBits2[COUNT/32+1], clipBits2[COUNT/32+1];
+	const int numTris = COUNT - 5;
+	const char *result;
+
+	idRandom srnd( RANDOM_SEED );
+
+	for ( i = 0; i < COUNT; i++ ) {
+		pointCull[i] = srnd.RandomInt( 1 << 12 ) | ( srnd.RandomInt( 2 ) ? 0xfc0 : 0 );
+		facing[i] = srnd.RandomInt( 4 ) == 0;
+	}
+	pointCull[COUNT] = 0;
+	for ( i = 0; i < COUNT*3; i++ ) {
+		indexes[i] = srnd.RandomInt( COUNT );
+	}
+
+	bestClocksGeneric = 0;
+	for ( i = 0; i < NUMTESTS; i++ ) {
+		StartRecordTime( start );
+		p_generic->ShadowTriangleCull( castBits1, clipBits1, facing, pointCull, indexes, numTris );
+		StopRecordTime( end );
+		GetBest( start, end, bestClocksGeneric );
+	}
+	PrintClocks( "generic->ShadowTriangleCull()", COUNT, bestClocksGeneric );
+
+	bestClocksSIMD = 0;
+	for ( i = 0; i < NUMTESTS; i++ ) {
+		StartRecordTime( start );
+		p_simd->ShadowTriangleCull( castBits2, clipBits2, facing, pointCull, indexes, numTris );
+		StopRecordTime( end );
+		GetBest( start, end, bestClocksSIMD );
+	}
+
+	for ( i = 0; i < ( numTris + 31 ) >> 5; i++ ) {
+		if ( castBits1[i] != castBits2[i] || clipBits1[i] != clipBits2[i] ) {
+			break;
+		}
+	}
+	result = ( i >= ( numTris + 31 ) >> 5 ) ? "ok" :  S_COLOR_RED "X";
+	PrintClocks( va( "   simd->ShadowTriangleCull() %s", result ), COUNT, bestClocksSIMD, bestClocksGeneric );
+}
+
 /*
 ============
 TestSoundUpSampling
@@ -3999,8 +4217,16 @@ void idSIMD::Test_f( const idCmdArgs &args ) {
 				return;
 			}
 			p_simd = new idSIMD_SSE3();
+#ifdef ID_SIMD_AVX2
+		} else if ( idStr::Icmp( argString, "AVX2" ) == 0 ) {
+			if ( !( cpuid & CPUID_MMX ) || !( cpuid & CPUID_SSE ) || !( cpuid & CPUID_SSE2 ) || !( cpuid & CPUID_SSE3 ) || !( cpuid & CPUID_AVX2 ) || !( cpuid & CPUID_FMA3 ) ) {
+				common->Printf( "CPU does not support MMX & SSE & SSE2 & SSE3 & AVX2 & FMA\n" );
+				return;
+			}
+			p_simd = new idSIMD_AVX2();
+#endif
 		} else {
-			common->Printf( "invalid argument, use: MMX, SSE, SSE2, SSE3\n" );
+			common->Printf( "invalid argument, use: MMX, SSE, SSE2, SSE3, AVX2\n" );
 			return;
 		}
 	}
@@ -4035,6 +4261,7 @@ void idSIMD::Test_f( const idCmdArgs &args ) {
 	TestMatXLowerTriangularSolve();
 	TestMatXLowerTriangularSolveTranspose();
 	TestMatXLDLTFactor();
+	TestLCP();
 
 	idLib::common->Printf("====================================\n" );
 
@@ -4054,6 +4281,8 @@ void idSIMD::Test_f( const idCmdArgs &args ) {
 	TestGetTextureSpaceLightVectors();
 	TestGetSpecularTextureCoords();
 	TestCreateShadowCache();
+	TestShadowPointCull();
+	TestShadowTriangleCull();
 
 	idLib::common->Printf("====================================\n" );
 
@@ -0,0 +1,1459 @@
+/*
+===========================================================================
+
+Doom 3 GPL Source Code
+Copyright (C) 1999-2011 id Software LLC, a ZeniMax Media company.
+
+This file is part of the Doom 3 GPL Source Code ("Doom 3 Source Code").
+
+Doom 3 Source Code is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Doom 3 Source Code is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Doom 3 Source Code.  If not, see <http://www.gnu.org/licenses/>.
+
+In addition, the Doom 3 Source Code is also subject to certain additional terms. You should have received a copy of these additional terms immediately following the terms and conditions of the GNU General Public License which accompanied the Doom 3 Source Code.  If not, please request a copy in writing from id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+
+===========================================================================
+*/
+
+#include "precompiled.h"
+#pragma hdrstop
+
+#include "Simd_Generic.h"
+#include "Simd_MMX.h"
+#include "Simd_SSE.h"
+#include "Simd_SSE2.h"
+#include "Simd_SSE3.h"
+#include "Simd_AVX2.h"
+
+//===============================================================
+//
+//	AVX2 & FMA implementation of idSIMDProcessor
+//
+//===============================================================
+
+#ifdef ID_SIMD_AVX2
+
+#include <immintrin.h>
+
+// the translation unit is compiled for the baseline instruction set, so every
+// function using AVX2 or FMA intrinsics has to enable them explicitly
+#if defined(__GNUC__)
+	#define AVX2_FUNC					__attribute__((target("avx2,fma")))
+#else
+	#define AVX2_FUNC
+#endif
+
+#define DRAWVERT_FLOATS					15
+#define DRAWVERT_XYZ_OFFSET				0
+#define DRAWVERT_ST_OFFSET				3
+#define JOINTQUAT_FLOATS				7
+
+/*
+============
+LoadVec3x8
+
+  loads eight consecutive idVec3 and transposes them to x, y and z vectors
+============
+*/
+AVX2_FUNC static ID_INLINE void LoadVec3x8( const float *src, __m256 &x, __m256 &y, __m256 &z ) {
+	__m256 m03 = _mm256_castps128_ps256( _mm_loadu_ps( src + 0 ) );		// x0 y0 z0 x1
+	__m256 m14 = _mm256_castps128_ps256( _mm_loadu_ps( src + 4 ) );		// y1 z1 x2 y2
+	__m256 m25 = _mm256_castps128_ps256( _mm_loadu_ps( src + 8 ) );		// z2 x3 y3 z3
+	m03 = _mm256_insertf128_ps( m03, _mm_loadu_ps( src + 12 ), 1 );		// x4 y4 z4 x5
+	m14 = _mm256_insertf128_ps( m14, _mm_loadu_ps( src + 16 ), 1 );		// y5 z5 x6 y6
+	m25 = _mm256_insertf128_ps( m25, _mm_loadu_ps( src + 20 ), 1 );		// z6 x7 y7 z7
+
+	const __m256 xy = _mm256_shuffle_ps( m14, m25, _MM_SHUFFLE( 2, 1, 3, 2 ) );	// x2 y2 x3 y3
+	const __m256 yz = _mm256_shuffle_ps( m03, m14, _MM_SHUFFLE( 1, 0, 2, 1 ) );	// y0 z0 y1 z1
+	x = _mm256_shuffle_ps( m03, xy, _MM_SHUFFLE( 2, 0, 3, 0 ) );
+	y = _mm256_shuffle_ps( yz, xy, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+	z = _mm256_shuffle_ps( yz, m25, _MM_SHUFFLE( 3, 0, 3, 1 ) );
+}
+
+/*
+============
+LoadVec4x8
+
+  loads eight consecutive idVec4 or idPlane and transposes them to x, y, z and w vectors
+============
+*/
+AVX2_FUNC static ID_INLINE void LoadVec4x8( const float *src, __m256 &x, __m256 &y, __m256 &z, __m256 &w ) {
+	const __m256 r0 = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( src +  0 ) ), _mm_loadu_ps( src + 16 ), 1 );
+	const __m256 r1 = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( src +  4 ) ), _mm_loadu_ps( src + 20 ), 1 );
+	const __m256 r2 = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( src +  8 ) ), _mm_loadu_ps( src + 24 ), 1 );
+	const __m256 r3 = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( src + 12 ) ), _mm_loadu_ps( src + 28 ), 1 );
+
+	const __m256 t0 = _mm256_unpacklo_ps( r0, r1 );	// x0 x1 y0 y1
+	const __m256 t1 = _mm256_unpackhi_ps( r0, r1 );	// z0 z1 w0 w1
+	const __m256 t2 = _mm256_unpacklo_ps( r2, r3 );	// x2 x3 y2 y3
+	const __m256 t3 = _mm256_unpackhi_ps( r2, r3 );	// z2 z3 w2 w3
+	x = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+	y = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+	z = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+	w = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+}
+
+/*
+============
+GatherVec3x8
+
+  gathers three consecutive floats at the given float offsets
+============
+*/
+AVX2_FUNC static ID_INLINE void GatherVec3x8( const float *base, const __m256i offsets, __m256 &x, __m256 &y, __m256 &z ) {
+	x = _mm256_i32gather_ps( base + 0, offsets, 4 );
+	y = _mm256_i32gather_ps( base + 1, offsets, 4 );
+	z = _mm256_i32gather_ps( base + 2, offsets, 4 );
+}
+
+/*
+============
+HorizontalMin / HorizontalMax / HorizontalAdd
+============
+*/
+AVX2_FUNC static ID_INLINE float HorizontalMin( const __m256 v ) {
+	__m128 m = _mm_min_ps( _mm256_castps256_ps128( v ), _mm256_extractf128_ps( v, 1 ) );
+	m = _mm_min_ps( m, _mm_movehl_ps( m, m ) );
+	m = _mm_min_ss( m, _mm_shuffle_ps( m, m, _MM_SHUFFLE( 1, 1, 1, 1 ) ) );
+	return _mm_cvtss_f32( m );
+}
+
+AVX2_FUNC static ID_INLINE float HorizontalMax( const __m256 v ) {
+	__m128 m = _mm_max_ps( _mm256_castps256_ps128( v ), _mm256_extractf128_ps( v, 1 ) );
+	m = _mm_max_ps( m, _mm_movehl_ps( m, m ) );
+	m = _mm_max_ss( m, _mm_shuffle_ps( m, m, _MM_SHUFFLE( 1, 1, 1, 1 ) ) );
+	return _mm_cvtss_f32( m );
+}
+
+AVX2_FUNC static ID_INLINE float HorizontalAdd( const __m256 v ) {
+	__m128 m = _mm_add_ps( _mm256_castps256_ps128( v ), _mm256_extractf128_ps( v, 1 ) );
+	m = _mm_add_ps( m, _mm_movehl_ps( m, m ) );
+	m = _mm_add_ss( m, _mm_shuffle_ps( m, m, _MM_SHUFFLE( 1, 1, 1, 1 ) ) );
+	return _mm_cvtss_f32( m );
+}
+
+/*
+============
+RowDot
+
+  dot product of two float arrays, used for the rows of the triangular solves
+============
+*/
+AVX2_FUNC static ID_INLINE float RowDot( const float *src0, const float *src1, const int count ) {
+	__m256 sum0 = _mm256_setzero_ps();
+	__m256 sum1 = _mm256_setzero_ps();
+	int i;
+
+	for ( i = 0; i + 16 <= count; i += 16 ) {
+		sum0 = _mm256_fmadd_ps( _mm256_loadu_ps( src0 + i + 0 ), _mm256_loadu_ps( src1 + i + 0 ), sum0 );
+		sum1 = _mm256_fmadd_ps( _mm256_loadu_ps( src0 + i + 8 ), _mm256_loadu_ps( src1 + i + 8 ), sum1 );
+	}
+	if ( i + 8 <= count ) {
+		sum0 = _mm256_fmadd_ps( _mm256_loadu_ps( src0 + i ), _mm256_loadu_ps( src1 + i ), sum0 );
+		i += 8;
+	}
+	float s = HorizontalAdd( _mm256_add_ps( sum0, sum1 ) );
+	for ( ; i < count; i++ ) {
+		s += src0[i] * src1[i];
+	}
+	return s;
+}
+
+/*
+============
+ReciprocalSqrt
+
+  same precision as idMath::RSqrt, one Newton-Raphson step on top of the estimate
+  zero lengths are clamped so degenerate vectors stay zero instead of turning into NaN
+============
+*/
+AVX2_FUNC static ID_INLINE __m256 ReciprocalSqrt( __m256 x ) {
+	x = _mm256_max_ps( x, _mm256_set1_ps( 1e-30f ) );
+	const __m256 r = _mm256_rsqrt_ps( x );
+	const __m256 hx = _mm256_mul_ps( x, _mm256_set1_ps( 0.5f ) );
+	return _mm256_mul_ps( r, _mm256_fnmadd_ps( hx, _mm256_mul_ps( r, r ), _mm256_set1_ps( 1.5f ) ) );
+}
+
+/*
+============
+idSIMD_AVX2::GetName
+============
+*/
+const char * idSIMD_AVX2::GetName( void ) const {
+	return "MMX & SSE & SSE2 & SSE3 & AVX2 & FMA";
+}
+
+/*
+============
+idSIMD_AVX2::Dot
+
+  dst[i] = constant * src[i];
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::Dot( float *dst, const idVec3 &constant, const idVec3 *src, const int count ) {
+	const __m256 cx = _mm256_set1_ps( constant.x );
+	const __m256 cy = _mm256_set1_ps( constant.y );
+	const __m256 cz = _mm256_set1_ps( constant.z );
+	const float *srcPtr = src->ToFloatPtr();
+	int i;
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		__m256 x, y, z;
+		LoadVec3x8( srcPtr + i * 3, x, y, z );
+		_mm256_storeu_ps( dst + i, _mm256_fmadd_ps( x, cx, _mm256_fmadd_ps( y, cy, _mm256_mul_ps( z, cz ) ) ) );
+	}
+	for ( ; i < count; i++ ) {
+		dst[i] = constant * src[i];
+	}
+}
+
+/*
+============
+idSIMD_AVX2::Dot
+
+  dst[i] = constant * src[i].Normal() + src[i][3];
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::Dot( float *dst, const idVec3 &constant, const idPlane *src, const int count ) {
+	const __m256 cx = _mm256_set1_ps( constant.x );
+	const __m256 cy = _mm256_set1_ps( constant.y );
+	const __m256 cz = _mm256_set1_ps( constant.z );
+	const float *srcPtr = src->ToFloatPtr();
+	int i;
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		__m256 x, y, z, w;
+		LoadVec4x8( srcPtr + i * 4, x, y, z, w );
+		_mm256_storeu_ps( dst + i, _mm256_fmadd_ps( x, cx, _mm256_fmadd_ps( y, cy, _mm256_fmadd_ps( z, cz, w ) ) ) );
+	}
+	for ( ; i < count; i++ ) {
+		dst[i] = constant * src[i].Normal() + src[i][3];
+	}
+}
+
+/*
+============
+idSIMD_AVX2::Dot
+
+  dst[i] = constant * src[i].xyz;
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::Dot( float *dst, const idVec3 &constant, const idDrawVert *src, const int count ) {
+	const __m256 cx = _mm256_set1_ps( constant.x );
+	const __m256 cy = _mm256_set1_ps( constant.y );
+	const __m256 cz = _mm256_set1_ps( constant.z );
+	const __m256i offsets = _mm256_mullo_epi32( _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ), _mm256_set1_epi32( DRAWVERT_FLOATS ) );
+	const float *srcPtr = src->xyz.ToFloatPtr();
+	int i;
+
+	assert( sizeof( idDrawVert ) == DRAWVERT_FLOATS * sizeof( float ) );
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		__m256 x, y, z;
+		GatherVec3x8( srcPtr + i * DRAWVERT_FLOATS, offsets, x, y, z );
+		_mm256_storeu_ps( dst + i, _mm256_fmadd_ps( x, cx, _mm256_fmadd_ps( y, cy, _mm256_mul_ps( z, cz ) ) ) );
+	}
+	for ( ; i < count; i++ ) {
+		dst[i] = constant * src[i].xyz;
+	}
+}
+
+/*
+============
+idSIMD_AVX2::Dot
+
+  dst[i] = constant.Normal() * src[i] + constant[3];
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::Dot( float *dst, const idPlane &constant, const idVec3 *src, const int count ) {
+	const __m256 cx = _mm256_set1_ps( constant[0] );
+	const __m256 cy = _mm256_set1_ps( constant[1] );
+	const __m256 cz = _mm256_set1_ps( constant[2] );
+	const __m256 cw = _mm256_set1_ps( constant[3] );
+	const float *srcPtr = src->ToFloatPtr();
+	int i;
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		__m256 x, y, z;
+		LoadVec3x8( srcPtr + i * 3, x, y, z );
+		_mm256_storeu_ps( dst + i, _mm256_fmadd_ps( x, cx, _mm256_fmadd_ps( y, cy, _mm256_fmadd_ps( z, cz, cw ) ) ) );
+	}
+	for ( ; i < count; i++ ) {
+		dst[i] = constant.Normal() * src[i] + constant[3];
+	}
+}
+
+/*
+============
+idSIMD_AVX2::Dot
+
+  dst[i] = constant.Normal() * src[i].Normal() + constant[3] * src[i][3];
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::Dot( float *dst, const idPlane &constant, const idPlane *src, const int count ) {
+	const __m256 cx = _mm256_set1_ps( constant[0] );
+	const __m256 cy = _mm256_set1_ps( constant[1] );
+	const __m256 cz = _mm256_set1_ps( constant[2] );
+	const __m256 cw = _mm256_set1_ps( constant[3] );
+	const float *srcPtr = src->ToFloatPtr();
+	int i;
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		__m256 x, y, z, w;
+		LoadVec4x8( srcPtr + i * 4, x, y, z, w );
+		_mm256_storeu_ps( dst + i, _mm256_fmadd_ps( x, cx, _mm256_fmadd_ps( y, cy, _mm256_fmadd_ps( z, cz, _mm256_mul_ps( w, cw ) ) ) ) );
+	}
+	for ( ; i < count; i++ ) {
+		dst[i] = constant.Normal() * src[i].Normal() + constant[3] * src[i][3];
+	}
+}
+
+/*
+============
+idSIMD_AVX2::Dot
+
+  dst[i] = constant.Normal() * src[i].xyz + constant[3];
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::Dot( float *dst, const idPlane &constant, const idDrawVert *src, const int count ) {
+	const __m256 cx = _mm256_set1_ps( constant[0] );
+	const __m256 cy = _mm256_set1_ps( constant[1] );
+	const __m256 cz = _mm256_set1_ps( constant[2] );
+	const __m256 cw = _mm256_set1_ps( constant[3] );
+	const __m256i offsets = _mm256_mullo_epi32( _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ), _mm256_set1_epi32( DRAWVERT_FLOATS ) );
+	const float *srcPtr = src->xyz.ToFloatPtr();
+	int i;
+
+	assert( sizeof( idDrawVert ) == DRAWVERT_FLOATS * sizeof( float ) );
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		__m256 x, y, z;
+		GatherVec3x8( srcPtr + i * DRAWVERT_FLOATS, offsets, x, y, z );
+		_mm256_storeu_ps( dst + i, _mm256_fmadd_ps( x, cx, _mm256_fmadd_ps( y, cy, _mm256_fmadd_ps( z, cz, cw ) ) ) );
+	}
+	for ( ; i < count; i++ ) {
+		dst[i] = constant.Normal() * src[i].xyz + constant[3];
+	}
+}
+
+/*
+============
+idSIMD_AVX2::Dot
+
+  dst[i] = src0[i] * src1[i];
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::Dot( float *dst, const idVec3 *src0, const idVec3 *src1, const int count ) {
+	const float *src0Ptr = src0->ToFloatPtr();
+	const float *src1Ptr = src1->ToFloatPtr();
+	int i;
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		__m256 x0, y0, z0, x1, y1, z1;
+		LoadVec3x8( src0Ptr + i * 3, x0, y0, z0 );
+		LoadVec3x8( src1Ptr + i * 3, x1, y1, z1 );
+		_mm256_storeu_ps( dst + i, _mm256_fmadd_ps( x0, x1, _mm256_fmadd_ps( y0, y1, _mm256_mul_ps( z0, z1 ) ) ) );
+	}
+	for ( ; i < count; i++ ) {
+		dst[i] = src0[i] * src1[i];
+	}
+}
+
+/*
+============
+idSIMD_AVX2::Dot
+
+  dot = src1[0] * src2[0] + src1[1] * src2[1] + src1[2] * src2[2] + ...
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::Dot( float &dot, const float *src1, const float *src2, const int count ) {
+	__m256 sum0 = _mm256_setzero_ps();
+	__m256 sum1 = _mm256_setzero_ps();
+	int i;
+
+	for ( i = 0; i + 16 <= count; i += 16 ) {
+		sum0 = _mm256_fmadd_ps( _mm256_loadu_ps( src1 + i + 0 ), _mm256_loadu_ps( src2 + i + 0 ), sum0 );
+		sum1 = _mm256_fmadd_ps( _mm256_loadu_ps( src1 + i + 8 ), _mm256_loadu_ps( src2 + i + 8 ), sum1 );
+	}
+	if ( i + 8 <= count ) {
+		sum0 = _mm256_fmadd_ps( _mm256_loadu_ps( src1 + i ), _mm256_loadu_ps( src2 + i ), sum0 );
+		i += 8;
+	}
+	float s = HorizontalAdd( _mm256_add_ps( sum0, sum1 ) );
+	for ( ; i < count; i++ ) {
+		s += src1[i] * src2[i];
+	}
+	dot = s;
+}
+
+/*
+============
+idSIMD_AVX2::MinMax
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MinMax( float &min, float &max, const float *src, const int count ) {
+	__m256 vmin = _mm256_set1_ps( idMath::INFINITY );
+	__m256 vmax = _mm256_set1_ps( -idMath::INFINITY );
+	int i;
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		const __m256 v = _mm256_loadu_ps( src + i );
+		vmin = _mm256_min_ps( vmin, v );
+		vmax = _mm256_max_ps( vmax, v );
+	}
+	min = HorizontalMin( vmin );
+	max = HorizontalMax( vmax );
+	for ( ; i < count; i++ ) {
+		if ( src[i] < min ) {
+			min = src[i];
+		}
+		if ( src[i] > max ) {
+			max = src[i];
+		}
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MinMax
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MinMax( idVec2 &min, idVec2 &max, const idVec2 *src, const int count ) {
+	__m256 vmin = _mm256_set1_ps( idMath::INFINITY );
+	__m256 vmax = _mm256_set1_ps( -idMath::INFINITY );
+	const float *srcPtr = src->ToFloatPtr();
+	int i;
+
+	// four idVec2 per register, x in the even and y in the odd elements
+	for ( i = 0; i + 4 <= count; i += 4 ) {
+		const __m256 v = _mm256_loadu_ps( srcPtr + i * 2 );
+		vmin = _mm256_min_ps( vmin, v );
+		vmax = _mm256_max_ps( vmax, v );
+	}
+	__m128 m = _mm_min_ps( _mm256_castps256_ps128( vmin ), _mm256_extractf128_ps( vmin, 1 ) );
+	m = _mm_min_ps( m, _mm_movehl_ps( m, m ) );
+	__m128 n = _mm_max_ps( _mm256_castps256_ps128( vmax ), _mm256_extractf128_ps( vmax, 1 ) );
+	n = _mm_max_ps( n, _mm_movehl_ps( n, n ) );
+	_mm_storel_pi( (__m64 *) min.ToFloatPtr(), m );
+	_mm_storel_pi( (__m64 *) max.ToFloatPtr(), n );
+
+	for ( ; i < count; i++ ) {
+		const idVec2 &v = src[i];
+		if ( v[0] < min[0] ) {
+			min[0] = v[0];
+		}
+		if ( v[0] > max[0] ) {
+			max[0] = v[0];
+		}
+		if ( v[1] < min[1] ) {
+			min[1] = v[1];
+		}
+		if ( v[1] > max[1] ) {
+			max[1] = v[1];
+		}
+	}
+}
+
+/*
+============
+MinMaxTail
+
+  scalar part of the idVec3 min/max functions
+============
+*/
+static ID_INLINE void MinMaxTail( idVec3 &min, idVec3 &max, const idVec3 &v ) {
+	if ( v[0] < min[0] ) {
+		min[0] = v[0];
+	}
+	if ( v[0] > max[0] ) {
+		max[0] = v[0];
+	}
+	if ( v[1] < min[1] ) {
+		min[1] = v[1];
+	}
+	if ( v[1] > max[1] ) {
+		max[1] = v[1];
+	}
+	if ( v[2] < min[2] ) {
+		min[2] = v[2];
+	}
+	if ( v[2] > max[2] ) {
+		max[2] = v[2];
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MinMax
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MinMax( idVec3 &min, idVec3 &max, const idVec3 *src, const int count ) {
+	__m256 minX, minY, minZ, maxX, maxY, maxZ;
+	const float *srcPtr = src->ToFloatPtr();
+	int i;
+
+	minX = minY = minZ = _mm256_set1_ps( idMath::INFINITY );
+	maxX = maxY = maxZ = _mm256_set1_ps( -idMath::INFINITY );
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		__m256 x, y, z;
+		LoadVec3x8( srcPtr + i * 3, x, y, z );
+		minX = _mm256_min_ps( minX, x );
+		minY = _mm256_min_ps( minY, y );
+		minZ = _mm256_min_ps( minZ, z );
+		maxX = _mm256_max_ps( maxX, x );
+		maxY = _mm256_max_ps( maxY, y );
+		maxZ = _mm256_max_ps( maxZ, z );
+	}
+	min.Set( HorizontalMin( minX ), HorizontalMin( minY ), HorizontalMin( minZ ) );
+	max.Set( HorizontalMax( maxX ), HorizontalMax( maxY ), HorizontalMax( maxZ ) );
+
+	for ( ; i < count; i++ ) {
+		MinMaxTail( min, max, src[i] );
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MinMax
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MinMax( idVec3 &min, idVec3 &max, const idDrawVert *src, const int count ) {
+	__m256 minX, minY, minZ, maxX, maxY, maxZ;
+	const __m256i offsets = _mm256_mullo_epi32( _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ), _mm256_set1_epi32( DRAWVERT_FLOATS ) );
+	const float *srcPtr = src->xyz.ToFloatPtr();
+	int i;
+
+	minX = minY = minZ = _mm256_set1_ps( idMath::INFINITY );
+	maxX = maxY = maxZ = _mm256_set1_ps( -idMath::INFINITY );
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		__m256 x, y, z;
+		GatherVec3x8( srcPtr + i * DRAWVERT_FLOATS, offsets, x, y, z );
+		minX = _mm256_min_ps( minX, x );
+		minY = _mm256_min_ps( minY, y );
+		minZ = _mm256_min_ps( minZ, z );
+		maxX = _mm256_max_ps( maxX, x );
+		maxY = _mm256_max_ps( maxY, y );
+		maxZ = _mm256_max_ps( maxZ, z );
+	}
+	min.Set( HorizontalMin( minX ), HorizontalMin( minY ), HorizontalMin( minZ ) );
+	max.Set( HorizontalMax( maxX ), HorizontalMax( maxY ), HorizontalMax( maxZ ) );
+
+	for ( ; i < count; i++ ) {
+		MinMaxTail( min, max, src[i].xyz );
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MinMax
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MinMax( idVec3 &min, idVec3 &max, const idDrawVert *src, const int *indexes, const int count ) {
+	__m256 minX, minY, minZ, maxX, maxY, maxZ;
+	const __m256i vertFloats = _mm256_set1_epi32( DRAWVERT_FLOATS );
+	const float *srcPtr = src->xyz.ToFloatPtr();
+	int i;
+
+	minX = minY = minZ = _mm256_set1_ps( idMath::INFINITY );
+	maxX = maxY = maxZ = _mm256_set1_ps( -idMath::INFINITY );
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		__m256 x, y, z;
+		const __m256i offsets = _mm256_mullo_epi32( _mm256_loadu_si256( (const __m256i *) ( indexes + i ) ), vertFloats );
+		GatherVec3x8( srcPtr, offsets, x, y, z );
+		minX = _mm256_min_ps( minX, x );
+		minY = _mm256_min_ps( minY, y );
+		minZ = _mm256_min_ps( minZ, z );
+		maxX = _mm256_max_ps( maxX, x );
+		maxY = _mm256_max_ps( maxY, y );
+		maxZ = _mm256_max_ps( maxZ, z );
+	}
+	min.Set( HorizontalMin( minX ), HorizontalMin( minY ), HorizontalMin( minZ ) );
+	max.Set( HorizontalMax( maxX ), HorizontalMax( maxY ), HorizontalMax( maxZ ) );
+
+	for ( ; i < count; i++ ) {
+		MinMaxTail( min, max, src[indexes[i]].xyz );
+	}
+}
+
+/*
+============
+idSIMD_AVX2::Mul
+
+  dst[i] = src0[i] * src1[i];
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::Mul( float *dst, const float *src0, const float *src1, const int count ) {
+	int i;
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		_mm256_storeu_ps( dst + i, _mm256_mul_ps( _mm256_loadu_ps( src0 + i ), _mm256_loadu_ps( src1 + i ) ) );
+	}
+	for ( ; i < count; i++ ) {
+		dst[i] = src0[i] * src1[i];
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MulAdd
+
+  dst[i] += constant * src[i];
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MulAdd( float *dst, const float constant, const float *src, const int count ) {
+	const __m256 c = _mm256_set1_ps( constant );
+	int i;
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		_mm256_storeu_ps( dst + i, _mm256_fmadd_ps( c, _mm256_loadu_ps( src + i ), _mm256_loadu_ps( dst + i ) ) );
+	}
+	for ( ; i < count; i++ ) {
+		dst[i] += constant * src[i];
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MulSub
+
+  dst[i] -= constant * src[i];
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MulSub( float *dst, const float constant, const float *src, const int count ) {
+	const __m256 c = _mm256_set1_ps( constant );
+	int i;
+
+	for ( i = 0; i + 8 <= count; i += 8 ) {
+		_mm256_storeu_ps( dst + i, _mm256_fnmadd_ps( c, _mm256_loadu_ps( src + i ), _mm256_loadu_ps( dst + i ) ) );
+	}
+	for ( ; i < count; i++ ) {
+		dst[i] -= constant * src[i];
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MatX_LowerTriangularSolve
+
+  solves x in Lx = b for the n * n sub-matrix of L
+  if skip > 0 the first skip elements of x are assumed to be valid already
+  L has to be a lower triangular matrix with (implicit) ones on the diagonal
+  x == b is allowed
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MatX_LowerTriangularSolve( const idMatX &L, float *x, const float *b, const int n, int skip ) {
+	int i, nc;
+	const float *lptr;
+
+	if ( skip >= n ) {
+		return;
+	}
+
+	// the unrolled small cases are faster than setting up the vectors
+	if ( n < 8 ) {
+		idSIMD_SSE3::MatX_LowerTriangularSolve( L, x, b, n, skip );
+		return;
+	}
+
+	nc = L.GetNumColumns();
+	lptr = L[skip];
+
+	for ( i = skip; i < n; i++ ) {
+		x[i] = b[i] - RowDot( lptr, x, i );
+		lptr += nc;
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MatX_LowerTriangularSolveTranspose
+
+  solves x in L'x = b for the n * n sub-matrix of L
+  L has to be a lower triangular matrix with (implicit) ones on the diagonal
+  x == b is allowed
+
+  the columns of L' are the rows of L, so as soon as an element of x is
+  known it is subtracted from all elements above it with a row of L
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MatX_LowerTriangularSolveTranspose( const idMatX &L, float *x, const float *b, const int n ) {
+	int i, j;
+	const float *lptr;
+
+	if ( n < 8 ) {
+		idSIMD_SSE3::MatX_LowerTriangularSolveTranspose( L, x, b, n );
+		return;
+	}
+
+	if ( x != b ) {
+		memcpy( x, b, n * sizeof( float ) );
+	}
+
+	for ( i = n - 1; i > 0; i-- ) {
+		const __m256 xi = _mm256_set1_ps( x[i] );
+		lptr = L[i];
+		for ( j = 0; j + 8 <= i; j += 8 ) {
+			_mm256_storeu_ps( x + j, _mm256_fnmadd_ps( _mm256_loadu_ps( lptr + j ), xi, _mm256_loadu_ps( x + j ) ) );
+		}
+		for ( ; j < i; j++ ) {
+			x[j] -= lptr[j] * x[i];
+		}
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MatX_LDLTFactor
+
+  in-place factorization LDL' of the n * n sub-matrix of mat
+  the reciprocal of the diagonal elements are stored in invDiag
+============
+*/
+AVX2_FUNC bool VPCALL idSIMD_AVX2::MatX_LDLTFactor( idMatX &mat, idVecX &invDiag, const int n ) {
+	int i, j, k, nc;
+	float *v, *diag, *mptr;
+	float sum, d;
+
+	if ( n < 8 ) {
+		return idSIMD_SSE3::MatX_LDLTFactor( mat, invDiag, n );
+	}
+
+	v = (float *) _alloca16( n * sizeof( float ) );
+	diag = (float *) _alloca16( n * sizeof( float ) );
+
+	nc = mat.GetNumColumns();
+
+	for ( i = 0; i < n; i++ ) {
+
+		mptr = mat[i];
+
+		// v = D * row i of L, the row of L times v is subtracted from the diagonal
+		__m256 s = _mm256_setzero_ps();
+		for ( k = 0; k + 8 <= i; k += 8 ) {
+			const __m256 m = _mm256_loadu_ps( mptr + k );
+			const __m256 t = _mm256_mul_ps( _mm256_loadu_ps( diag + k ), m );
+			_mm256_storeu_ps( v + k, t );
+			s = _mm256_fmadd_ps( t, m, s );
+		}
+		sum = HorizontalAdd( s );
+		for ( ; k < i; k++ ) {
+			v[k] = diag[k] * mptr[k];
+			sum += v[k] * mptr[k];
+		}
+		sum = mptr[i] - sum;
+
+		if ( sum == 0.0f ) {
+			return false;
+		}
+
+		mptr[i] = sum;
+		diag[i] = sum;
+		invDiag[i] = d = 1.0f / sum;
+
+		// column i of L below the diagonal
+		mptr += nc;
+		for ( j = i + 1; j < n; j++ ) {
+			mptr[i] = ( mptr[i] - RowDot( mptr, v, i ) ) * d;
+			mptr += nc;
+		}
+	}
+
+	return true;
+}
+
+/*
+============
+Sin16x8 / ATan16x8
+
+  vectorized idMath::Sin16 and idMath::ATan16( y, x ) for the limited input range
+  used by the quaternion slerp: the angle is in [0, PI/2] and x, y are positive
+============
+*/
+AVX2_FUNC static ID_INLINE __m256 Sin16x8( const __m256 a ) {
+	const __m256 s = _mm256_mul_ps( a, a );
+	__m256 p = _mm256_fmadd_ps( _mm256_set1_ps( -2.39e-08f ), s, _mm256_set1_ps( 2.7526e-06f ) );
+	p = _mm256_fmadd_ps( p, s, _mm256_set1_ps( -1.98409e-04f ) );
+	p = _mm256_fmadd_ps( p, s, _mm256_set1_ps( 8.3333315e-03f ) );
+	p = _mm256_fmadd_ps( p, s, _mm256_set1_ps( -1.666666664e-01f ) );
+	p = _mm256_fmadd_ps( p, s, _mm256_set1_ps( 1.0f ) );
+	return _mm256_mul_ps( a, p );
+}
+
+AVX2_FUNC static ID_INLINE __m256 ATan16x8( const __m256 y, const __m256 x ) {
+	const __m256 swap = _mm256_cmp_ps( y, x, _CMP_GT_OQ );
+	const __m256 a = _mm256_div_ps( _mm256_min_ps( x, y ), _mm256_max_ps( x, y ) );
+	const __m256 s = _mm256_mul_ps( a, a );
+	__m256 p = _mm256_fmadd_ps( _mm256_set1_ps( 0.0028662257f ), s, _mm256_set1_ps( -0.0161657367f ) );
+	p = _mm256_fmadd_ps( p, s, _mm256_set1_ps( 0.0429096138f ) );
+	p = _mm256_fmadd_ps( p, s, _mm256_set1_ps( -0.0752896400f ) );
+	p = _mm256_fmadd_ps( p, s, _mm256_set1_ps( 0.1065626393f ) );
+	p = _mm256_fmadd_ps( p, s, _mm256_set1_ps( -0.1420889944f ) );
+	p = _mm256_fmadd_ps( p, s, _mm256_set1_ps( 0.1999355085f ) );
+	p = _mm256_fmadd_ps( p, s, _mm256_set1_ps( -0.3333314528f ) );
+	p = _mm256_fmadd_ps( p, s, _mm256_set1_ps( 1.0f ) );
+	const __m256 r = _mm256_mul_ps( p, a );
+	return _mm256_blendv_ps( r, _mm256_sub_ps( _mm256_set1_ps( idMath::HALF_PI ), r ), swap );
+}
+
+/*
+============
+idSIMD_AVX2::BlendJoints
+
+  slerps eight joints at a time, same math as idQuat::Slerp
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::BlendJoints( idJointQuat *joints, const idJointQuat *blendJoints, const float lerp, const int *index, const int numJoints ) {
+	int i;
+
+	if ( lerp <= 0.0f ) {
+		return;
+	} else if ( lerp >= 1.0f ) {
+		for ( i = 0; i < numJoints; i++ ) {
+			int j = index[i];
+			joints[j] = blendJoints[j];
+		}
+		return;
+	}
+
+	assert( sizeof( idJointQuat ) == JOINTQUAT_FLOATS * sizeof( float ) );
+
+	const __m256 vLerp = _mm256_set1_ps( lerp );
+	const __m256 vInvLerp = _mm256_set1_ps( 1.0f - lerp );
+	const __m256 one = _mm256_set1_ps( 1.0f );
+	const __m256 signMask = _mm256_set1_ps( -0.0f );
+	const __m256i jointFloats = _mm256_set1_epi32( JOINTQUAT_FLOATS );
+	const float *jointPtr = joints->q.ToFloatPtr();
+	const float *blendPtr = blendJoints->q.ToFloatPtr();
+
+	for ( i = 0; i + 8 <= numJoints; i += 8 ) {
+		ALIGN16( float result[JOINTQUAT_FLOATS][8] );
+
+		const __m256i offsets = _mm256_mullo_epi32( _mm256_loadu_si256( (const __m256i *) ( index + i ) ), jointFloats );
+
+		const __m256 fromX = _mm256_i32gather_ps( jointPtr + 0, offsets, 4 );
+		const __m256 fromY = _mm256_i32gather_ps( jointPtr + 1, offsets, 4 );
+		const __m256 fromZ = _mm256_i32gather_ps( jointPtr + 2, offsets, 4 );
+		const __m256 fromW = _mm256_i32gather_ps( jointPtr + 3, offsets, 4 );
+		__m256 toX = _mm256_i32gather_ps( blendPtr + 0, offsets, 4 );
+		__m256 toY = _mm256_i32gather_ps( blendPtr + 1, offsets, 4 );
+		__m256 toZ = _mm256_i32gather_ps( blendPtr + 2, offsets, 4 );
+		__m256 toW = _mm256_i32gather_ps( blendPtr + 3, offsets, 4 );
+
+		__m256 cosom = _mm256_fmadd_ps( fromX, toX, _mm256_fmadd_ps( fromY, toY, _mm256_fmadd_ps( fromZ, toZ, _mm256_mul_ps( fromW, toW ) ) ) );
+
+		// take the shortest path
+		const __m256 signBit = _mm256_and_ps( cosom, signMask );
+		cosom = _mm256_xor_ps( cosom, signBit );
+		toX = _mm256_xor_ps( toX, signBit );
+		toY = _mm256_xor_ps( toY, signBit );
+		toZ = _mm256_xor_ps( toZ, signBit );
+		toW = _mm256_xor_ps( toW, signBit );
+
+		__m256 scale0 = _mm256_fnmadd_ps( cosom, cosom, one );
+		const __m256 sinom = _mm256_div_ps( one, _mm256_sqrt_ps( scale0 ) );
+		const __m256 omega = ATan16x8( _mm256_mul_ps( scale0, sinom ), cosom );
+		scale0 = _mm256_mul_ps( Sin16x8( _mm256_mul_ps( vInvLerp, omega ) ), sinom );
+		__m256 scale1 = _mm256_mul_ps( Sin16x8( _mm256_mul_ps( vLerp, omega ) ), sinom );
+
+		// fall back to a linear blend for nearly identical rotations
+		const __m256 linear = _mm256_cmp_ps( _mm256_sub_ps( one, cosom ), _mm256_set1_ps( 1e-6f ), _CMP_LE_OQ );
+		scale0 = _mm256_blendv_ps( scale0, vInvLerp, linear );
+		scale1 = _mm256_blendv_ps( scale1, vLerp, linear );
+
+		_mm256_store_ps( result[0], _mm256_fmadd_ps( scale0, fromX, _mm256_mul_ps( scale1, toX ) ) );
+		_mm256_store_ps( result[1], _mm256_fmadd_ps( scale0, fromY, _mm256_mul_ps( scale1, toY ) ) );
+		_mm256_store_ps( result[2], _mm256_fmadd_ps( scale0, fromZ, _mm256_mul_ps( scale1, toZ ) ) );
+		_mm256_store_ps( result[3], _mm256_fmadd_ps( scale0, fromW, _mm256_mul_ps( scale1, toW ) ) );
+
+		for ( int k = 4; k < JOINTQUAT_FLOATS; k++ ) {
+			const __m256 from = _mm256_i32gather_ps( jointPtr + k, offsets, 4 );
+			const __m256 to = _mm256_i32gather_ps( blendPtr + k, offsets, 4 );
+			_mm256_store_ps( result[k], _mm256_fmadd_ps( vLerp, _mm256_sub_ps( to, from ), from ) );
+		}
+
+		for ( int k = 0; k < 8; k++ ) {
+			idJointQuat &joint = joints[index[i + k]];
+			joint.q.Set( result[0][k], result[1][k], result[2][k], result[3][k] );
+			joint.t.Set( result[4][k], result[5][k], result[6][k] );
+		}
+	}
+
+	for ( ; i < numJoints; i++ ) {
+		int j = index[i];
+		joints[j].q.Slerp( joints[j].q, blendJoints[j].q, lerp );
+		joints[j].t.Lerp( joints[j].t, blendJoints[j].t, lerp );
+	}
+}
+
+/*
+============
+idSIMD_AVX2::TransformJoints
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::TransformJoints( idJointMat *jointMats, const int *parents, const int firstJoint, const int lastJoint ) {
+	const __m128 axisW = _mm_setr_ps( 0.0f, 0.0f, 0.0f, 1.0f );
+	int i;
+
+	for( i = firstJoint; i <= lastJoint; i++ ) {
+		assert( parents[i] < i );
+
+		float *m = jointMats[i].ToFloatPtr();
+		const float *p = jointMats[parents[i]].ToFloatPtr();
+
+		const __m128 m0 = _mm_loadu_ps( m + 0 );
+		const __m128 m1 = _mm_loadu_ps( m + 4 );
+		const __m128 m2 = _mm_loadu_ps( m + 8 );
+
+		// each row of the result is a combination of the rows of the child, weighted by the parent row
+		for ( int r = 0; r < 3; r++ ) {
+			const float *pr = p + r * 4;
+			__m128 row = _mm_mul_ps( _mm_set1_ps( pr[3] ), axisW );
+			row = _mm_fmadd_ps( _mm_set1_ps( pr[2] ), m2, row );
+			row = _mm_fmadd_ps( _mm_set1_ps( pr[1] ), m1, row );
+			row = _mm_fmadd_ps( _mm_set1_ps( pr[0] ), m0, row );
+			_mm_storeu_ps( m + r * 4, row );
+		}
+	}
+}
+
+/*
+============
+idSIMD_AVX2::TransformVerts
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::TransformVerts( idDrawVert *verts, const int numVerts, const idJointMat *joints, const idVec4 *weights, const int *index, const int numWeights ) {
+	const byte *jointsPtr = (byte *)joints;
+	int i, j;
+
+	for( j = i = 0; i < numVerts; i++ ) {
+		// accumulate the weighted rows, the dot products are done once per vertex
+		__m256 row01 = _mm256_setzero_ps();
+		__m128 row2 = _mm_setzero_ps();
+
+		for ( ;; ) {
+			const float *m = ( (const idJointMat *) ( jointsPtr + index[j*2+0] ) )->ToFloatPtr();
+			const __m128 w = _mm_loadu_ps( weights[j].ToFloatPtr() );
+			row01 = _mm256_fmadd_ps( _mm256_loadu_ps( m ), _mm256_insertf128_ps( _mm256_castps128_ps256( w ), w, 1 ), row01 );
+			row2 = _mm_fmadd_ps( _mm_loadu_ps( m + 8 ), w, row2 );
+			if ( index[j*2+1] != 0 ) {
+				break;
+			}
+			j++;
+		}
+		j++;
+
+		const __m128 xy = _mm_hadd_ps( _mm256_castps256_ps128( row01 ), _mm256_extractf128_ps( row01, 1 ) );
+		const __m128 xyz = _mm_hadd_ps( xy, _mm_hadd_ps( row2, row2 ) );
+
+		float *v = verts[i].xyz.ToFloatPtr();
+		_mm_storel_pi( (__m64 *) v, xyz );
+		_mm_store_ss( v + 2, _mm_movehl_ps( xyz, xyz ) );
+	}
+}
+
+/*
+============
+idSIMD_AVX2::DeriveTangents
+
+	Derives the normal and orthogonal tangent vectors for the triangle vertices.
+	For each vertex the normal and tangent vectors are derived from all triangles
+	using the vertex which results in smooth tangents across the mesh.
+	In the process the triangle planes are calculated as well.
+
+	The per triangle math is done for eight triangles at a time, the accumulation
+	into the vertices is done serially because triangles share vertices.
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::DeriveTangents( idPlane *planes, idDrawVert *verts, const int numVerts, const int *indexes, const int numIndexes ) {
+	int i;
+
+	bool *used = (bool *)_alloca16( numVerts * sizeof( used[0] ) );
+	memset( used, 0, numVerts * sizeof( used[0] ) );
+
+	const int numTris = numIndexes / 3;
+	const __m256i triStride = _mm256_setr_epi32( 0, 3, 6, 9, 12, 15, 18, 21 );
+	const __m256i vertFloats = _mm256_set1_epi32( DRAWVERT_FLOATS );
+	const __m256 signMask = _mm256_set1_ps( -0.0f );
+	const float *vertPtr = verts->xyz.ToFloatPtr();
+
+	idPlane *planesPtr = planes;
+	for ( i = 0; i < numTris; ) {
+		ALIGN16( float n[3][8] );
+		ALIGN16( float t0[3][8] );
+		ALIGN16( float t1[3][8] );
+		int batch;
+
+		if ( i + 8 <= numTris ) {
+			const int *triIndexes = indexes + i * 3;
+			const __m256i offA = _mm256_mullo_epi32( _mm256_i32gather_epi32( triIndexes + 0, triStride, 4 ), vertFloats );
+			const __m256i offB = _mm256_mullo_epi32( _mm256_i32gather_epi32( triIndexes + 1, triStride, 4 ), vertFloats );
+			const __m256i offC = _mm256_mullo_epi32( _mm256_i32gather_epi32( triIndexes + 2, triStride, 4 ), vertFloats );
+
+			__m256 ax, ay, az, bx, by, bz, cx, cy, cz;
+			GatherVec3x8( vertPtr + DRAWVERT_XYZ_OFFSET, offA, ax, ay, az );
+			GatherVec3x8( vertPtr + DRAWVERT_XYZ_OFFSET, offB, bx, by, bz );
+			GatherVec3x8( vertPtr + DRAWVERT_XYZ_OFFSET, offC, cx, cy, cz );
+			const __m256 as = _mm256_i32gather_ps( vertPtr + DRAWVERT_ST_OFFSET + 0, offA, 4 );
+			const __m256 at = _mm256_i32gather_ps( vertPtr + DRAWVERT_ST_OFFSET + 1, offA, 4 );
+
+			const __m256 d0x = _mm256_sub_ps( bx, ax );
+			const __m256 d0y = _mm256_sub_ps( by, ay );
+			const __m256 d0z = _mm256_sub_ps( bz, az );
+			const __m256 d0s = _mm256_sub_ps( _mm256_i32gather_ps( vertPtr + DRAWVERT_ST_OFFSET + 0, offB, 4 ), as );
+			const __m256 d0t = _mm256_sub_ps( _mm256_i32gather_ps( vertPtr + DRAWVERT_ST_OFFSET + 1, offB, 4 ), at );
+
+			const __m256 d1x = _mm256_sub_ps( cx, ax );
+			const __m256 d1y = _mm256_sub_ps( cy, ay );
+			const __m256 d1z = _mm256_sub_ps( cz, az );
+			const __m256 d1s = _mm256_sub_ps( _mm256_i32gather_ps( vertPtr + DRAWVERT_ST_OFFSET + 0, offC, 4 ), as );
+			const __m256 d1t = _mm256_sub_ps( _mm256_i32gather_ps( vertPtr + DRAWVERT_ST_OFFSET + 1, offC, 4 ), at );
+
+			// no fused multiply-subtract for the cross products, otherwise degenerate
+			// triangles end up with a normalized rounding error instead of a zero vector
+
+			// normal
+			__m256 nx = _mm256_sub_ps( _mm256_mul_ps( d1y, d0z ), _mm256_mul_ps( d1z, d0y ) );
+			__m256 ny = _mm256_sub_ps( _mm256_mul_ps( d1z, d0x ), _mm256_mul_ps( d1x, d0z ) );
+			__m256 nz = _mm256_sub_ps( _mm256_mul_ps( d1x, d0y ), _mm256_mul_ps( d1y, d0x ) );
+
+			__m256 f = ReciprocalSqrt( _mm256_fmadd_ps( nx, nx, _mm256_fmadd_ps( ny, ny, _mm256_mul_ps( nz, nz ) ) ) );
+			nx = _mm256_mul_ps( nx, f );
+			ny = _mm256_mul_ps( ny, f );
+			nz = _mm256_mul_ps( nz, f );
+
+			// plane distance
+			const __m256 dist = _mm256_fmadd_ps( nx, ax, _mm256_fmadd_ps( ny, ay, _mm256_mul_ps( nz, az ) ) );
+			ALIGN16( float d[8] );
+			_mm256_store_ps( d, dist );
+
+			// area sign bit
+			const __m256 signBit = _mm256_and_ps( _mm256_sub_ps( _mm256_mul_ps( d0s, d1t ), _mm256_mul_ps( d0t, d1s ) ), signMask );
+
+			// first tangent
+			__m256 tx = _mm256_sub_ps( _mm256_mul_ps( d0x, d1t ), _mm256_mul_ps( d0t, d1x ) );
+			__m256 ty = _mm256_sub_ps( _mm256_mul_ps( d0y, d1t ), _mm256_mul_ps( d0t, d1y ) );
+			__m256 tz = _mm256_sub_ps( _mm256_mul_ps( d0z, d1t ), _mm256_mul_ps( d0t, d1z ) );
+
+			f = _mm256_xor_ps( ReciprocalSqrt( _mm256_fmadd_ps( tx, tx, _mm256_fmadd_ps( ty, ty, _mm256_mul_ps( tz, tz ) ) ) ), signBit );
+			_mm256_store_ps( t0[0], _mm256_mul_ps( tx, f ) );
+			_mm256_store_ps( t0[1], _mm256_mul_ps( ty, f ) );
+			_mm256_store_ps( t0[2], _mm256_mul_ps( tz, f ) );
+
+			// second tangent
+			tx = _mm256_sub_ps( _mm256_mul_ps( d0s, d1x ), _mm256_mul_ps( d0x, d1s ) );
+			ty = _mm256_sub_ps( _mm256_mul_ps( d0s, d1y ), _mm256_mul_ps( d0y, d1s ) );
+			tz = _mm256_sub_ps( _mm256_mul_ps( d0s, d1z ), _mm256_mul_ps( d0z, d1s ) );
+
+			f = _mm256_xor_ps( ReciprocalSqrt( _mm256_fmadd_ps( tx, tx, _mm256_fmadd_ps( ty, ty, _mm256_mul_ps( tz, tz ) ) ) ), signBit );
+			_mm256_store_ps( t1[0], _mm256_mul_ps( tx, f ) );
+			_mm256_store_ps( t1[1], _mm256_mul_ps( ty, f ) );
+			_mm256_store_ps( t1[2], _mm256_mul_ps( tz, f ) );
+
+			_mm256_store_ps( n[0], nx );
+			_mm256_store_ps( n[1], ny );
+			_mm256_store_ps( n[2], nz );
+
+			for ( int k = 0; k < 8; k++ ) {
+				planesPtr[k].SetNormal( idVec3( n[0][k], n[1][k], n[2][k] ) );
+				planesPtr[k].SetDist( d[k] );
+			}
+			batch = 8;
+		} else {
+			// remaining triangles go through the generic code path one at a time
+			idPlane plane;
+			idDrawVert *a = verts + indexes[i * 3 + 0];
+			idDrawVert *b = verts + indexes[i * 3 + 1];
+			idDrawVert *c = verts + indexes[i * 3 + 2];
+			float d0[5], d1[5], f, area;
+			unsigned int signBit;
+
+			d0[0] = b->xyz[0] - a->xyz[0];
+			d0[1] = b->xyz[1] - a->xyz[1];
+			d0[2] = b->xyz[2] - a->xyz[2];
+			d0[3] = b->st[0] - a->st[0];
+			d0[4] = b->st[1] - a->st[1];
+
+			d1[0] = c->xyz[0] - a->xyz[0];
+			d1[1] = c->xyz[1] - a->xyz[1];
+			d1[2] = c->xyz[2] - a->xyz[2];
+			d1[3] = c->st[0] - a->st[0];
+			d1[4] = c->st[1] - a->st[1];
+
+			idVec3 nv( d1[1] * d0[2] - d1[2] * d0[1], d1[2] * d0[0] - d1[0] * d0[2], d1[0] * d0[1] - d1[1] * d0[0] );
+			nv *= idMath::RSqrt( nv.LengthSqr() );
+			planesPtr->SetNormal( nv );
+			planesPtr->FitThroughPoint( a->xyz );
+
+			area = d0[3] * d1[4] - d0[4] * d1[3];
+			signBit = ( *(unsigned int *)&area ) & ( 1 << 31 );
+
+			idVec3 tv0( d0[0] * d1[4] - d0[4] * d1[0], d0[1] * d1[4] - d0[4] * d1[1], d0[2] * d1[4] - d0[4] * d1[2] );
+			f = idMath::RSqrt( tv0.LengthSqr() );
+			*(unsigned int *)&f ^= signBit;
+			tv0 *= f;
+
+			idVec3 tv1( d0[3] * d1[0] - d0[0] * d1[3], d0[3] * d1[1] - d0[1] * d1[3], d0[3] * d1[2] - d0[2] * d1[3] );
+			f = idMath::RSqrt( tv1.LengthSqr() );
+			*(unsigned int *)&f ^= signBit;
+			tv1 *= f;
+
+			for ( int k = 0; k < 3; k++ ) {
+				n[k][0] = nv[k];
+				t0[k][0] = tv0[k];
+				t1[k][0] = tv1[k];
+			}
+			batch = 1;
+		}
+
+		for ( int k = 0; k < batch; k++ ) {
+			const idVec3 nk( n[0][k], n[1][k], n[2][k] );
+			const idVec3 t0k( t0[0][k], t0[1][k], t0[2][k] );
+			const idVec3 t1k( t1[0][k], t1[1][k], t1[2][k] );
+
+			for ( int v = 0; v < 3; v++ ) {
+				const int vi = indexes[( i + k ) * 3 + v];
+				idDrawVert *dv = verts + vi;
+				if ( used[vi] ) {
+					dv->normal += nk;
+					dv->tangents[0] += t0k;
+					dv->tangents[1] += t1k;
+				} else {
+					dv->normal = nk;
+					dv->tangents[0] = t0k;
+					dv->tangents[1] = t1k;
+					used[vi] = true;
+				}
+			}
+		}
+
+		planesPtr += batch;
+		i += batch;
+	}
+}
+
+/*
+============
+idSIMD_AVX2::CreateShadowCache
+============
+*/
+AVX2_FUNC int VPCALL idSIMD_AVX2::CreateShadowCache( idVec4 *vertexCache, int *vertRemap, const idVec3 &lightOrigin, const idDrawVert *verts, const int numVerts ) {
+	const __m128 light = _mm_setr_ps( lightOrigin[0], lightOrigin[1], lightOrigin[2], 0.0f );
+	const __m128 oneW = _mm_setr_ps( 0.0f, 0.0f, 0.0f, 1.0f );
+	const __m256i zero = _mm256_setzero_si256();
+	int outVerts = 0;
+	int i = 0;
+
+	while ( i < numVerts ) {
+		// skip runs of vertices that were already remapped
+		if ( ( i & 7 ) == 0 && i + 8 <= numVerts ) {
+			const __m256i remap = _mm256_loadu_si256( (const __m256i *) ( vertRemap + i ) );
+			if ( _mm256_movemask_ps( _mm256_castsi256_ps( _mm256_cmpeq_epi32( remap, zero ) ) ) == 0 ) {
+				i += 8;
+				continue;
+			}
+		}
+		if ( vertRemap[i] ) {
+			i++;
+			continue;
+		}
+
+		// the xyz load picks up st[0] as the fourth component, which is cleared
+		const __m128 v = _mm_blend_ps( _mm_loadu_ps( verts[i].xyz.ToFloatPtr() ), _mm_setzero_ps(), 8 );
+
+		// R_SetupProjection() builds the projection matrix with a slight crunch
+		// for depth, which keeps this w=0 division from rasterizing right at the
+		// wrap around point and causing depth fighting with the rear caps
+		_mm_storeu_ps( vertexCache[outVerts+0].ToFloatPtr(), _mm_or_ps( v, oneW ) );
+		_mm_storeu_ps( vertexCache[outVerts+1].ToFloatPtr(), _mm_sub_ps( v, light ) );
+		vertRemap[i] = outVerts;
+		outVerts += 2;
+		i++;
+	}
+	return outVerts;
+}
+
+/*
+============
+idSIMD_AVX2::CreateVertexProgramShadowCache
+============
+*/
+AVX2_FUNC int VPCALL idSIMD_AVX2::CreateVertexProgramShadowCache( idVec4 *vertexCache, const idDrawVert *verts, const int numVerts ) {
+	const __m128 oneW = _mm_setr_ps( 0.0f, 0.0f, 0.0f, 1.0f );
+
+	for ( int i = 0; i < numVerts; i++ ) {
+		const __m128 v = _mm_blend_ps( _mm_loadu_ps( verts[i].xyz.ToFloatPtr() ), _mm_setzero_ps(), 8 );
+		_mm_storeu_ps( vertexCache[i*2+0].ToFloatPtr(), _mm_or_ps( v, oneW ) );
+		_mm_storeu_ps( vertexCache[i*2+1].ToFloatPtr(), v );
+	}
+	return numVerts * 2;
+}
+
+/*
+============
+idSIMD_AVX2::ShadowPointCull
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::ShadowPointCull( unsigned short *pointCull, const idPlane *planes, const int frontBits, const float epsilon, const idDrawVert *verts, const int numVerts ) {
+	const __m256i offsets = _mm256_mullo_epi32( _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ), _mm256_set1_epi32( DRAWVERT_FLOATS ) );
+	const __m256 posEpsilon = _mm256_set1_ps( epsilon );
+	const __m256 negEpsilon = _mm256_set1_ps( -epsilon );
+	const float *srcPtr = verts->xyz.ToFloatPtr();
+	int i, j;
+
+	assert( sizeof( idDrawVert ) == DRAWVERT_FLOATS * sizeof( float ) );
+
+	for ( i = 0; i + 8 <= numVerts; i += 8 ) {
+		__m256 x, y, z;
+		GatherVec3x8( srcPtr + i * DRAWVERT_FLOATS, offsets, x, y, z );
+
+		__m256i bits = _mm256_set1_epi32( frontBits );
+		for ( j = 0; j < 6; j++ ) {
+			if ( frontBits & ( 1 << ( j + 6 ) ) ) {
+				continue;
+			}
+			const __m256 d = _mm256_fmadd_ps( x, _mm256_set1_ps( planes[j][0] ),
+								_mm256_fmadd_ps( y, _mm256_set1_ps( planes[j][1] ),
+								_mm256_fmadd_ps( z, _mm256_set1_ps( planes[j][2] ), _mm256_set1_ps( planes[j][3] ) ) ) );
+			const __m256i outside = _mm256_castps_si256( _mm256_cmp_ps( d, posEpsilon, _CMP_LT_OQ ) );
+			const __m256i inside = _mm256_castps_si256( _mm256_cmp_ps( d, negEpsilon, _CMP_GT_OQ ) );
+			bits = _mm256_or_si256( bits, _mm256_and_si256( outside, _mm256_set1_epi32( 1 << j ) ) );
+			bits = _mm256_or_si256( bits, _mm256_and_si256( inside, _mm256_set1_epi32( 1 << ( j + 6 ) ) ) );
+		}
+
+		const __m128i packed = _mm_packus_epi32( _mm256_castsi256_si128( bits ), _mm256_extracti128_si256( bits, 1 ) );
+		_mm_storeu_si128( (__m128i *)( pointCull + i ), packed );
+	}
+
+	idSIMD_Generic::ShadowPointCull( pointCull + i, planes, frontBits, epsilon, verts + i, numVerts - i );
+}
+
+/*
+============
+idSIMD_AVX2::ShadowTriangleCull
+
+  gathers the point cull bits of eight triangles at a time, pointCull has
+  to be readable one element past the last vertex
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::ShadowTriangleCull( unsigned int *castBits, unsigned int *clipBits, const byte *facing, const unsigned short *pointCull, const int *indexes, const int numTris ) {
+	const __m256i offsets = _mm256_setr_epi32( 0, 3, 6, 9, 12, 15, 18, 21 );
+	const __m256i lowMask = _mm256_set1_epi32( 0x3f );
+	const __m256i highMask = _mm256_set1_epi32( 0xfc0 );
+	const __m256i shortMask = _mm256_set1_epi32( 0xffff );
+	const __m256i zero = _mm256_setzero_si256();
+	int i, j;
+
+	for ( i = 0; i + 32 <= numTris; i += 32 ) {
+		unsigned int cast = 0;
+		unsigned int clip = 0;
+
+		for ( j = 0; j < 32; j += 8 ) {
+			const int *tri = indexes + ( i + j ) * 3;
+			const __m256i i1 = _mm256_i32gather_epi32( tri + 0, offsets, 4 );
+			const __m256i i2 = _mm256_i32gather_epi32( tri + 1, offsets, 4 );
+			const __m256i i3 = _mm256_i32gather_epi32( tri + 2, offsets, 4 );
+			const __m256i c1 = _mm256_i32gather_epi32( (const int *)pointCull, i1, 2 );
+			const __m256i c2 = _mm256_i32gather_epi32( (const int *)pointCull, i2, 2 );
+			const __m256i c3 = _mm256_i32gather_epi32( (const int *)pointCull, i3, 2 );
+			const __m256i c = _mm256_and_si256( _mm256_and_si256( c1, c2 ), _mm256_and_si256( c3, shortMask ) );
+
+			const __m256i f = _mm256_cvtepu8_epi32( _mm_loadl_epi64( (const __m128i *)( facing + i + j ) ) );
+			const __m256i notCulled = _mm256_cmpeq_epi32( _mm256_and_si256( c, lowMask ), zero );
+			const __m256i notFacing = _mm256_cmpeq_epi32( f, zero );
+			const __m256i notClipped = _mm256_cmpeq_epi32( _mm256_and_si256( c, highMask ), highMask );
+
+			cast |= (unsigned int)_mm256_movemask_ps( _mm256_castsi256_ps( _mm256_and_si256( notCulled, notFacing ) ) ) << j;
+			clip |= (unsigned int)( ~_mm256_movemask_ps( _mm256_castsi256_ps( notClipped ) ) & 0xff ) << j;
+		}
+
+		castBits[i >> 5] = cast;
+		clipBits[i >> 5] = clip;
+	}
+
+	if ( i < numTris ) {
+		castBits[i >> 5] = 0;
+		clipBits[i >> 5] = 0;
+		for ( ; i < numTris; i++ ) {
+			int c = pointCull[indexes[i*3+0]] & pointCull[indexes[i*3+1]] & pointCull[indexes[i*3+2]];
+			unsigned int bit = 1u << ( i & 31 );
+
+			if ( !facing[i] && !( c & 0x3f ) ) {
+				castBits[i >> 5] |= bit;
+			}
+			if ( ( c & 0xfc0 ) != 0xfc0 ) {
+				clipBits[i >> 5] |= bit;
+			}
+		}
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MixSoundTwoSpeakerMono
+
+  four samples per iteration, the left and right gains are interleaved like the mix buffer
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MixSoundTwoSpeakerMono( float *mixBuffer, const float *samples, const int numSamples, const float lastV[2], const float currentV[2] ) {
+	const float incL = ( currentV[0] - lastV[0] ) / MIXBUFFER_SAMPLES;
+	const float incR = ( currentV[1] - lastV[1] ) / MIXBUFFER_SAMPLES;
+	const __m256i dup = _mm256_setr_epi32( 0, 0, 1, 1, 2, 2, 3, 3 );
+	const __m256 inc = _mm256_setr_ps( 4*incL, 4*incR, 4*incL, 4*incR, 4*incL, 4*incR, 4*incL, 4*incR );
+	__m256 gain = _mm256_setr_ps( lastV[0], lastV[1], lastV[0] + incL, lastV[1] + incR,
+								lastV[0] + 2*incL, lastV[1] + 2*incR, lastV[0] + 3*incL, lastV[1] + 3*incR );
+
+	assert( numSamples == MIXBUFFER_SAMPLES );
+
+	for( int j = 0; j < MIXBUFFER_SAMPLES; j += 4 ) {
+		const __m256 s = _mm256_permutevar8x32_ps( _mm256_castps128_ps256( _mm_loadu_ps( samples + j ) ), dup );
+		_mm256_storeu_ps( mixBuffer + j*2, _mm256_fmadd_ps( s, gain, _mm256_loadu_ps( mixBuffer + j*2 ) ) );
+		gain = _mm256_add_ps( gain, inc );
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MixSoundTwoSpeakerStereo
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MixSoundTwoSpeakerStereo( float *mixBuffer, const float *samples, const int numSamples, const float lastV[2], const float currentV[2] ) {
+	const float incL = ( currentV[0] - lastV[0] ) / MIXBUFFER_SAMPLES;
+	const float incR = ( currentV[1] - lastV[1] ) / MIXBUFFER_SAMPLES;
+	const __m256 inc = _mm256_setr_ps( 4*incL, 4*incR, 4*incL, 4*incR, 4*incL, 4*incR, 4*incL, 4*incR );
+	__m256 gain = _mm256_setr_ps( lastV[0], lastV[1], lastV[0] + incL, lastV[1] + incR,
+								lastV[0] + 2*incL, lastV[1] + 2*incR, lastV[0] + 3*incL, lastV[1] + 3*incR );
+
+	assert( numSamples == MIXBUFFER_SAMPLES );
+
+	for( int j = 0; j < MIXBUFFER_SAMPLES; j += 4 ) {
+		_mm256_storeu_ps( mixBuffer + j*2, _mm256_fmadd_ps( _mm256_loadu_ps( samples + j*2 ), gain, _mm256_loadu_ps( mixBuffer + j*2 ) ) );
+		gain = _mm256_add_ps( gain, inc );
+	}
+}
+
+/*
+============
+SixSpeakerGains
+
+  sets up the gains of four consecutive samples laid out like the six channel mix buffer
+============
+*/
+AVX2_FUNC static ID_INLINE void SixSpeakerGains( const float lastV[6], const float currentV[6], __m256 gain[3], __m256 inc[3] ) {
+	ALIGN16( float g[24] );
+	ALIGN16( float d[24] );
+	float speakerInc[6];
+
+	for ( int c = 0; c < 6; c++ ) {
+		speakerInc[c] = ( currentV[c] - lastV[c] ) / MIXBUFFER_SAMPLES;
+	}
+	for ( int s = 0; s < 4; s++ ) {
+		for ( int c = 0; c < 6; c++ ) {
+			g[s*6+c] = lastV[c] + s * speakerInc[c];
+			d[s*6+c] = 4 * speakerInc[c];
+		}
+	}
+	for ( int k = 0; k < 3; k++ ) {
+		gain[k] = _mm256_loadu_ps( g + k * 8 );
+		inc[k] = _mm256_loadu_ps( d + k * 8 );
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MixSoundSixSpeakerMono
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MixSoundSixSpeakerMono( float *mixBuffer, const float *samples, const int numSamples, const float lastV[6], const float currentV[6] ) {
+	const __m256i spread0 = _mm256_setr_epi32( 0, 0, 0, 0, 0, 0, 1, 1 );
+	const __m256i spread1 = _mm256_setr_epi32( 1, 1, 1, 1, 2, 2, 2, 2 );
+	const __m256i spread2 = _mm256_setr_epi32( 2, 2, 3, 3, 3, 3, 3, 3 );
+	__m256 gain[3], inc[3];
+
+	assert( numSamples == MIXBUFFER_SAMPLES );
+
+	SixSpeakerGains( lastV, currentV, gain, inc );
+
+	for( int i = 0; i < MIXBUFFER_SAMPLES; i += 4 ) {
+		const __m256 s = _mm256_castps128_ps256( _mm_loadu_ps( samples + i ) );
+		float *mix = mixBuffer + i*6;
+		_mm256_storeu_ps( mix +  0, _mm256_fmadd_ps( _mm256_permutevar8x32_ps( s, spread0 ), gain[0], _mm256_loadu_ps( mix +  0 ) ) );
+		_mm256_storeu_ps( mix +  8, _mm256_fmadd_ps( _mm256_permutevar8x32_ps( s, spread1 ), gain[1], _mm256_loadu_ps( mix +  8 ) ) );
+		_mm256_storeu_ps( mix + 16, _mm256_fmadd_ps( _mm256_permutevar8x32_ps( s, spread2 ), gain[2], _mm256_loadu_ps( mix + 16 ) ) );
+		gain[0] = _mm256_add_ps( gain[0], inc[0] );
+		gain[1] = _mm256_add_ps( gain[1], inc[1] );
+		gain[2] = _mm256_add_ps( gain[2], inc[2] );
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MixSoundSixSpeakerStereo
+
+  the left sample goes to speakers 0, 2, 3 and 4, the right one to 1 and 5
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MixSoundSixSpeakerStereo( float *mixBuffer, const float *samples, const int numSamples, const float lastV[6], const float currentV[6] ) {
+	const __m256i spread0 = _mm256_setr_epi32( 0, 1, 0, 0, 0, 1, 2, 3 );
+	const __m256i spread1 = _mm256_setr_epi32( 2, 2, 2, 3, 4, 5, 4, 4 );
+	const __m256i spread2 = _mm256_setr_epi32( 4, 5, 6, 7, 6, 6, 6, 7 );
+	__m256 gain[3], inc[3];
+
+	assert( numSamples == MIXBUFFER_SAMPLES );
+
+	SixSpeakerGains( lastV, currentV, gain, inc );
+
+	for( int i = 0; i < MIXBUFFER_SAMPLES; i += 4 ) {
+		const __m256 s = _mm256_loadu_ps( samples + i*2 );
+		float *mix = mixBuffer + i*6;
+		_mm256_storeu_ps( mix +  0, _mm256_fmadd_ps( _mm256_permutevar8x32_ps( s, spread0 ), gain[0], _mm256_loadu_ps( mix +  0 ) ) );
+		_mm256_storeu_ps( mix +  8, _mm256_fmadd_ps( _mm256_permutevar8x32_ps( s, spread1 ), gain[1], _mm256_loadu_ps( mix +  8 ) ) );
+		_mm256_storeu_ps( mix + 16, _mm256_fmadd_ps( _mm256_permutevar8x32_ps( s, spread2 ), gain[2], _mm256_loadu_ps( mix + 16 ) ) );
+		gain[0] = _mm256_add_ps( gain[0], inc[0] );
+		gain[1] = _mm256_add_ps( gain[1], inc[1] );
+		gain[2] = _mm256_add_ps( gain[2], inc[2] );
+	}
+}
+
+/*
+============
+idSIMD_AVX2::MixedSoundToSamples
+============
+*/
+AVX2_FUNC void VPCALL idSIMD_AVX2::MixedSoundToSamples( short *samples, const float *mixBuffer, const int numSamples ) {
+	const __m256 minSample = _mm256_set1_ps( -32768.0f );
+	const __m256 maxSample = _mm256_set1_ps( 32767.0f );
+	int i;
+
+	for ( i = 0; i + 16 <= numSamples; i += 16 ) {
+		const __m256 f0 = _mm256_min_ps( _mm256_max_ps( _mm256_loadu_ps( mixBuffer + i + 0 ), minSample ), maxSample );
+		const __m256 f1 = _mm256_min_ps( _mm256_max_ps( _mm256_loadu_ps( mixBuffer + i + 8 ), minSample ), maxSample );
+		// packs works per 128 bit lane, so the 64 bit blocks have to be put back in order
+		const __m256i s = _mm256_packs_epi32( _mm256_cvttps_epi32( f0 ), _mm256_cvttps_epi32( f1 ) );
+		_mm256_storeu_si256( (__m256i *) ( samples + i ), _mm256_permute4x64_epi64( s, _MM_SHUFFLE( 3, 1, 2, 0 ) ) );
+	}
+	for ( ; i < numSamples; i++ ) {
+		if ( mixBuffer[i] <= -32768.0f ) {
+			samples[i] = -32768;
+		} else if ( mixBuffer[i] >= 32767.0f ) {
+			samples[i] = 32767;
+		} else {
+			samples[i] = (short) mixBuffer[i];
+		}
+	}
+}
+
+#endif /* ID_SIMD_AVX2 */
@@ -2845,6 +2845,65 @@ int VPCALL idSIMD_Generic::CreateVertexProgramShadowCache( idVec4 *vertexCache,
 	return numVerts * 2;
 }
 
+/*
+============
+idSIMD_Generic::ShadowPointCull
+
+  Bit j is set if the point is on or outside plane j, bit j+6 if it is on or inside.
+  Planes with their bit j+6 set in frontBits are known to have all points in front.
+============
+*/
+void VPCALL idSIMD_Generic::ShadowPointCull( unsigned short *pointCull, const idPlane *planes, const int frontBits, const float epsilon, const idDrawVert *verts, const int numVerts ) {
+	int i, j;
+
+	for ( i = 0; i < numVerts; i++ ) {
+		int bits = frontBits;
+		const idVec3 &v = verts[i].xyz;
+
+		for ( j = 0; j < 6; j++ ) {
+			if ( frontBits & ( 1 << ( j + 6 ) ) ) {
+				continue;
+			}
+			float d = planes[j].Distance( v );
+			if ( d < epsilon ) {
+				bits |= 1 << j;
+			}
+			if ( d > -epsilon ) {
+				bits |= 1 << ( j + 6 );
+			}
+		}
+		pointCull[i] = bits;
+	}
+}
+
+/*
+============
+idSIMD_Generic::ShadowTriangleCull
+
+  Packs one bit per triangle, 32 triangles per word.
+  castBits is set for triangles that don't face the light and are not completely
+  outside one of the planes, clipBits for triangles that cross one of the planes.
+============
+*/
+void VPCALL idSIMD_Generic::ShadowTriangleCull( unsigned int *castBits, unsigned int *clipBits, const byte *facing, const unsigned short *pointCull, const int *indexes, const int numTris ) {
+	int i;
+
+	memset( castBits, 0, ( ( numTris + 31 ) >> 5 ) * sizeof( castBits[0] ) );
+	memset( clipBits, 0, ( ( numTris + 31 ) >> 5 ) * sizeof( clipBits[0] ) );
+
+	for ( i = 0; i < numTris; i++ ) {
+		int c = pointCull[indexes[i*3+0]] & pointCull[indexes[i*3+1]] & pointCull[indexes[i*3+2]];
+		unsigned int bit = 1u << ( i & 31 );
+
+		if ( !facing[i] && !( c & 0x3f ) ) {
+			castBits[i >> 5] |= bit;
+		}
+		if ( ( c & 0xfc0 ) != 0xfc0 ) {
+			clipBits[i >> 5] |= bit;
+		}
+	}
+}
+
 /*
 ============
 idSIMD_Generic::UpSamplePCMTo44kHz
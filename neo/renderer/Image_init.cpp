@@ -1036,6 +1036,8 @@ void R_ReloadImages_f( const idCmdArgs &args ) {
 	bool	all;
 	bool	checkPrecompressed;
 
+	R_SyncRenderThread();
+
 	// this probably isn't necessary...
 	globalImages->ChangeTextureFilter();
 
@@ -1090,6 +1090,9 @@ void idInteraction::AddActiveInteraction( void ) {
 	// actually create the interaction if needed, building light and shadow surfaces as needed
 	if ( IsDeferred() ) {
 		CreateInteraction( model );
+	} else {
+		tr.pc.c_interactionCacheHits++;
+		tr.pc.c_interactionCacheSurfaces += numSurfaces;
 	}
 
 	R_GlobalPointToLocal( vEntity->modelMatrix, lightDef->globalLightOrigin, localLightOrigin );
@@ -498,6 +498,25 @@ idRenderModel *idRenderModelStatic::InstantiateDynamicModel( const struct render
 	return NULL;
 }
 
+/*
+================
+idRenderModelStatic::PrepareDynamicModel
+
+Models that don't split their instantiation do all the work here
+================
+*/
+idRenderModel *idRenderModelStatic::PrepareDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *cachedModel ) {
+	return InstantiateDynamicModel( ent, view, cachedModel );
+}
+
+/*
+================
+idRenderModelStatic::FinishDynamicModel
+================
+*/
+void idRenderModelStatic::FinishDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *snapshot ) const {
+}
+
 /*
 ================
 idRenderModelStatic::NumJoints
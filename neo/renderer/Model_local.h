@@ -84,6 +84,13 @@ public:
 	virtual const idJointQuat *	GetDefaultPose( void ) const;
 	virtual int					NearestJoint( int surfaceNum, int a, int b, int c ) const;
 	virtual idBounds			Bounds( const struct renderEntity_s *ent ) const;
+
+	// InstantiateDynamicModel in two steps for r_parallelDynamicModels
+	// PrepareDynamicModel does all allocations and must run on the front end thread,
+	// FinishDynamicModel only writes to the snapshot and may run on a job worker
+	virtual idRenderModel *		PrepareDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *cachedModel );
+	virtual void				FinishDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *snapshot ) const;
+
 	virtual void				ReadFromDemoFile( class idDemoFile *f );
 	virtual void				WriteToDemoFile( class idDemoFile *f );
 	virtual float				DepthHack() const;
@@ -180,7 +187,8 @@ public:
 								~idMD5Mesh();
 
 	void						ParseMesh( idLexer &parser, int numJoints, const idJointMat *joints );
-	void						UpdateSurface( const struct renderEntity_s *ent, const idJointMat *joints, modelSurface_t *surf );
+	void						PrepareSurface( const struct renderEntity_s *ent, modelSurface_t *surf );
+	void						DeformSurface( const struct renderEntity_s *ent, const idJointMat *joints, modelSurface_t *surf ) const;
 	idBounds					CalcBounds( const idJointMat *joints );
 	int							NearestJoint( int a, int b, int c ) const;
 	int							NumVerts( void ) const;
@@ -203,8 +211,8 @@ private:
 	struct deformInfo_s *		deformInfo;			// used to create srfTriangles_t from base frames and new vertexes
 	int							surfaceNum;			// number of the static surface created for this mesh
 #if !NEW_MESH_TRANSFORM
-	void						TransformVerts( idDrawVert *verts, const idJointMat *joints );
-	void						TransformScaledVerts( idDrawVert *verts, const idJointMat *joints, float scale );
+	void						TransformVerts( idDrawVert *verts, const idJointMat *joints ) const;
+	void						TransformScaledVerts( idDrawVert *verts, const idJointMat *joints, float scale ) const;
 #endif
 
 #if NEW_MESH_TRANSFORM
@@ -230,6 +238,8 @@ public:
 	virtual void				LoadModel();
 	virtual int					Memory() const;
 	virtual idRenderModel *		InstantiateDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *cachedModel );
+	virtual idRenderModel *		PrepareDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *cachedModel );
+	virtual void				FinishDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *snapshot ) const;
 	virtual int					NumJoints( void ) const;
 	virtual const idMD5Joint *	GetJoints( void ) const;
 	virtual jointHandle_t		GetJointHandle( const char *name ) const;
@@ -377,6 +387,8 @@ public:
 	virtual void				TouchData();
 	virtual dynamicModel_t		IsDynamicModel() const;
 	virtual idRenderModel *		InstantiateDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *cachedModel );
+	virtual idRenderModel *		PrepareDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *cachedModel );
+	virtual void				FinishDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *snapshot ) const;
 	virtual idBounds			Bounds( const struct renderEntity_s *ent ) const;
 	virtual float				DepthHack() const;
 	virtual int					Memory() const;
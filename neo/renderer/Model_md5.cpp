@@ -252,7 +252,7 @@ void idMD5Mesh::ParseMesh( idLexer &parser, int numJoints, const idJointMat *joi
 idMD5Mesh::TransformVerts
 ====================
 */
-void idMD5Mesh::TransformVerts( idDrawVert *verts, const idJointMat *entJoints ) {
+void idMD5Mesh::TransformVerts( idDrawVert *verts, const idJointMat *entJoints ) const {
 	SIMDProcessor->TransformVerts( verts, texCoords.Num(), entJoints, scaledWeights, weightIndex, numWeights );
 }
 
@@ -263,7 +263,7 @@ idMD5Mesh::TransformScaledVerts
 Special transform to make the mesh seem fat or skinny.  May be used for zombie deaths
 ====================
 */
-void idMD5Mesh::TransformScaledVerts( idDrawVert *verts, const idJointMat *entJoints, float scale ) {
+void idMD5Mesh::TransformScaledVerts( idDrawVert *verts, const idJointMat *entJoints, float scale ) const {
 	idVec4 *tmpScaledWeights = (idVec4 *) _alloca16( numWeights * sizeof( scaledWeights[0] ) );
 	//SIMDProcessor->Mul( tmpScaledWeights[0].ToFloatPtr(), scale, this->scaledWeights[0].ToFloatPtr(), numWeights * 4 );
 	// DG: for this effect to work, we must scale x, y, z but not w (when also scaling w it just shrinks)
@@ -281,11 +281,13 @@ void idMD5Mesh::TransformScaledVerts( idDrawVert *verts, const idJointMat *entJo
 
 /*
 ====================
-idMD5Mesh::UpdateSurface
+idMD5Mesh::PrepareSurface
+
+Sets up the surface geometry for DeformSurface, all allocations are done here
 ====================
 */
-void idMD5Mesh::UpdateSurface( const struct renderEntity_s *ent, const idJointMat *entJoints, modelSurface_t *surf ) {
-	int i, base;
+void idMD5Mesh::PrepareSurface( const struct renderEntity_s *ent, modelSurface_t *surf ) {
+	int i;
 	srfTriangles_t *tri;
 
 	tr.pc.c_deformedSurfaces++;
@@ -334,6 +336,23 @@ void idMD5Mesh::UpdateSurface( const struct renderEntity_s *ent, const idJointMa
 		}
 	}
 
+	// DeformSurface may derive the tangents on another thread
+	if ( !r_useDeferredTangents.GetBool() && tri->dominantTris == NULL && tri->facePlanes == NULL ) {
+		R_AllocStaticTriSurfPlanes( tri, tri->numIndexes );
+	}
+}
+
+/*
+====================
+idMD5Mesh::DeformSurface
+
+Skins the surface set up by PrepareSurface, safe to run on a job worker
+====================
+*/
+void idMD5Mesh::DeformSurface( const struct renderEntity_s *ent, const idJointMat *entJoints, modelSurface_t *surf ) const {
+	int i, base;
+	srfTriangles_t *tri = surf->geometry;
+
 	if ( ent->shaderParms[ SHADERPARM_MD5_SKINSCALE ] != 0.0f ) {
 		TransformScaledVerts( tri->verts, entJoints, ent->shaderParms[ SHADERPARM_MD5_SKINSCALE ] );
 	} else {
@@ -737,6 +756,17 @@ idRenderModelMD5::InstantiateDynamicModel
 ====================
 */
 idRenderModel *idRenderModelMD5::InstantiateDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *cachedModel ) {
+	idRenderModel *snapshot = PrepareDynamicModel( ent, view, cachedModel );
+	FinishDynamicModel( ent, view, snapshot );
+	return snapshot;
+}
+
+/*
+====================
+idRenderModelMD5::PrepareDynamicModel
+====================
+*/
+idRenderModel *idRenderModelMD5::PrepareDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *cachedModel ) {
 	int					i, surfaceNum;
 	idMD5Mesh			*mesh;
 	idRenderModelStatic	*staticModel;
@@ -820,10 +850,7 @@ idRenderModel *idRenderModelMD5::InstantiateDynamicModel( const struct renderEnt
 			surf->id = i;
 		}
 
-		mesh->UpdateSurface( ent, ent->joints, surf );
-
-		staticModel->bounds.AddPoint( surf->geometry->bounds[0] );
-		staticModel->bounds.AddPoint( surf->geometry->bounds[1] );
+		mesh->PrepareSurface( ent, surf );
 	}
 
 	this->staticModelInstance = staticModel;
@@ -831,6 +858,36 @@ idRenderModel *idRenderModelMD5::InstantiateDynamicModel( const struct renderEnt
 	return staticModel;
 }
 
+/*
+====================
+idRenderModelMD5::FinishDynamicModel
+
+Deforms the surfaces created by PrepareDynamicModel
+====================
+*/
+void idRenderModelMD5::FinishDynamicModel( const struct renderEntity_s *ent, const struct viewDef_s *view, idRenderModel *snapshot ) const {
+	if ( snapshot == NULL ) {
+		return;
+	}
+
+	assert( dynamic_cast<idRenderModelStatic *>(snapshot) != NULL );
+	idRenderModelStatic *staticModel = static_cast<idRenderModelStatic *>(snapshot);
+
+	for ( int i = 0; i < staticModel->surfaces.Num(); i++ ) {
+		modelSurface_t *surf = &staticModel->surfaces[i];
+
+		// overlay surfaces have negative ids and are added afterwards
+		if ( surf->id < 0 || surf->id >= meshes.Num() ) {
+			continue;
+		}
+
+		meshes[surf->id].DeformSurface( ent, ent->joints, surf );
+
+		staticModel->bounds.AddPoint( surf->geometry->bounds[0] );
+		staticModel->bounds.AddPoint( surf->geometry->bounds[1] );
+	}
+}
+
 /*
 ====================
 idRenderModelMD5::IsDynamicModel
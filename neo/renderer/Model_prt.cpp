@@ -69,6 +69,19 @@ idRenderModelPrt::InstantiateDynamicModel
 ====================
 */
 idRenderModel *idRenderModelPrt::InstantiateDynamicModel( const struct renderEntity_s *renderEntity, const struct viewDef_s *viewDef, idRenderModel *cachedModel ) {
+	idRenderModel *snapshot = PrepareDynamicModel( renderEntity, viewDef, cachedModel );
+	FinishDynamicModel( renderEntity, viewDef, snapshot );
+	return snapshot;
+}
+
+/*
+====================
+idRenderModelPrt::PrepareDynamicModel
+
+Allocates a surface for every stage
+====================
+*/
+idRenderModel *idRenderModelPrt::PrepareDynamicModel( const struct renderEntity_s *renderEntity, const struct viewDef_s *viewDef, idRenderModel *cachedModel ) {
 	idRenderModelStatic	*staticModel;
 
 	if ( cachedModel && !r_useCachedDynamicModels.GetBool() ) {
@@ -108,13 +121,6 @@ idRenderModel *idRenderModelPrt::InstantiateDynamicModel( const struct renderEnt
 		staticModel->InitEmpty( parametricParticle_SnapshotName );
 	}
 
-	particleGen_t g;
-
-	g.renderEnt = renderEntity;
-	g.renderView = &viewDef->renderView;
-	g.origin.Zero();
-	g.axis.Identity();
-
 	for ( int stageNum = 0; stageNum < particleSystem->stages.Num(); stageNum++ ) {
 		idParticleStage *stage = particleSystem->stages[stageNum];
 
@@ -129,15 +135,6 @@ idRenderModel *idRenderModelPrt::InstantiateDynamicModel( const struct renderEnt
 			continue;
 		}
 
-		idRandom steppingRandom, steppingRandom2;
-
-		int stageAge = g.renderView->time + renderEntity->shaderParms[SHADERPARM_TIMEOFFSET] * 1000 - stage->timeOffset * 1000;
-		int	stageCycle = stageAge / stage->cycleMsec;
-
-		// some particles will be in this cycle, some will be in the previous cycle
-		steppingRandom.SetSeed( (( stageCycle << 10 ) & idRandom::MAX_RAND) ^ (int)( renderEntity->shaderParms[SHADERPARM_DIVERSITY] * idRandom::MAX_RAND )  );
-		steppingRandom2.SetSeed( (( (stageCycle-1) << 10 ) & idRandom::MAX_RAND) ^ (int)( renderEntity->shaderParms[SHADERPARM_DIVERSITY] * idRandom::MAX_RAND )  );
-
 		int	count = stage->totalParticles * stage->NumQuadsPerParticle();
 
 		int surfaceNum;
@@ -155,6 +152,55 @@ idRenderModel *idRenderModelPrt::InstantiateDynamicModel( const struct renderEnt
 			R_AllocStaticTriSurfIndexes( surf->geometry, 6 * count );
 			R_AllocStaticTriSurfPlanes( surf->geometry, 6 * count );
 		}
+	}
+
+	return staticModel;
+}
+
+/*
+====================
+idRenderModelPrt::FinishDynamicModel
+
+Creates the particles of every stage prepared by PrepareDynamicModel
+====================
+*/
+void idRenderModelPrt::FinishDynamicModel( const struct renderEntity_s *renderEntity, const struct viewDef_s *viewDef, idRenderModel *snapshot ) const {
+	if ( snapshot == NULL ) {
+		return;
+	}
+
+	assert( dynamic_cast<idRenderModelStatic *>(snapshot) != NULL );
+	idRenderModelStatic *staticModel = static_cast<idRenderModelStatic *>(snapshot);
+
+	particleGen_t g;
+
+	g.renderEnt = renderEntity;
+	g.renderView = &viewDef->renderView;
+	g.origin.Zero();
+	g.axis.Identity();
+
+	for ( int surfaceNum = 0; surfaceNum < staticModel->surfaces.Num(); surfaceNum++ ) {
+		modelSurface_t *surf = &staticModel->surfaces[surfaceNum];
+
+		// skip overlays
+		if ( surf->id < 0 || surf->id >= particleSystem->stages.Num() ) {
+			continue;
+		}
+
+		const idParticleStage *stage = particleSystem->stages[surf->id];
+
+		if ( !stage->material || !stage->cycleMsec ) {
+			continue;
+		}
+
+		idRandom steppingRandom, steppingRandom2;
+
+		int stageAge = g.renderView->time + renderEntity->shaderParms[SHADERPARM_TIMEOFFSET] * 1000 - stage->timeOffset * 1000;
+		int	stageCycle = stageAge / stage->cycleMsec;
+
+		// some particles will be in this cycle, some will be in the previous cycle
+		steppingRandom.SetSeed( (( stageCycle << 10 ) & idRandom::MAX_RAND) ^ (int)( renderEntity->shaderParms[SHADERPARM_DIVERSITY] * idRandom::MAX_RAND )  );
+		steppingRandom2.SetSeed( (( (stageCycle-1) << 10 ) & idRandom::MAX_RAND) ^ (int)( renderEntity->shaderParms[SHADERPARM_DIVERSITY] * idRandom::MAX_RAND )  );
 
 		int numVerts = 0;
 		idDrawVert *verts = surf->geometry->verts;
@@ -215,7 +261,7 @@ idRenderModel *idRenderModelPrt::InstantiateDynamicModel( const struct renderEnt
 		}
 
 		// numVerts must be a multiple of 4
-		assert( ( numVerts & 3 ) == 0 && numVerts <= 4 * count );
+		assert( ( numVerts & 3 ) == 0 && numVerts <= 4 * stage->totalParticles * stage->NumQuadsPerParticle() );
 
 		// build the indexes
 		int	numIndexes = 0;
@@ -236,8 +282,6 @@ idRenderModel *idRenderModelPrt::InstantiateDynamicModel( const struct renderEnt
 		surf->geometry->numIndexes = numIndexes;
 		surf->geometry->bounds = stage->bounds;		// just always draw the particles
 	}
-
-	return staticModel;
 }
 
 /*
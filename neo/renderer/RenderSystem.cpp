@@ -96,6 +96,13 @@ static void R_PerformanceCounters( void ) {
 		common->Printf( "createInteractions:%i createLightTris:%i createShadowVolumes:%i\n",
 			tr.pc.c_createInteractions, tr.pc.c_createLightTris, tr.pc.c_createShadowVolumes );
 	}
+	if ( r_showInteractionCache.GetBool() ) {
+		int lookups = tr.pc.c_interactionCacheHits + tr.pc.c_createInteractions;
+		common->Printf( "interactionCache: hits:%i (%i surfs) misses:%i (%i%%)  kept entityUpdates:%i lightUpdates:%i\n",
+			tr.pc.c_interactionCacheHits, tr.pc.c_interactionCacheSurfaces, tr.pc.c_createInteractions,
+			lookups ? 100 * tr.pc.c_interactionCacheHits / lookups : 0,
+			tr.pc.c_entityUpdatesKept, tr.pc.c_lightUpdatesKept );
+	}
 	if ( r_showDefs.GetBool() ) {
 		common->Printf( "viewEntities:%i  shadowEntities:%i  viewLights:%i\n", tr.pc.c_visibleViewEntities,
 			tr.pc.c_shadowViewEntities, tr.pc.c_viewLights );
@@ -109,6 +116,9 @@ static void R_PerformanceCounters( void ) {
 		int	m1 = frameData ? frameData->memoryHighwater : 0;
 		common->Printf( "frameData: %i (%i)\n", R_CountFrameData(), m1 );
 	}
+	if ( r_showFrameMemory.GetBool() ) {
+		R_PrintFrameData();
+	}
 	if ( r_showLightScale.GetBool() ) {
 		common->Printf( "lightScale: %f\n", backEnd.pc.maxLightValue );
 	}
@@ -119,20 +129,93 @@ static void R_PerformanceCounters( void ) {
 
 
 
+/*
+=====================
+r_smp render thread
+
+The back end runs in its own thread with an OpenGL context that shares
+all objects with the main one, so the front end can keep uploading
+vertex caches and images while it builds the next frame.
+=====================
+*/
+
+static bool	smpActive = false;
+
+/*
+====================
+R_StartRenderThread
+====================
+*/
+static void R_StartRenderThread( void ) {
+	if ( smpActive ) {
+		return;
+	}
+
+	if ( !GLimp_SpawnRenderThread( RB_RenderThread ) ) {
+		common->Warning( "r_smp: couldn't start the render thread, running the back end on the main thread" );
+		r_smp.SetBool( false );
+		r_smp.ClearModified();
+		return;
+	}
+
+	smpActive = true;
+	common->Printf( "Running the render back end in a separate thread\n" );
+}
+
+/*
+====================
+R_ShutdownRenderThread
+
+The thread is started again by the next EndFrame if r_smp is still set
+====================
+*/
+void R_ShutdownRenderThread( void ) {
+	if ( !smpActive ) {
+		return;
+	}
+
+	GLimp_ShutdownRenderThread();
+	smpActive = false;
+
+	if ( r_smp.GetBool() ) {
+		r_smp.SetModified();
+	}
+}
+
+/*
+====================
+R_SyncRenderThread
+
+Anything that reads back from or changes objects the back end may
+still be using must call this first
+====================
+*/
+void R_SyncRenderThread( void ) {
+	if ( smpActive ) {
+		GLimp_FrontEndSleep();
+	}
+}
+
 /*
 ====================
 R_IssueRenderCommands
 
 Called by R_EndFrame each frame
+
+With r_smp the back end only keeps running after this returns if
+allowAsync is set, everything else expects the results to be there.
 ====================
 */
-static void R_IssueRenderCommands( void ) {
+static void R_IssueRenderCommands( bool allowAsync ) {
 	if ( frameData->cmdHead->commandId == RC_NOP
 		&& !frameData->cmdHead->next ) {
 		// nothing to issue
 		return;
 	}
 
+	// the back end may still be working on the previous frame
+	R_SyncRenderThread();
+
 	backEnd.scopeView = tr.IsScopeView();
 	backEnd.shuttleView = tr.IsShuttleView();
 
@@ -145,7 +228,26 @@ static void R_IssueRenderCommands( void ) {
 	// r_skipRender is usually more usefull, because it will still
 	// draw 2D graphics
 	if ( !r_skipBackEnd.GetBool() ) {
-		RB_ExecuteBackEndCommands( frameData->cmdHead );
+		if ( smpActive ) {
+			// ImGui menus are built by the main thread, so the next frame
+			// can't be started before the back end has drawn them
+			bool sync = !allowAsync || tr.takingScreenshot || D3::ImGuiHooks::IsFramePending();
+
+			backEnd.finishCommands = !allowAsync || tr.takingScreenshot;
+
+			// vertex cache and image uploads of the main context have to be
+			// complete before the other context can use them
+			qglFinish();
+
+			GLimp_WakeBackEnd( (void *)frameData->cmdHead );
+			if ( sync ) {
+				GLimp_FrontEndSleep();
+			}
+		} else if ( r_nullBackend.GetBool() ) {
+			RB_NullExecuteBackEndCommands( frameData->cmdHead );
+		} else {
+			RB_ExecuteBackEndCommands( frameData->cmdHead );
+		}
 	}
 
 	R_ClearCommandChain();
@@ -257,10 +359,25 @@ static void R_CheckCvars( void ) {
 	}
 
 	if ( r_swapInterval.IsModified() ) {
-		GLimp_SetSwapInterval( r_swapInterval.GetInteger() );
+		if ( smpActive ) {
+			// the swap interval belongs to the context of the render thread,
+			// which sets it up when it starts
+			R_ShutdownRenderThread();
+		} else {
+			GLimp_SetSwapInterval( r_swapInterval.GetInteger() );
+		}
 		r_swapInterval.ClearModified();
 	}
 
+	if ( r_smp.IsModified() ) {
+		r_smp.ClearModified();
+		if ( r_smp.GetBool() ) {
+			R_StartRenderThread();
+		} else {
+			R_ShutdownRenderThread();
+		}
+	}
+
 	if ( r_windowResizable.IsModified() ) {
 		GLimp_SetWindowResizable( r_windowResizable.GetBool() );
 		r_windowResizable.ClearModified();
@@ -661,12 +778,16 @@ Returns the number of msec spent in the back end
 =============
 */
 void idRenderSystemLocal::EndFrame( int *frontEndMsec, int *backEndMsec ) {
-	emptyCommand_t *cmd;
+	swapBuffersCommand_t *cmd;
 
 	if ( !glConfig.isInitialized ) {
 		return;
 	}
 
+	// the counters and the frame data of the previous frame are still
+	// in use until the render thread has finished it
+	R_SyncRenderThread();
+
 	// close any gui drawing
 	guiModel->EmitFullScreen();
 	guiModel->Clear();
@@ -689,11 +810,12 @@ void idRenderSystemLocal::EndFrame( int *frontEndMsec, int *backEndMsec ) {
 	GL_CheckErrors();
 
 	// add the swapbuffers command
-	cmd = (emptyCommand_t *)R_GetCommandBuffer( sizeof( *cmd ) );
+	cmd = (swapBuffersCommand_t *)R_GetCommandBuffer( sizeof( *cmd ) );
 	cmd->commandId = RC_SWAP_BUFFERS;
+	cmd->frameTempNum = vertexCache.GetFrameTempNum();
 
 	// start the back end up again with the new command list
-	R_IssueRenderCommands();
+	R_IssueRenderCommands( true );
 
 	// use the other buffers next frame, because another CPU
 	// may still be rendering into the current buffers
@@ -920,7 +1042,7 @@ void idRenderSystemLocal::CaptureRenderToFile( const char *fileName, bool fixAlp
 
 	guiModel->EmitFullScreen();
 	guiModel->Clear();
-	R_IssueRenderCommands();
+	R_IssueRenderCommands( false );
 
 	qglReadBuffer( GL_BACK );
 
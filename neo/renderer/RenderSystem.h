@@ -76,6 +76,8 @@ typedef struct glconfig_s {
 	bool				textureNonPowerOfTwoAvailable;
 	bool				depthBoundsTestAvailable;
 	bool				glDebugOutputAvailable;
+	bool				ARBBufferStorageAvailable;	// also implies GL_ARB_map_buffer_range
+	bool				ARBSyncAvailable;
 
 	// GL framebuffer size, see also winWidth and winHeight
 	int					vidWidth, vidHeight;	// passed to R_BeginFrame
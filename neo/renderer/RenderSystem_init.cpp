@@ -61,10 +61,14 @@ idCVar r_useShadowProjectedCull( "r_useShadowProjectedCull", "1", CVAR_RENDERER
 idCVar r_useShadowVertexProgram( "r_useShadowVertexProgram", "1", CVAR_RENDERER | CVAR_BOOL, "do the shadow projection in the vertex program on capable cards" );
 idCVar r_useShadowSurfaceScissor( "r_useShadowSurfaceScissor", "1", CVAR_RENDERER | CVAR_BOOL, "scissor shadows by the scissor rect of the interaction surfaces" );
 idCVar r_useInteractionTable( "r_useInteractionTable", "1", CVAR_RENDERER | CVAR_BOOL, "create a full entityDefs * lightDefs table to make finding interactions faster" );
+idCVar r_useInteractionCache( "r_useInteractionCache", "1", CVAR_RENDERER | CVAR_BOOL, "keep the interactions of entities and lights over updates that don't change their geometry or shadows" );
+idCVar r_useSIMDShadowVolumes( "r_useSIMDShadowVolumes", "1", CVAR_RENDERER | CVAR_BOOL, "classify vertexes, triangles and silhouette edges in batches when creating shadow volumes" );
 idCVar r_useTurboShadow( "r_useTurboShadow", "1", CVAR_RENDERER | CVAR_BOOL, "use the infinite projection with W technique for dynamic shadows" );
 idCVar r_useTwoSidedStencil( "r_useTwoSidedStencil", "1", CVAR_RENDERER | CVAR_BOOL, "do stencil shadows in one pass with different ops on each side" );
 idCVar r_useDeferredTangents( "r_useDeferredTangents", "1", CVAR_RENDERER | CVAR_BOOL, "defer tangents calculations after deform" );
 idCVar r_useCachedDynamicModels( "r_useCachedDynamicModels", "1", CVAR_RENDERER | CVAR_BOOL, "cache snapshots of dynamic models" );
+idCVar r_parallelDynamicModels( "r_parallelDynamicModels", "0", CVAR_RENDERER | CVAR_BOOL | CVAR_ARCHIVE, "instantiate the md5 and particle models of a view on the job workers" );
+idCVar r_parallelPortalFlood( "r_parallelPortalFlood", "0", CVAR_RENDERER | CVAR_BOOL | CVAR_ARCHIVE, "clip the portals of each view flood level on the job workers" );
 
 idCVar r_useIndexBuffers( "r_useIndexBuffers", "0", CVAR_RENDERER | CVAR_ARCHIVE | CVAR_INTEGER, "use ARB_vertex_buffer_object for indexes", 0, 1, idCmdSystem::ArgCompletion_Integer<0,1>  );
 
@@ -75,6 +79,7 @@ idCVar r_znear( "r_znear", "3", CVAR_RENDERER | CVAR_FLOAT, "near Z clip plane d
 
 idCVar r_ignoreGLErrors( "r_ignoreGLErrors", "1", CVAR_RENDERER | CVAR_BOOL, "ignore GL errors" );
 idCVar r_finish( "r_finish", "0", CVAR_RENDERER | CVAR_BOOL, "force a call to glFinish() every frame" );
+idCVar r_smp( "r_smp", "0", CVAR_RENDERER | CVAR_BOOL | CVAR_ARCHIVE, "run the back end in a separate thread, so the front end can build the next frame while the current one is drawn" );
 idCVar r_swapInterval( "r_swapInterval", "1", CVAR_RENDERER | CVAR_ARCHIVE | CVAR_INTEGER, "changes the GL swap interval" );
 
 idCVar r_gamma( "r_gamma", "1", CVAR_RENDERER | CVAR_ARCHIVE | CVAR_FLOAT, "changes gamma tables", 0.5f, 3.0f );
@@ -90,6 +95,7 @@ idCVar r_skipInteractions( "r_skipInteractions", "0", CVAR_RENDERER | CVAR_BOOL,
 idCVar r_skipDynamicTextures( "r_skipDynamicTextures", "0", CVAR_RENDERER | CVAR_BOOL, "don't dynamically create textures" );
 idCVar r_skipCopyTexture( "r_skipCopyTexture", "0", CVAR_RENDERER | CVAR_BOOL, "do all rendering, but don't actually copyTexSubImage2D" );
 idCVar r_skipBackEnd( "r_skipBackEnd", "0", CVAR_RENDERER | CVAR_BOOL, "don't draw anything" );
+idCVar r_nullBackend( "r_nullBackend", "0", CVAR_RENDERER | CVAR_BOOL | CVAR_INIT, "don't create a window or GL context, run the front end and only count what the back end would draw" );
 idCVar r_skipRender( "r_skipRender", "0", CVAR_RENDERER | CVAR_BOOL, "skip 3D rendering, but pass 2D" );
 idCVar r_skipRenderContext( "r_skipRenderContext", "0", CVAR_RENDERER | CVAR_BOOL, "NULL the rendering context during backend 3D rendering" );
 idCVar r_skipTranslucent( "r_skipTranslucent", "0", CVAR_RENDERER | CVAR_BOOL, "skip the translucent interaction rendering" );
@@ -180,8 +186,10 @@ idCVar r_showTris( "r_showTris", "0", CVAR_RENDERER | CVAR_INTEGER, "enables wir
 idCVar r_showSurfaceInfo( "r_showSurfaceInfo", "0", CVAR_RENDERER | CVAR_BOOL, "show surface material name under crosshair" );
 idCVar r_showNormals( "r_showNormals", "0", CVAR_RENDERER | CVAR_FLOAT, "draws wireframe normals" );
 idCVar r_showMemory( "r_showMemory", "0", CVAR_RENDERER | CVAR_BOOL, "print frame memory utilization" );
+idCVar r_showFrameMemory( "r_showFrameMemory", "0", CVAR_RENDERER | CVAR_BOOL, "print frame memory use, highwater and new blocks of every frame arena" );
 idCVar r_showCull( "r_showCull", "0", CVAR_RENDERER | CVAR_BOOL, "report sphere and box culling stats" );
 idCVar r_showInteractions( "r_showInteractions", "0", CVAR_RENDERER | CVAR_BOOL, "report interaction generation activity" );
+idCVar r_showInteractionCache( "r_showInteractionCache", "0", CVAR_RENDERER | CVAR_BOOL, "report interaction cache hits and misses, and the updates that kept their interactions" );
 idCVar r_showDepth( "r_showDepth", "0", CVAR_RENDERER | CVAR_BOOL, "display the contents of the depth buffer and the depth range" );
 idCVar r_showSurfaces( "r_showSurfaces", "0", CVAR_RENDERER | CVAR_BOOL, "report surface/light/shadow counts" );
 idCVar r_showPrimitives( "r_showPrimitives", "0", CVAR_RENDERER | CVAR_INTEGER, "report drawsurf/index/vertex counts" );
@@ -275,6 +283,13 @@ PFNGLSTENCILOPSEPARATEPROC qglStencilOpSeparate;
 // GL_ARB_debug_output
 PFNGLDEBUGMESSAGECALLBACKARBPROC        qglDebugMessageCallbackARB;
 
+// GL_ARB_buffer_storage, GL_ARB_map_buffer_range and GL_ARB_sync
+PFNGLBUFFERSTORAGEPROC					qglBufferStorage;
+PFNGLMAPBUFFERRANGEPROC					qglMapBufferRange;
+PFNGLFENCESYNCPROC						qglFenceSync;
+PFNGLCLIENTWAITSYNCPROC					qglClientWaitSync;
+PFNGLDELETESYNCPROC						qglDeleteSync;
+
 enum {
 	// Not all GL.h header know about GL_DEBUG_SEVERITY_NOTIFICATION_*.
 	QGL_DEBUG_SEVERITY_NOTIFICATION = 0x826B
@@ -329,6 +344,20 @@ DebugCallback( GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei l
 
 }
 
+/*
+=================
+R_GetProcAddress
+
+Returns the null back end stubs instead of driver functions with r_nullBackend
+=================
+*/
+static GLExtension_t R_GetProcAddress( const char *name ) {
+	if ( r_nullBackend.GetBool() ) {
+		return RB_NullGetProcAddress( name );
+	}
+	return GLimp_ExtensionPointer( name );
+}
+
 /*
 =================
 R_CheckExtension
@@ -356,10 +385,10 @@ static void R_CheckPortableExtensions( void ) {
 	// GL_ARB_multitexture
 	glConfig.multitextureAvailable = R_CheckExtension( "GL_ARB_multitexture" );
 	if ( glConfig.multitextureAvailable ) {
-		qglMultiTexCoord2fARB = (void(APIENTRY *)(GLenum, GLfloat, GLfloat))GLimp_ExtensionPointer( "glMultiTexCoord2fARB" );
-		qglMultiTexCoord2fvARB = (void(APIENTRY *)(GLenum, GLfloat *))GLimp_ExtensionPointer( "glMultiTexCoord2fvARB" );
-		qglActiveTextureARB = (void(APIENTRY *)(GLenum))GLimp_ExtensionPointer( "glActiveTextureARB" );
-		qglClientActiveTextureARB = (void(APIENTRY *)(GLenum))GLimp_ExtensionPointer( "glClientActiveTextureARB" );
+		qglMultiTexCoord2fARB = (void(APIENTRY *)(GLenum, GLfloat, GLfloat))R_GetProcAddress( "glMultiTexCoord2fARB" );
+		qglMultiTexCoord2fvARB = (void(APIENTRY *)(GLenum, GLfloat *))R_GetProcAddress( "glMultiTexCoord2fvARB" );
+		qglActiveTextureARB = (void(APIENTRY *)(GLenum))R_GetProcAddress( "glActiveTextureARB" );
+		qglClientActiveTextureARB = (void(APIENTRY *)(GLenum))R_GetProcAddress( "glClientActiveTextureARB" );
 		qglGetIntegerv( GL_MAX_TEXTURE_UNITS_ARB, (GLint *)&glConfig.maxTextureUnits );
 		if ( glConfig.maxTextureUnits > MAX_MULTITEXTURE_UNITS ) {
 			glConfig.maxTextureUnits = MAX_MULTITEXTURE_UNITS;
@@ -390,8 +419,8 @@ static void R_CheckPortableExtensions( void ) {
 	// DRI drivers may have GL_ARB_texture_compression but no GL_EXT_texture_compression_s3tc
 	if ( R_CheckExtension( "GL_ARB_texture_compression" ) && R_CheckExtension( "GL_EXT_texture_compression_s3tc" ) ) {
 		glConfig.textureCompressionAvailable = true;
-		qglCompressedTexImage2DARB = (PFNGLCOMPRESSEDTEXIMAGE2DARBPROC)GLimp_ExtensionPointer( "glCompressedTexImage2DARB" );
-		qglGetCompressedTexImageARB = (PFNGLGETCOMPRESSEDTEXIMAGEARBPROC)GLimp_ExtensionPointer( "glGetCompressedTexImageARB" );
+		qglCompressedTexImage2DARB = (PFNGLCOMPRESSEDTEXIMAGE2DARBPROC)R_GetProcAddress( "glCompressedTexImage2DARB" );
+		qglGetCompressedTexImageARB = (PFNGLGETCOMPRESSEDTEXIMAGEARBPROC)R_GetProcAddress( "glGetCompressedTexImageARB" );
 		if ( R_CheckExtension( "GL_ARB_texture_compression_bptc" ) ) {
 			glConfig.bptcTextureCompressionAvailable = true;
 		}
@@ -423,7 +452,7 @@ static void R_CheckPortableExtensions( void ) {
 	// GL_EXT_shared_texture_palette
 	glConfig.sharedTexturePaletteAvailable = R_CheckExtension( "GL_EXT_shared_texture_palette" );
 	if ( glConfig.sharedTexturePaletteAvailable ) {
-		qglColorTableEXT = ( void ( APIENTRY * ) ( int, int, int, int, int, const void * ) ) GLimp_ExtensionPointer( "glColorTableEXT" );
+		qglColorTableEXT = ( void ( APIENTRY * ) ( int, int, int, int, int, const void * ) ) R_GetProcAddress( "glColorTableEXT" );
 	}
 
 	// GL_EXT_texture3D (not currently used for anything)
@@ -431,7 +460,7 @@ static void R_CheckPortableExtensions( void ) {
 	if ( glConfig.texture3DAvailable ) {
 		qglTexImage3D =
 			(void (APIENTRY *)(GLenum, GLint, GLint, GLsizei, GLsizei, GLsizei, GLint, GLenum, GLenum, const GLvoid *) )
-			GLimp_ExtensionPointer( "glTexImage3D" );
+			R_GetProcAddress( "glTexImage3D" );
 	}
 
 	// EXT_stencil_wrap
@@ -449,16 +478,16 @@ static void R_CheckPortableExtensions( void ) {
 	// GL_EXT_stencil_two_side
 	glConfig.twoSidedStencilAvailable = R_CheckExtension( "GL_EXT_stencil_two_side" );
 	if ( glConfig.twoSidedStencilAvailable )
-		qglActiveStencilFaceEXT = (PFNGLACTIVESTENCILFACEEXTPROC)GLimp_ExtensionPointer( "glActiveStencilFaceEXT" );
+		qglActiveStencilFaceEXT = (PFNGLACTIVESTENCILFACEEXTPROC)R_GetProcAddress( "glActiveStencilFaceEXT" );
 
 	if( glConfig.glVersion >= 2.0) {
 		common->Printf( "...got GL2.0+ glStencilOpSeparate()\n" );
-		qglStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)GLimp_ExtensionPointer( "glStencilOpSeparate" );
+		qglStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)R_GetProcAddress( "glStencilOpSeparate" );
 	} else if( R_CheckExtension( "GL_ATI_separate_stencil" ) ) {
 		common->Printf( "...got glStencilOpSeparateATI() (GL_ATI_separate_stencil)\n" );
 		// the ATI version of glStencilOpSeparate() has the same signature and should also
 		// behave identical to the GL2 version (in Mesa3D it's just an alias)
-		qglStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)GLimp_ExtensionPointer( "glStencilOpSeparateATI" );
+		qglStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)R_GetProcAddress( "glStencilOpSeparateATI" );
 	} else {
 		common->Printf( "X..don't have glStencilOpSeparateATI() or (GL2.0+) glStencilOpSeparate()\n" );
 		qglStencilOpSeparate = NULL;
@@ -467,30 +496,30 @@ static void R_CheckPortableExtensions( void ) {
 	// ARB_vertex_buffer_object
 	glConfig.ARBVertexBufferObjectAvailable = R_CheckExtension( "GL_ARB_vertex_buffer_object" );
 	if(glConfig.ARBVertexBufferObjectAvailable) {
-		qglBindBufferARB = (PFNGLBINDBUFFERARBPROC)GLimp_ExtensionPointer( "glBindBufferARB");
-		qglDeleteBuffersARB = (PFNGLDELETEBUFFERSARBPROC)GLimp_ExtensionPointer( "glDeleteBuffersARB");
-		qglGenBuffersARB = (PFNGLGENBUFFERSARBPROC)GLimp_ExtensionPointer( "glGenBuffersARB");
-		qglIsBufferARB = (PFNGLISBUFFERARBPROC)GLimp_ExtensionPointer( "glIsBufferARB");
-		qglBufferDataARB = (PFNGLBUFFERDATAARBPROC)GLimp_ExtensionPointer( "glBufferDataARB");
-		qglBufferSubDataARB = (PFNGLBUFFERSUBDATAARBPROC)GLimp_ExtensionPointer( "glBufferSubDataARB");
-		qglGetBufferSubDataARB = (PFNGLGETBUFFERSUBDATAARBPROC)GLimp_ExtensionPointer( "glGetBufferSubDataARB");
-		qglMapBufferARB = (PFNGLMAPBUFFERARBPROC)GLimp_ExtensionPointer( "glMapBufferARB");
-		qglUnmapBufferARB = (PFNGLUNMAPBUFFERARBPROC)GLimp_ExtensionPointer( "glUnmapBufferARB");
-		qglGetBufferParameterivARB = (PFNGLGETBUFFERPARAMETERIVARBPROC)GLimp_ExtensionPointer( "glGetBufferParameterivARB");
-		qglGetBufferPointervARB = (PFNGLGETBUFFERPOINTERVARBPROC)GLimp_ExtensionPointer( "glGetBufferPointervARB");
+		qglBindBufferARB = (PFNGLBINDBUFFERARBPROC)R_GetProcAddress( "glBindBufferARB");
+		qglDeleteBuffersARB = (PFNGLDELETEBUFFERSARBPROC)R_GetProcAddress( "glDeleteBuffersARB");
+		qglGenBuffersARB = (PFNGLGENBUFFERSARBPROC)R_GetProcAddress( "glGenBuffersARB");
+		qglIsBufferARB = (PFNGLISBUFFERARBPROC)R_GetProcAddress( "glIsBufferARB");
+		qglBufferDataARB = (PFNGLBUFFERDATAARBPROC)R_GetProcAddress( "glBufferDataARB");
+		qglBufferSubDataARB = (PFNGLBUFFERSUBDATAARBPROC)R_GetProcAddress( "glBufferSubDataARB");
+		qglGetBufferSubDataARB = (PFNGLGETBUFFERSUBDATAARBPROC)R_GetProcAddress( "glGetBufferSubDataARB");
+		qglMapBufferARB = (PFNGLMAPBUFFERARBPROC)R_GetProcAddress( "glMapBufferARB");
+		qglUnmapBufferARB = (PFNGLUNMAPBUFFERARBPROC)R_GetProcAddress( "glUnmapBufferARB");
+		qglGetBufferParameterivARB = (PFNGLGETBUFFERPARAMETERIVARBPROC)R_GetProcAddress( "glGetBufferParameterivARB");
+		qglGetBufferPointervARB = (PFNGLGETBUFFERPOINTERVARBPROC)R_GetProcAddress( "glGetBufferPointervARB");
 	}
 
 	// ARB_vertex_program
 	glConfig.ARBVertexProgramAvailable = R_CheckExtension( "GL_ARB_vertex_program" );
 	if (glConfig.ARBVertexProgramAvailable) {
-		qglVertexAttribPointerARB = (PFNGLVERTEXATTRIBPOINTERARBPROC)GLimp_ExtensionPointer( "glVertexAttribPointerARB" );
-		qglEnableVertexAttribArrayARB = (PFNGLENABLEVERTEXATTRIBARRAYARBPROC)GLimp_ExtensionPointer( "glEnableVertexAttribArrayARB" );
-		qglDisableVertexAttribArrayARB = (PFNGLDISABLEVERTEXATTRIBARRAYARBPROC)GLimp_ExtensionPointer( "glDisableVertexAttribArrayARB" );
-		qglProgramStringARB = (PFNGLPROGRAMSTRINGARBPROC)GLimp_ExtensionPointer( "glProgramStringARB" );
-		qglBindProgramARB = (PFNGLBINDPROGRAMARBPROC)GLimp_ExtensionPointer( "glBindProgramARB" );
-		qglGenProgramsARB = (PFNGLGENPROGRAMSARBPROC)GLimp_ExtensionPointer( "glGenProgramsARB" );
-		qglProgramEnvParameter4fvARB = (PFNGLPROGRAMENVPARAMETER4FVARBPROC)GLimp_ExtensionPointer( "glProgramEnvParameter4fvARB" );
-		qglProgramLocalParameter4fvARB = (PFNGLPROGRAMLOCALPARAMETER4FVARBPROC)GLimp_ExtensionPointer( "glProgramLocalParameter4fvARB" );
+		qglVertexAttribPointerARB = (PFNGLVERTEXATTRIBPOINTERARBPROC)R_GetProcAddress( "glVertexAttribPointerARB" );
+		qglEnableVertexAttribArrayARB = (PFNGLENABLEVERTEXATTRIBARRAYARBPROC)R_GetProcAddress( "glEnableVertexAttribArrayARB" );
+		qglDisableVertexAttribArrayARB = (PFNGLDISABLEVERTEXATTRIBARRAYARBPROC)R_GetProcAddress( "glDisableVertexAttribArrayARB" );
+		qglProgramStringARB = (PFNGLPROGRAMSTRINGARBPROC)R_GetProcAddress( "glProgramStringARB" );
+		qglBindProgramARB = (PFNGLBINDPROGRAMARBPROC)R_GetProcAddress( "glBindProgramARB" );
+		qglGenProgramsARB = (PFNGLGENPROGRAMSARBPROC)R_GetProcAddress( "glGenProgramsARB" );
+		qglProgramEnvParameter4fvARB = (PFNGLPROGRAMENVPARAMETER4FVARBPROC)R_GetProcAddress( "glProgramEnvParameter4fvARB" );
+		qglProgramLocalParameter4fvARB = (PFNGLPROGRAMLOCALPARAMETER4FVARBPROC)R_GetProcAddress( "glProgramLocalParameter4fvARB" );
 	}
 
 	// ARB_fragment_program
@@ -500,10 +529,10 @@ static void R_CheckPortableExtensions( void ) {
 		glConfig.ARBFragmentProgramAvailable = R_CheckExtension( "GL_ARB_fragment_program" );
 		if (glConfig.ARBFragmentProgramAvailable) {
 			// these are the same as ARB_vertex_program
-			qglProgramStringARB = (PFNGLPROGRAMSTRINGARBPROC)GLimp_ExtensionPointer( "glProgramStringARB" );
-			qglBindProgramARB = (PFNGLBINDPROGRAMARBPROC)GLimp_ExtensionPointer( "glBindProgramARB" );
-			qglProgramEnvParameter4fvARB = (PFNGLPROGRAMENVPARAMETER4FVARBPROC)GLimp_ExtensionPointer( "glProgramEnvParameter4fvARB" );
-			qglProgramLocalParameter4fvARB = (PFNGLPROGRAMLOCALPARAMETER4FVARBPROC)GLimp_ExtensionPointer( "glProgramLocalParameter4fvARB" );
+			qglProgramStringARB = (PFNGLPROGRAMSTRINGARBPROC)R_GetProcAddress( "glProgramStringARB" );
+			qglBindProgramARB = (PFNGLBINDPROGRAMARBPROC)R_GetProcAddress( "glBindProgramARB" );
+			qglProgramEnvParameter4fvARB = (PFNGLPROGRAMENVPARAMETER4FVARBPROC)R_GetProcAddress( "glProgramEnvParameter4fvARB" );
+			qglProgramLocalParameter4fvARB = (PFNGLPROGRAMLOCALPARAMETER4FVARBPROC)R_GetProcAddress( "glProgramLocalParameter4fvARB" );
 		}
 	}
 
@@ -516,7 +545,21 @@ static void R_CheckPortableExtensions( void ) {
 	// GL_EXT_depth_bounds_test
 	glConfig.depthBoundsTestAvailable = R_CheckExtension( "EXT_depth_bounds_test" );
 	if ( glConfig.depthBoundsTestAvailable ) {
-		qglDepthBoundsEXT = (PFNGLDEPTHBOUNDSEXTPROC)GLimp_ExtensionPointer( "glDepthBoundsEXT" );
+		qglDepthBoundsEXT = (PFNGLDEPTHBOUNDSEXTPROC)R_GetProcAddress( "glDepthBoundsEXT" );
+	}
+
+	// GL_ARB_buffer_storage and GL_ARB_sync, for the persistently mapped frame temp vertex memory
+	glConfig.ARBBufferStorageAvailable = glConfig.ARBVertexBufferObjectAvailable && R_CheckExtension( "GL_ARB_buffer_storage" )
+										&& ( glConfig.glVersion >= 3.0 || R_CheckExtension( "GL_ARB_map_buffer_range" ) );
+	if ( glConfig.ARBBufferStorageAvailable ) {
+		qglBufferStorage = (PFNGLBUFFERSTORAGEPROC)R_GetProcAddress( "glBufferStorage" );
+		qglMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)R_GetProcAddress( "glMapBufferRange" );
+	}
+	glConfig.ARBSyncAvailable = glConfig.glVersion >= 3.2 || R_CheckExtension( "GL_ARB_sync" );
+	if ( glConfig.ARBSyncAvailable ) {
+		qglFenceSync = (PFNGLFENCESYNCPROC)R_GetProcAddress( "glFenceSync" );
+		qglClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)R_GetProcAddress( "glClientWaitSync" );
+		qglDeleteSync = (PFNGLDELETESYNCPROC)R_GetProcAddress( "glDeleteSync" );
 	}
 
 	// GL_ARB_debug_output
@@ -524,7 +567,7 @@ static void R_CheckPortableExtensions( void ) {
 	if ( glConfig.haveDebugContext ) {
 		if ( strstr( glConfig.extensions_string, "GL_ARB_debug_output" ) ) {
 			glConfig.glDebugOutputAvailable = true;
-			qglDebugMessageCallbackARB = (PFNGLDEBUGMESSAGECALLBACKARBPROC)GLimp_ExtensionPointer( "glDebugMessageCallbackARB" );
+			qglDebugMessageCallbackARB = (PFNGLDEBUGMESSAGECALLBACKARBPROC)R_GetProcAddress( "glDebugMessageCallbackARB" );
 			if ( r_glDebugContext.GetBool() ) {
 				common->Printf( "...using GL_ARB_debug_output (r_glDebugContext is set)\n" );
 				qglDebugMessageCallbackARB(DebugCallback, NULL);
@@ -751,38 +794,48 @@ void R_InitOpenGL( void ) {
 	//
 	// initialize OS specific portions of the renderSystem
 	//
-	for ( i = 0 ; i < 2 ; i++ ) {
-		// set the parameters we are trying
+	if ( r_nullBackend.GetBool() ) {
+		// no window, but the front end still needs a sensible view size
 		R_GetModeInfo( &glConfig.vidWidth, &glConfig.vidHeight, r_mode.GetInteger() );
+		glConfig.winWidth = glConfig.vidWidth;
+		glConfig.winHeight = glConfig.vidHeight;
+		glConfig.isFullscreen = false;
+		glConfig.displayFrequency = 0;
+		common->Printf( "r_nullBackend: not creating a window, using %i x %i\n", glConfig.vidWidth, glConfig.vidHeight );
+	} else {
+		for ( i = 0 ; i < 2 ; i++ ) {
+			// set the parameters we are trying
+			R_GetModeInfo( &glConfig.vidWidth, &glConfig.vidHeight, r_mode.GetInteger() );
+
+			parms.width = glConfig.vidWidth;
+			parms.height = glConfig.vidHeight;
+			parms.fullScreen = r_fullscreen.GetBool();
+			parms.fullScreenDesktop = r_fullscreenDesktop.GetBool();
+			parms.displayHz = r_displayRefresh.GetInteger();
+			parms.multiSamples = r_multiSamples.GetInteger();
+			parms.stereo = false;
 
-		parms.width = glConfig.vidWidth;
-		parms.height = glConfig.vidHeight;
-		parms.fullScreen = r_fullscreen.GetBool();
-		parms.fullScreenDesktop = r_fullscreenDesktop.GetBool();
-		parms.displayHz = r_displayRefresh.GetInteger();
-		parms.multiSamples = r_multiSamples.GetInteger();
-		parms.stereo = false;
+			if ( GLimp_Init( parms ) ) {
+				// it worked
+				break;
+			}
 
-		if ( GLimp_Init( parms ) ) {
-			// it worked
-			break;
-		}
+			if ( i == 1 ) {
+				common->FatalError( "Unable to initialize OpenGL" );
+			}
 
-		if ( i == 1 ) {
-			common->FatalError( "Unable to initialize OpenGL" );
+			// if we failed, set everything back to "safe mode"
+			// and try again
+			r_mode.SetInteger( 3 );
+			r_fullscreen.SetInteger( 0 );
+			r_displayRefresh.SetInteger( 0 );
+			r_multiSamples.SetInteger( 0 );
 		}
-
-		// if we failed, set everything back to "safe mode"
-		// and try again
-		r_mode.SetInteger( 3 );
-		r_fullscreen.SetInteger( 0 );
-		r_displayRefresh.SetInteger( 0 );
-		r_multiSamples.SetInteger( 0 );
 	}
 
 // load qgl function pointers
 #define QGLPROC(name, rettype, args) \
-	q##name = (rettype(APIENTRYP)args)GLimp_ExtensionPointer(#name); \
+	q##name = (rettype(APIENTRYP)args)R_GetProcAddress(#name); \
 	if (!q##name) \
 		common->FatalError("Unable to initialize OpenGL (%s)", #name);
 
@@ -1198,6 +1251,7 @@ R_RenderingFPS
 ================
 */
 static float R_RenderingFPS( const renderView_t *renderView ) {
+	R_SyncRenderThread();
 	qglFinish();
 
 	int		start = Sys_Milliseconds();
@@ -1210,6 +1264,7 @@ static float R_RenderingFPS( const renderView_t *renderView ) {
 		renderSystem->BeginFrame( glConfig.vidWidth, glConfig.vidHeight );
 		tr.primaryWorld->RenderScene( renderView );
 		renderSystem->EndFrame( NULL, NULL );
+		R_SyncRenderThread();
 		qglFinish();
 		count++;
 		end = Sys_Milliseconds();
@@ -1957,6 +2012,11 @@ void R_SetColorMappings( void ) {
 		gammaTable[i] = inf;
 	}
 
+	// there is no window to apply it to
+	if ( r_nullBackend.GetBool() ) {
+		return;
+	}
+
 	GLimp_SetGamma( gammaTable, gammaTable, gammaTable );
 }
 
@@ -2025,6 +2085,9 @@ void R_VidRestart_f( const idCmdArgs &args ) {
 		return;
 	}
 
+	// the render thread is started again with the next frame
+	R_ShutdownRenderThread();
+
 	bool full = true;
 	bool forceWindow = false;
 	for ( int i = 1 ; i < args.Argc() ; i++ ) {
@@ -2236,6 +2299,7 @@ void R_InitCommands( void ) {
 	cmdSystem->AddCommand( "listRenderLightDefs", R_ListRenderLightDefs_f, CMD_FL_RENDERER, "lists the light defs" );
 	cmdSystem->AddCommand( "listModes", R_ListModes_f, CMD_FL_RENDERER, "lists all video modes" );
 	cmdSystem->AddCommand( "reloadSurface", R_ReloadSurface_f, CMD_FL_RENDERER, "reloads the decl and images for selected surface" );
+	cmdSystem->AddCommand( "nullBackEndStats", R_NullBackEndStats_f, CMD_FL_RENDERER, "prints what the null back end counted, \"reset\" clears the totals" );
 }
 
 /*
@@ -2342,6 +2406,8 @@ void idRenderSystemLocal::Shutdown( void ) {
 
 	common->SetRefreshOnPrint( false ); // without a renderer there's nothing to refresh
 
+	R_ShutdownRenderThread();
+
 #ifdef ID_BUILD_FREETYPE
 	R_DoneFreeType( );
 #endif // ID_BUILD_FREETYPE
@@ -2380,6 +2446,9 @@ idRenderSystemLocal::BeginLevelLoad
 ========================
 */
 void idRenderSystemLocal::BeginLevelLoad( void ) {
+	// images and models are about to be purged
+	R_SyncRenderThread();
+
 	renderModelManager->BeginLevelLoad();
 	globalImages->BeginLevelLoad();
 }
@@ -2390,6 +2459,8 @@ idRenderSystemLocal::EndLevelLoad
 ========================
 */
 void idRenderSystemLocal::EndLevelLoad( void ) {
+	R_SyncRenderThread();
+
 	renderModelManager->EndLevelLoad();
 	globalImages->EndLevelLoad();
 	if ( r_forceLoadImages.GetBool() ) {
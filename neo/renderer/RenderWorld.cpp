@@ -140,6 +140,11 @@ idRenderWorldLocal::idRenderWorldLocal() {
 	doublePortals = NULL;
 	numInterAreaPortals = 0;
 
+	floodAreas = NULL;
+	floodPortals = NULL;
+	floodPortalPlanes = NULL;
+	floodPortalPoints = NULL;
+
 	interactionTable = 0;
 	interactionTableWidth = 0;
 	interactionTableHeight = 0;
@@ -201,6 +206,53 @@ qhandle_t idRenderWorldLocal::AddEntityDef( const renderEntity_t *re ){
 	return entityHandle;
 }
 
+/*
+==============
+R_EntityUpdateKeepsInteractions
+
+Returns true if the only differences between the new parms and the current ones
+are things that are evaluated every frame, like shader parms, so the area references
+and all interactions, with their light and shadow tris, are still valid
+==============
+*/
+static bool R_EntityUpdateKeepsInteractions( const idRenderEntityLocal *def, const renderEntity_t *re ) {
+	if ( !r_useInteractionCache.GetBool() ) {
+		return false;
+	}
+
+	// animated and callback models are regenerated anyway
+	if ( re->joints || re->callback || def->dynamicModel || !re->hModel || re->hModel->IsDynamicModel() != DM_STATIC ) {
+		return false;
+	}
+
+	renderEntity_t	parms = *re;
+
+	parms.entityNum = def->parms.entityNum;
+	parms.bodyId = def->parms.bodyId;
+	parms.suppressShadowInViewID = def->parms.suppressShadowInViewID;
+	parms.suppressShadowInLightID = def->parms.suppressShadowInLightID;
+	parms.allowSurfaceInViewID = def->parms.allowSurfaceInViewID;
+	parms.referenceShader = def->parms.referenceShader;
+	parms.referenceSound = def->parms.referenceSound;
+	memcpy( parms.shaderParms, def->parms.shaderParms, sizeof( parms.shaderParms ) );
+	if ( !session->readDemo ) {
+		// demo playback allocates new guis with every update, those are freed with the derived data
+		memcpy( parms.gui, def->parms.gui, sizeof( parms.gui ) );
+	}
+	parms.remoteRenderView = def->parms.remoteRenderView;
+	parms.modelDepthHack = def->parms.modelDepthHack;
+	parms.onlyVisibleInSpirit = def->parms.onlyVisibleInSpirit;
+	parms.onlyInvisibleInSpirit = def->parms.onlyInvisibleInSpirit;
+	parms.lowSkippable = def->parms.lowSkippable;
+	parms.eyeDistance = def->parms.eyeDistance;
+	parms.weaponDepthHack = def->parms.weaponDepthHack;
+	parms.forceUpdate = def->parms.forceUpdate;
+	parms.timeGroup = def->parms.timeGroup;
+	parms.xrayIndex = def->parms.xrayIndex;
+
+	return !memcmp( &parms, &def->parms, sizeof( parms ) );
+}
+
 /*
 ==============
 UpdateEntityDef
@@ -260,6 +312,19 @@ void idRenderWorldLocal::UpdateEntityDef( qhandle_t entityHandle, const renderEn
 					return;
 				}
 			}
+
+			// fading or flickering static models don't need their interactions rebuilt,
+			// but the demo still has to see the update
+			if ( R_EntityUpdateKeepsInteractions( def, re ) ) {
+				tr.pc.c_entityUpdatesKept++;
+				def->parms = *re;
+				def->lastModifiedFrameNum = tr.frameCount;
+				if ( session->writeDemo && def->archived ) {
+					WriteFreeEntity( entityHandle );
+					def->archived = false;
+				}
+				return;
+			}
 		}
 
 		// save any decals if the model is the same, allowing marks to move with entities
@@ -379,6 +444,36 @@ qhandle_t idRenderWorldLocal::AddLightDef( const renderLight_t *rlight ) {
 	return lightHandle;
 }
 
+/*
+=================
+R_LightUpdateKeepsInteractions
+
+A changed light shader only invalidates the interactions if it lights
+or shadows different surfaces, animated light shaders usually don't.
+The light tris depend on the back sides flag and the fog portals of the
+light are only created with the light def.
+=================
+*/
+static bool R_LightUpdateKeepsInteractions( const idRenderLightLocal *light, const idMaterial *shader ) {
+	if ( !r_useInteractionCache.GetBool() ) {
+		return ( shader == light->lightShader );
+	}
+
+	// R_DeriveLightShader() keeps the current shader
+	if ( !shader || shader == light->lightShader ) {
+		return true;
+	}
+
+	const idMaterial *current = light->lightShader;
+	return ( shader->Spectrum() == current->Spectrum()
+		&& shader->LightCastsShadows() == current->LightCastsShadows()
+		&& shader->IsFogLight() == current->IsFogLight()
+		&& shader->IsBlendLight() == current->IsBlendLight()
+		&& shader->IsAmbientLight() == current->IsAmbientLight()
+		&& shader->LightEffectsBackSides() == current->LightEffectsBackSides()
+		&& shader->TestMaterialFlag( MF_NOPORTALFOG ) == current->TestMaterialFlag( MF_NOPORTALFOG ) );
+}
+
 /*
 =================
 UpdateLightDef
@@ -415,8 +510,9 @@ void idRenderWorldLocal::UpdateLightDef( qhandle_t lightHandle, const renderLigh
 			 rlight->parallel == light->parms.parallel && rlight->pointLight == light->parms.pointLight &&
 			 rlight->right == light->parms.right && rlight->start == light->parms.start &&
 			 rlight->target == light->parms.target && rlight->up == light->parms.up &&
-			 rlight->shader == light->lightShader && rlight->prelightModel == light->parms.prelightModel ) {
+			 R_LightUpdateKeepsInteractions( light, rlight->shader ) && rlight->prelightModel == light->parms.prelightModel ) {
 			justUpdate = true;
+			tr.pc.c_lightUpdatesKept++;
 		} else {
 			// if we are updating shadows, the prelight model is no longer valid
 			light->lightHasMoved = true;
@@ -448,7 +544,9 @@ void idRenderWorldLocal::UpdateLightDef( qhandle_t lightHandle, const renderLigh
 		light->parms.prelightModel = NULL;
 	}
 
-	if (!justUpdate) {
+	if ( justUpdate ) {
+		R_DeriveLightShader( light );
+	} else {
 		R_DeriveLightData( light );
 		R_CreateLightRefs( light );
 		R_CreateLightDefFogPortals( light );
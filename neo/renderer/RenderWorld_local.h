@@ -67,6 +67,20 @@ typedef struct portalArea_s {
 } portalArea_t;
 
 
+// the portals of every area packed into flat arrays for the view flood,
+// built on demand and thrown away when the portals change
+typedef struct {
+	portal_t *				p;
+	const idVec3 *			points;			// copy of the winding points for the SIMD plane tests
+	int						numPoints;
+} floodPortal_t;
+
+typedef struct {
+	int						firstPortal;	// into floodPortals and floodPortalPlanes
+	int						numPortals;
+} floodArea_t;
+
+
 static const int	CHILDREN_HAVE_MULTIPLE_AREAS = -2;
 static const int	AREANUM_SOLID = -1;
 typedef struct {
@@ -192,6 +206,11 @@ public:
 	doublePortal_t *		doublePortals;
 	int						numInterAreaPortals;
 
+	floodArea_t *			floodAreas;				// NULL until the first view flood
+	floodPortal_t *			floodPortals;
+	idPlane *				floodPortalPlanes;
+	idVec3 *				floodPortalPoints;
+
 	idList<idRenderModel *>	localModels;
 
 	idList<idRenderEntityLocal*>	entityDefs;
@@ -235,7 +254,10 @@ public:
 
 	idScreenRect			ScreenRectFromWinding( const idWinding *w, viewEntity_t *space );
 	bool					PortalIsFoggedOut( const portal_t *p );
-	void					FloodViewThroughArea_r( const idVec3 origin, int areaNum, const struct portalStack_s *ps );
+	void					BuildFloodPortals( void );
+	void					FreeFloodPortals( void );
+	int						ExpandViewPortalStack( const idVec3 &origin, const struct portalStack_s *ps, struct portalStack_s *children );
+	void					FloodViewThroughAreas( const idVec3 origin, const struct portalStack_s *ps );
 	void					FlowViewThroughPortals( const idVec3 origin, int numPlanes, const idPlane *planes );
 	void					FloodLightThroughArea_r( idRenderLightLocal *light, int areaNum, const struct portalStack_s *ps );
 	void					FlowLightThroughPortals( idRenderLightLocal *light );
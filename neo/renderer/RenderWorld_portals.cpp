@@ -51,6 +51,9 @@ typedef struct portalStack_s {
 
 	idScreenRect	rect;
 
+	int			areaNum;		// area the view flood enters through p
+	bool		checkFog;		// the view flood still has to test the fog of p
+
 	int			numPortalPlanes;
 	idPlane		portalPlanes[MAX_PORTAL_PLANES+1];
 	// positive side is outside the visible frustum
@@ -146,40 +149,156 @@ bool idRenderWorldLocal::PortalIsFoggedOut( const portal_t *p ) {
 
 /*
 ===================
-FloodViewThroughArea_r
+BuildFloodPortals
+
+Packs the portal planes and windings of every area into flat arrays,
+so the view flood can test all the portals of an area at once
 ===================
 */
-void idRenderWorldLocal::FloodViewThroughArea_r( const idVec3 origin, int areaNum,
-								 const struct portalStack_s *ps ) {
-	portal_t*		p;
+void idRenderWorldLocal::BuildFloodPortals( void ) {
+	portal_t	*p;
+	int			i, j, numPortals, numPoints;
+
+	FreeFloodPortals();
+
+	numPortals = 0;
+	numPoints = 0;
+	for ( i = 0; i < numPortalAreas; i++ ) {
+		for ( p = portalAreas[i].portals; p; p = p->next ) {
+#if GAMEPORTAL_PVS
+			// karin: game portals not handle like original DOOM3
+			if ( p->isGamePortal ) {
+				continue;
+			}
+#endif
+			numPortals++;
+			numPoints += p->w->GetNumPoints();
+		}
+	}
+
+	floodAreas = (floodArea_t *)R_ClearedStaticAlloc( ( numPortalAreas + 1 ) * sizeof( floodAreas[0] ) );
+	floodPortals = (floodPortal_t *)R_StaticAlloc( ( numPortals + 1 ) * sizeof( floodPortals[0] ) );
+	floodPortalPlanes = (idPlane *)R_StaticAlloc( ( numPortals + 1 ) * sizeof( floodPortalPlanes[0] ) );
+	floodPortalPoints = (idVec3 *)R_StaticAlloc( ( numPoints + 1 ) * sizeof( floodPortalPoints[0] ) );
+
+	numPortals = 0;
+	numPoints = 0;
+	for ( i = 0; i < numPortalAreas; i++ ) {
+		floodAreas[i].firstPortal = numPortals;
+		for ( p = portalAreas[i].portals; p; p = p->next ) {
+#if GAMEPORTAL_PVS
+			if ( p->isGamePortal ) {
+				continue;
+			}
+#endif
+			floodPortal_t *fp = &floodPortals[numPortals];
+			fp->p = p;
+			fp->points = &floodPortalPoints[numPoints];
+			fp->numPoints = p->w->GetNumPoints();
+			for ( j = 0; j < fp->numPoints; j++ ) {
+				floodPortalPoints[numPoints++] = (*p->w)[j].ToVec3();
+			}
+			floodPortalPlanes[numPortals] = p->plane;
+			numPortals++;
+		}
+		floodAreas[i].numPortals = numPortals - floodAreas[i].firstPortal;
+	}
+}
+
+/*
+===================
+FreeFloodPortals
+===================
+*/
+void idRenderWorldLocal::FreeFloodPortals( void ) {
+	if ( floodAreas ) {
+		R_StaticFree( floodAreas );
+		R_StaticFree( floodPortals );
+		R_StaticFree( floodPortalPlanes );
+		R_StaticFree( floodPortalPoints );
+		floodAreas = NULL;
+		floodPortals = NULL;
+		floodPortalPlanes = NULL;
+		floodPortalPoints = NULL;
+	}
+}
+
+/*
+===================
+R_ClipFloodPortal
+
+Clips the portal winding to the planes of the stack, returns false if nothing is left.
+The points are tested against each plane with the SIMD processor first, so the
+winding is only copied when it isn't completely outside a plane, and only clipped
+from the first plane it actually crosses.
+===================
+*/
+static bool R_ClipFloodPortal( const floodPortal_t *fp, const portalStack_t *ps, idFixedWinding &w ) {
+	float	*dist;
+	float	min, max;
+	int		j;
+
+	dist = (float *)_alloca16( fp->numPoints * sizeof( float ) );
+
+	for ( j = 0; j < ps->numPortalPlanes; j++ ) {
+		SIMDProcessor->Dot( dist, ps->portalPlanes[j], fp->points, fp->numPoints );
+		SIMDProcessor->MinMax( min, max, dist, fp->numPoints );
+		if ( min >= 0.0f ) {
+			return false;	// completely outside this plane
+		}
+		if ( max > 0.0f ) {
+			break;			// crosses the plane
+		}
+	}
+
+	w = *fp->p->w;
+	for ( ; j < ps->numPortalPlanes; j++ ) {
+		if ( !w.ClipInPlace( -ps->portalPlanes[j], 0 ) ) {
+			break;
+		}
+	}
+	return ( w.GetNumPoints() != 0 );
+}
+
+/*
+===================
+ExpandViewPortalStack
+
+Writes a stack for every portal of the area of ps the view can flow through
+to children, returns the number of stacks written.  Fog is tested by the
+caller, because the fog light shader can't be evaluated on the job workers.
+===================
+*/
+int idRenderWorldLocal::ExpandViewPortalStack( const idVec3 &origin, const portalStack_t *ps, portalStack_t *children ) {
+	const floodArea_t	*area;
+	const floodPortal_t	*fp;
+	portal_t		*p;
+	float			*facing;
 	float			d;
-	portalArea_t *	area;
 	const portalStack_t	*check;
-	portalStack_t	newStack;
-	int				i, j;
+	portalStack_t	*newStack;
+	int				numChildren;
+	int				i, j, k;
 	idVec3			v1, v2;
 	int				addPlanes;
 	idFixedWinding	w;		// we won't overflow because MAX_PORTAL_PLANES = 20
 
-	area = &portalAreas[ areaNum ];
+	area = &floodAreas[ ps->areaNum ];
+	if ( !area->numPortals ) {
+		return 0;
+	}
 
-	// cull models and lights to the current collection of planes
-	AddAreaRefs( areaNum, ps );
+	fp = &floodPortals[ area->firstPortal ];
 
-	if ( areaScreenRect[areaNum].IsEmpty() ) {
-		areaScreenRect[areaNum] = ps->rect;
-	} else {
-		areaScreenRect[areaNum].Union( ps->rect );
-	}
+	// distance of the view origin to all the portal planes of the area
+	facing = (float *)_alloca16( area->numPortals * sizeof( float ) );
+	SIMDProcessor->Dot( facing, origin, &floodPortalPlanes[ area->firstPortal ], area->numPortals );
+
+	numChildren = 0;
 
 	// go through all the portals
-	for ( p = area->portals; p; p = p->next ) {
-#if GAMEPORTAL_PVS
-		// karin: game portals not handle like original DOOM3
-		if ( p->isGamePortal ) {
-			continue;
-		}
-#endif
+	for ( k = 0; k < area->numPortals; k++ ) {
+		p = fp[k].p;
 
 		// an enclosing door may have sealed the portal off
 		if ( p->doublePortal->blockingBits & PS_BLOCK_VIEW ) {
@@ -187,7 +306,7 @@ void idRenderWorldLocal::FloodViewThroughArea_r( const idVec3 origin, int areaNu
 		}
 
 		// make sure this portal is facing away from the view
-		d = p->plane.Distance( origin );
+		d = facing[k];
 		if ( d < -0.1f ) {
 			continue;
 		}
@@ -203,44 +322,39 @@ void idRenderWorldLocal::FloodViewThroughArea_r( const idVec3 origin, int areaNu
 			continue;	// already in stack
 		}
 
+		newStack = &children[ numChildren ];
+
 		// if we are very close to the portal surface, don't bother clipping
 		// it, which tends to give epsilon problems that make the area vanish
 		if ( d < 1.0f ) {
 
 			// go through this portal
-			newStack = *ps;
-			newStack.p = p;
-			newStack.next = ps;
-			FloodViewThroughArea_r( origin, p->intoArea, &newStack );
+			*newStack = *ps;
+			newStack->p = p;
+			newStack->next = ps;
+			newStack->areaNum = p->intoArea;
+			newStack->checkFog = false;
+			numChildren++;
 			continue;
 		}
 
 		// clip the portal winding to all of the planes
-		w = *p->w;
-		for ( j = 0; j < ps->numPortalPlanes; j++ ) {
-			if ( !w.ClipInPlace( -ps->portalPlanes[j], 0 ) ) {
-				break;
-			}
-		}
-		if ( !w.GetNumPoints() ) {
+		if ( !R_ClipFloodPortal( &fp[k], ps, w ) ) {
 			continue;	// portal not visible
 		}
 
-		// see if it is fogged out
-		if ( PortalIsFoggedOut( p ) ) {
-			continue;
-		}
-
 		// go through this portal
-		newStack.p = p;
-		newStack.next = ps;
+		newStack->p = p;
+		newStack->next = ps;
+		newStack->areaNum = p->intoArea;
+		newStack->checkFog = true;
 
 		// find the screen pixel bounding box of the remaining portal
 		// so we can scissor things outside it
-		newStack.rect = ScreenRectFromWinding( &w, &tr.identitySpace );
+		newStack->rect = ScreenRectFromWinding( &w, &tr.identitySpace );
 
 		// slop might have spread it a pixel outside, so trim it back
-		newStack.rect.Intersect( ps->rect );
+		newStack->rect.Intersect( ps->rect );
 
 		// generate a set of clipping planes that will further restrict
 		// the visible view beyond just the scissor rect
@@ -250,7 +364,7 @@ void idRenderWorldLocal::FloodViewThroughArea_r( const idVec3 origin, int areaNu
 			addPlanes = MAX_PORTAL_PLANES;
 		}
 
-		newStack.numPortalPlanes = 0;
+		newStack->numPortalPlanes = 0;
 		for ( i = 0; i < addPlanes; i++ ) {
 			j = i+1;
 			if ( j == w.GetNumPoints() ) {
@@ -260,22 +374,137 @@ void idRenderWorldLocal::FloodViewThroughArea_r( const idVec3 origin, int areaNu
 			v1 = origin - w[i].ToVec3();
 			v2 = origin - w[j].ToVec3();
 
-			newStack.portalPlanes[newStack.numPortalPlanes].Normal().Cross( v2, v1 );
+			newStack->portalPlanes[newStack->numPortalPlanes].Normal().Cross( v2, v1 );
 
 			// if it is degenerate, skip the plane
-			if ( newStack.portalPlanes[newStack.numPortalPlanes].Normalize() < 0.01f ) {
+			if ( newStack->portalPlanes[newStack->numPortalPlanes].Normalize() < 0.01f ) {
 				continue;
 			}
-			newStack.portalPlanes[newStack.numPortalPlanes].FitThroughPoint( origin );
+			newStack->portalPlanes[newStack->numPortalPlanes].FitThroughPoint( origin );
 
-			newStack.numPortalPlanes++;
+			newStack->numPortalPlanes++;
 		}
 
 		// the last stack plane is the portal plane
-		newStack.portalPlanes[newStack.numPortalPlanes] = p->plane;
-		newStack.numPortalPlanes++;
+		newStack->portalPlanes[newStack->numPortalPlanes] = p->plane;
+		newStack->numPortalPlanes++;
+
+		numChildren++;
+	}
+
+	return numChildren;
+}
+
+typedef struct {
+	idRenderWorldLocal *	world;
+	idVec3					origin;
+	const portalStack_t **	stacks;
+	portalStack_t *			children;
+	int *					firstChild;
+	int *					numChildren;
+} floodLevel_t;
+
+/*
+===================
+R_ExpandViewPortalStacks
+
+Runs on the job workers for r_parallelPortalFlood
+===================
+*/
+static void R_ExpandViewPortalStacks( void *data, int first, int last ) {
+	floodLevel_t *level = (floodLevel_t *)data;
+
+	for ( int i = first; i < last; i++ ) {
+		level->numChildren[i] = level->world->ExpandViewPortalStack( level->origin, level->stacks[i], level->children + level->firstChild[i] );
+	}
+}
+
+/*
+===================
+FloodViewThroughAreas
+
+Floods breadth first from the area of ps, one level of portal stacks at a
+time.  The stacks of the next level are allocated from frame memory, so
+their next pointers stay valid until the whole flood is done.  Adding the
+area references is always done serially, only the portal clipping of a
+level is spread over the job workers.
+===================
+*/
+void idRenderWorldLocal::FloodViewThroughAreas( const idVec3 origin, const portalStack_t *ps ) {
+	const portalStack_t	**stacks, **nextStacks;
+	int				numStacks, numNextStacks;
+	int				i, j, maxChildren;
+	floodLevel_t	level;
+
+	if ( !floodAreas ) {
+		BuildFloodPortals();
+	}
+
+	level.world = this;
+	level.origin = origin;
+
+	stacks = (const portalStack_t **)R_FrameAlloc( sizeof( stacks[0] ) );
+	stacks[0] = ps;
+	numStacks = 1;
+
+	while ( numStacks > 0 ) {
+		maxChildren = 0;
+
+		for ( i = 0; i < numStacks; i++ ) {
+			const portalStack_t *check = stacks[i];
+
+			// cull models and lights to the current collection of planes
+			AddAreaRefs( check->areaNum, check );
+
+			if ( areaScreenRect[check->areaNum].IsEmpty() ) {
+				areaScreenRect[check->areaNum] = check->rect;
+			} else {
+				areaScreenRect[check->areaNum].Union( check->rect );
+			}
+
+			maxChildren += floodAreas[check->areaNum].numPortals;
+		}
+
+		if ( !maxChildren ) {
+			break;
+		}
+
+		level.stacks = stacks;
+		level.children = (portalStack_t *)R_FrameAlloc( maxChildren * sizeof( level.children[0] ) );
+		level.firstChild = (int *)R_FrameAlloc( numStacks * sizeof( level.firstChild[0] ) );
+		level.numChildren = (int *)R_FrameAlloc( numStacks * sizeof( level.numChildren[0] ) );
+
+		maxChildren = 0;
+		for ( i = 0; i < numStacks; i++ ) {
+			level.firstChild[i] = maxChildren;
+			maxChildren += floodAreas[stacks[i]->areaNum].numPortals;
+		}
+
+		if ( r_parallelPortalFlood.GetBool() && numStacks > 1 && jobSystem->GetNumWorkers() > 0 ) {
+			jobSystem->ParallelFor( numStacks, 1, R_ExpandViewPortalStacks, &level );
+		} else {
+			R_ExpandViewPortalStacks( &level, 0, numStacks );
+		}
 
-		FloodViewThroughArea_r( origin, p->intoArea, &newStack );
+		// collect the next level in the same order no matter how it was expanded
+		nextStacks = (const portalStack_t **)R_FrameAlloc( maxChildren * sizeof( nextStacks[0] ) );
+		numNextStacks = 0;
+
+		for ( i = 0; i < numStacks; i++ ) {
+			for ( j = 0; j < level.numChildren[i]; j++ ) {
+				const portalStack_t *child = &level.children[ level.firstChild[i] + j ];
+
+				// see if it is fogged out
+				if ( child->checkFog && PortalIsFoggedOut( child->p ) ) {
+					continue;
+				}
+
+				nextStacks[numNextStacks++] = child;
+			}
+		}
+
+		stacks = nextStacks;
+		numStacks = numNextStacks;
 	}
 }
 
@@ -295,6 +524,8 @@ void idRenderWorldLocal::FlowViewThroughPortals( const idVec3 origin, int numPla
 
 	ps.next = NULL;
 	ps.p = NULL;
+	ps.areaNum = tr.viewDef->areaNum;
+	ps.checkFog = false;
 
 	for ( i = 0 ; i < numPlanes ; i++ ) {
 		ps.portalPlanes[i] = planes[i];
@@ -320,7 +551,7 @@ void idRenderWorldLocal::FlowViewThroughPortals( const idVec3 origin, int numPla
 		}
 
 		// flood out through portals, setting area viewCount
-		FloodViewThroughArea_r( origin, tr.viewDef->areaNum, &ps );
+		FloodViewThroughAreas( origin, &ps );
 	}
 }
 
@@ -1298,6 +1529,9 @@ void idRenderWorldLocal::RegisterGamePortals( idMapFile *mapFile ) {
 
 	doublePortals = gameDoublePortals;
 
+	// the area portal lists are about to change
+	FreeFloodPortals();
+
 	gamePortalInfos.Resize(numGamePortals);
 
 	for ( i = 0; i < numGamePortals; i++ ) {
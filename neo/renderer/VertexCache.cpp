@@ -35,6 +35,7 @@ static const int	FRAME_MEMORY_BYTES = 0x200000;
 static const int	EXPAND_HEADERS = 1024;
 
 idCVar idVertexCache::r_showVertexCache( "r_showVertexCache", "0", CVAR_INTEGER|CVAR_RENDERER, "" );
+idCVar idVertexCache::r_useMappedVertexCache( "r_useMappedVertexCache", "1", CVAR_BOOL|CVAR_RENDERER, "keep the frame temp vertex memory persistently mapped if GL_ARB_buffer_storage is available, needs vid_restart" );
 
 idVertexCache		vertexCache;
 
@@ -151,25 +152,37 @@ void idVertexCache::Init() {
 	// initialize the cache memory blocks
 	freeStaticHeaders.next = freeStaticHeaders.prev = &freeStaticHeaders;
 	staticHeaders.next = staticHeaders.prev = &staticHeaders;
-	freeDynamicHeaders.next = freeDynamicHeaders.prev = &freeDynamicHeaders;
-	dynamicHeaders.next = dynamicHeaders.prev = &dynamicHeaders;
-	deferredFreeList.next = deferredFreeList.prev = &deferredFreeList;
+	for ( int i = 0 ; i < NUM_VERTEX_FRAMES ; i++ ) {
+		deferredFreeList[i].next = deferredFreeList[i].prev = &deferredFreeList[i];
+		if ( !tempHeaders[i] ) {
+			tempHeaders[i] = (vertCache_t *)Mem_Alloc( MAX_FRAME_TEMP_HEADERS * sizeof( vertCache_t ) );
+		}
+		// any fences went away with the old context on a vid_restart
+		tempFences[i] = NULL;
+	}
 
 	// set up the dynamic frame memory
 	frameBytes = FRAME_MEMORY_BYTES;
 	staticAllocTotal = 0;
 
-	byte	*junk = (byte *)Mem_Alloc( frameBytes );
-	for ( int i = 0 ; i < NUM_VERTEX_FRAMES ; i++ ) {
-		allocatingTempBuffer = true;	// force the alloc to use GL_STREAM_DRAW_ARB
-		Alloc( junk, frameBytes, &tempBuffers[i] );
-		allocatingTempBuffer = false;
-		tempBuffers[i]->tag = TAG_FIXED;
-		// unlink these from the static list, so they won't ever get purged
-		tempBuffers[i]->next->prev = tempBuffers[i]->prev;
-		tempBuffers[i]->prev->next = tempBuffers[i]->next;
+	const int ringBytes = frameBytes * NUM_VERTEX_FRAMES;
+
+	qglGenBuffersARB( 1, &tempRing );
+	qglBindBufferARB( GL_ARRAY_BUFFER_ARB, tempRing );
+
+	tempRingMapped = NULL;
+	if ( glConfig.ARBBufferStorageAvailable && glConfig.ARBSyncAvailable && r_useMappedVertexCache.GetBool() ) {
+		const GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		// dynamic storage so it still works with glBufferSubData if the map fails
+		qglBufferStorage( GL_ARRAY_BUFFER_ARB, (GLsizeiptrARB)ringBytes, NULL, mapFlags | GL_DYNAMIC_STORAGE_BIT );
+		tempRingMapped = (byte *)qglMapBufferRange( GL_ARRAY_BUFFER_ARB, 0, (GLsizeiptrARB)ringBytes, mapFlags );
+		if ( !tempRingMapped ) {
+			common->Warning( "idVertexCache::Init: couldn't map the frame temp memory" );
+		}
+	} else {
+		qglBufferDataARB( GL_ARRAY_BUFFER_ARB, (GLsizeiptrARB)ringBytes, NULL, GL_STREAM_DRAW_ARB );
 	}
-	Mem_Free( junk );
 
 	EndFrame();
 }
@@ -196,6 +209,26 @@ idVertexCache::Shutdown
 void idVertexCache::Shutdown() {
 //	PurgeAll();	// !@#: also purge the temp buffers
 
+	for ( int i = 0 ; i < NUM_VERTEX_FRAMES ; i++ ) {
+		if ( tempFences[i] ) {
+			qglDeleteSync( tempFences[i] );
+			tempFences[i] = NULL;
+		}
+		Mem_Free( tempHeaders[i] );
+		tempHeaders[i] = NULL;
+	}
+
+	if ( tempRing ) {
+		if ( tempRingMapped ) {
+			qglBindBufferARB( GL_ARRAY_BUFFER_ARB, tempRing );
+			qglUnmapBufferARB( GL_ARRAY_BUFFER_ARB );
+			qglBindBufferARB( GL_ARRAY_BUFFER_ARB, 0 );
+			tempRingMapped = NULL;
+		}
+		qglDeleteBuffersARB( 1, &tempRing );
+		tempRing = 0;
+	}
+
 	headerAllocator.Shutdown();
 }
 
@@ -266,11 +299,7 @@ void idVertexCache::Alloc( void *data, int size, vertCache_t **buffer, bool inde
 		qglBufferDataARB( GL_ELEMENT_ARRAY_BUFFER_ARB, (GLsizeiptrARB)size, data, GL_STATIC_DRAW_ARB );
 	} else {
 		qglBindBufferARB( GL_ARRAY_BUFFER_ARB, block->vbo );
-		if ( allocatingTempBuffer ) {
-			qglBufferDataARB( GL_ARRAY_BUFFER_ARB, (GLsizeiptrARB)size, data, GL_STREAM_DRAW_ARB );
-		} else {
-			qglBufferDataARB( GL_ARRAY_BUFFER_ARB, (GLsizeiptrARB)size, data, GL_STATIC_DRAW_ARB );
-		}
+		qglBufferDataARB( GL_ARRAY_BUFFER_ARB, (GLsizeiptrARB)size, data, GL_STATIC_DRAW_ARB );
 	}
 }
 
@@ -327,10 +356,44 @@ void idVertexCache::Free( vertCache_t *block ) {
 	block->next->prev = block->prev;
 	block->prev->next = block->next;
 
-	block->next = deferredFreeList.next;
-	block->prev = &deferredFreeList;
-	deferredFreeList.next->prev = block;
-	deferredFreeList.next = block;
+	block->next = deferredFreeList[listNum].next;
+	block->prev = &deferredFreeList[listNum];
+	deferredFreeList[listNum].next->prev = block;
+	deferredFreeList[listNum].next = block;
+}
+
+/*
+===========
+idVertexCache::AllocTempHeader
+
+Bumps the frame temp offset and header count of the current frame,
+returns NULL if either of them is exhausted.
+===========
+*/
+vertCache_t *idVertexCache::AllocTempHeader( int size ) {
+	// keep every allocation 16 byte aligned
+	const int alignedSize = ( size + 15 ) & ~15;
+
+	const int end = Sys_InterlockedAdd( &dynamicAllocThisFrame, alignedSize );
+	if ( end > frameBytes ) {
+		return NULL;
+	}
+	const int count = Sys_InterlockedAdd( &dynamicCountThisFrame, 1 );
+	if ( count > MAX_FRAME_TEMP_HEADERS ) {
+		return NULL;
+	}
+
+	vertCache_t *block = &tempHeaders[listNum][count - 1];
+	block->vbo = tempRing;
+	block->indexBuffer = false;
+	block->offset = listNum * frameBytes + end - alignedSize;
+	block->size = size;
+	block->tag = TAG_TEMP;
+	block->user = NULL;
+	block->next = block->prev = NULL;
+	block->frameUsed = 0;
+
+	return block;
 }
 
 /*
@@ -349,7 +412,14 @@ vertCache_t	*idVertexCache::AllocFrameTemp( void *data, int size ) {
 		common->Error( "idVertexCache::AllocFrameTemp: size = %i\n", size );
 	}
 
-	if ( dynamicAllocThisFrame + size > frameBytes ) {
+	// only the main thread can make GL calls
+	assert( tempRingMapped || Sys_IsMainThread() );
+
+	block = AllocTempHeader( size );
+	if ( !block ) {
+		if ( !Sys_IsMainThread() ) {
+			return NULL;
+		}
 		// if we don't have enough room in the temp block, allocate a static block,
 		// but immediately free it so it will get freed at the next frame
 		tempOverflow = true;
@@ -358,46 +428,57 @@ vertCache_t	*idVertexCache::AllocFrameTemp( void *data, int size ) {
 		return block;
 	}
 
-	// this data is just going on the shared dynamic list
+	// copy the data
+	if ( tempRingMapped ) {
+		SIMDProcessor->Memcpy( tempRingMapped + block->offset, data, size );
+	} else {
+		qglBindBufferARB( GL_ARRAY_BUFFER_ARB, block->vbo );
+		qglBufferSubDataARB( GL_ARRAY_BUFFER_ARB, block->offset, (GLsizeiptrARB)size, data );
+	}
 
-	// if we don't have any remaining unused headers, allocate some more
-	if ( freeDynamicHeaders.next == &freeDynamicHeaders ) {
+	return block;
+}
 
-		for ( int i = 0; i < EXPAND_HEADERS; i++ ) {
-			block = headerAllocator.Alloc();
-			block->next = freeDynamicHeaders.next;
-			block->prev = &freeDynamicHeaders;
-			block->next->prev = block;
-			block->prev->next = block;
-		}
+/*
+===========
+idVertexCache::MapFrameTemp
+===========
+*/
+void *idVertexCache::MapFrameTemp( int size, vertCache_t **buffer ) {
+	*buffer = NULL;
+
+	if ( !tempRingMapped ) {
+		return NULL;
 	}
 
-	// move it from the freeDynamicHeaders list to the dynamicHeaders list
-	block = freeDynamicHeaders.next;
-	block->next->prev = block->prev;
-	block->prev->next = block->next;
-	block->next = dynamicHeaders.next;
-	block->prev = &dynamicHeaders;
-	block->next->prev = block;
-	block->prev->next = block;
+	if ( size <= 0 ) {
+		common->Error( "idVertexCache::MapFrameTemp: size = %i\n", size );
+	}
 
-	block->size = size;
-	block->tag = TAG_TEMP;
-	block->indexBuffer = false;
-	block->offset = dynamicAllocThisFrame;
-	dynamicAllocThisFrame += block->size;
-	dynamicCountThisFrame++;
-	block->user = NULL;
-	block->frameUsed = 0;
+	vertCache_t *block = AllocTempHeader( size );
+	if ( !block ) {
+		tempOverflow = true;
+		return NULL;
+	}
 
-	// copy the data
-	block->vbo = tempBuffers[listNum]->vbo;
+	*buffer = block;
+	return tempRingMapped + block->offset;
+}
 
-	assert( block->vbo );
-	qglBindBufferARB( GL_ARRAY_BUFFER_ARB, block->vbo );
-	qglBufferSubDataARB( GL_ARRAY_BUFFER_ARB, block->offset, (GLsizeiptrARB)size, data );
+/*
+===========
+idVertexCache::FenceFrameTemp
+===========
+*/
+void idVertexCache::FenceFrameTemp( int frameTempNum ) {
+	if ( !tempRingMapped ) {
+		return;
+	}
 
-	return block;
+	if ( tempFences[frameTempNum] ) {
+		qglDeleteSync( tempFences[frameTempNum] );
+	}
+	tempFences[frameTempNum] = qglFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
 }
 
 /*
@@ -421,7 +502,7 @@ void idVertexCache::EndFrame() {
 		const char *frameOverflow = tempOverflow ? "(OVERFLOW)" : "";
 
 		common->Printf( "vertex dynamic:%i=%ik%s, static alloc:%i=%ik used:%i=%ik total:%i=%ik\n",
-			dynamicCountThisFrame, dynamicAllocThisFrame/1024, frameOverflow,
+			Min( dynamicCountThisFrame, MAX_FRAME_TEMP_HEADERS ), Min( dynamicAllocThisFrame, frameBytes )/1024, frameOverflow,
 			staticCountThisFrame, staticAllocThisFrame/1024,
 			staticUseCount, staticUseSize/1024,
 			staticCountTotal, staticAllocTotal/1024 );
@@ -441,27 +522,34 @@ void idVertexCache::EndFrame() {
 	qglBindBufferARB( GL_ELEMENT_ARRAY_BUFFER_ARB, 0 );
 
 	currentFrame = tr.frameCount;
-	listNum = currentFrame % NUM_VERTEX_FRAMES;
+	// alternate strictly, tr.frameCount isn't guaranteed to advance between two EndFrame calls
+	listNum = ( listNum + 1 ) % NUM_VERTEX_FRAMES;
 	staticAllocThisFrame = 0;
 	staticCountThisFrame = 0;
 	dynamicAllocThisFrame = 0;
 	dynamicCountThisFrame = 0;
 	tempOverflow = false;
 
+	// the lists of the new listNum were filled NUM_VERTEX_FRAMES ago,
+	// so the back end is done with them even when running with r_smp
+
 	// free all the deferred free headers
-	while( deferredFreeList.next != &deferredFreeList ) {
-		ActuallyFree( deferredFreeList.next );
+	while( deferredFreeList[listNum].next != &deferredFreeList[listNum] ) {
+		ActuallyFree( deferredFreeList[listNum].next );
 	}
 
-	// free all the frame temp headers
-	vertCache_t	*block = dynamicHeaders.next;
-	if ( block != &dynamicHeaders ) {
-		block->prev = &freeDynamicHeaders;
-		dynamicHeaders.prev->next = freeDynamicHeaders.next;
-		freeDynamicHeaders.next->prev = dynamicHeaders.prev;
-		freeDynamicHeaders.next = block;
-
-		dynamicHeaders.next = dynamicHeaders.prev = &dynamicHeaders;
+	// the frame temp headers of the section are simply reused, but the GPU
+	// may still be reading the mapped memory, wait for its fence
+	if ( tempFences[listNum] ) {
+		GLenum result;
+		do {
+			result = qglClientWaitSync( tempFences[listNum], GL_SYNC_FLUSH_COMMANDS_BIT, 1000 * 1000 * 1000 );
+		} while ( result == GL_TIMEOUT_EXPIRED );
+		if ( result == GL_WAIT_FAILED ) {
+			common->Warning( "idVertexCache::EndFrame: glClientWaitSync failed" );
+		}
+		qglDeleteSync( tempFences[listNum] );
+		tempFences[listNum] = NULL;
 	}
 }
 
@@ -490,15 +578,10 @@ void idVertexCache::List( void ) {
 		numFreeStaticHeaders++;
 	}
 
-	int	numFreeDynamicHeaders = 0;
-	for ( block = freeDynamicHeaders.next ; block != &freeDynamicHeaders ; block = block->next ) {
-		numFreeDynamicHeaders++;
-	}
-
-	common->Printf( "%i dynamic temp buffers of %ik\n", NUM_VERTEX_FRAMES, frameBytes / 1024 );
+	common->Printf( "%i dynamic temp sections of %ik in a ring buffer%s\n", NUM_VERTEX_FRAMES, frameBytes / 1024,
+		tempRingMapped ? " (persistently mapped)" : "" );
 	common->Printf( "%5i active static headers\n", numActive );
 	common->Printf( "%5i free static headers\n", numFreeStaticHeaders );
-	common->Printf( "%5i free dynamic headers\n", numFreeDynamicHeaders );
 	common->Printf( "Vertex cache is in ARB_vertex_buffer_object memory (FAST).\n");
 
 	if ( r_useIndexBuffers.GetBool() ) {
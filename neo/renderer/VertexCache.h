@@ -34,10 +34,12 @@ If you have questions concerning this license or the applicable additional terms
 
 const int NUM_VERTEX_FRAMES = 2;
 
+// most frame temp allocations that can be made in a single frame
+const int MAX_FRAME_TEMP_HEADERS = 16384;
+
 typedef enum {
 	TAG_FREE,
 	TAG_USED,
-	TAG_FIXED,		// for the temp buffers
 	TAG_TEMP		// in frame temp area, not static area
 } vertBlockTag_t;
 
@@ -84,8 +86,26 @@ public:
 	// will change every frame.
 	// will return NULL if the vertex cache is completely full
 	// As with Position(), this may not actually be a pointer you can access.
+	// When the frame temp memory is persistently mapped this doesn't make
+	// any GL calls and can be used by several front end threads at once.
 	vertCache_t	*	AllocFrameTemp( void *data, int bytes );
 
+	// allocates frame temp memory like AllocFrameTemp, but returns a pointer
+	// the data can be written to directly, so it doesn't have to be built
+	// somewhere else first. The memory is write combined, it should be
+	// written sequentially and never read.
+	// Returns NULL if the frame temp memory isn't persistently mapped or
+	// is full, AllocFrameTemp() has to be used then.
+	void *			MapFrameTemp( int bytes, vertCache_t **buffer );
+
+	// the frame temp section the front end is currently allocating from
+	int				GetFrameTempNum() const { return listNum; }
+
+	// called by the back end after it has submitted the last command that
+	// used the frame temp section, it can't be written again until the GPU
+	// has passed that point
+	void			FenceFrameTemp( int frameTempNum );
+
 	// notes that a buffer is used this frame, so it can't be purged
 	// out from under the GPU
 	void			Touch( vertCache_t *buffer );
@@ -106,31 +126,37 @@ public:
 private:
 	void			InitMemoryBlocks( int size );
 	void			ActuallyFree( vertCache_t *block );
+	vertCache_t *	AllocTempHeader( int bytes );
 
 	static idCVar	r_showVertexCache;
+	static idCVar	r_useMappedVertexCache;
 
 	int				staticCountTotal;
 	int				staticAllocTotal;		// for end of frame purging
 
 	int				staticAllocThisFrame;	// debug counter
 	int				staticCountThisFrame;
-	int				dynamicAllocThisFrame;
+	int				dynamicAllocThisFrame;	// bumped atomically, may go past frameBytes on overflow
 	int				dynamicCountThisFrame;
 
 	int				currentFrame;			// for purgable block tracking
-	int				listNum;				// currentFrame % NUM_VERTEX_FRAMES, determines which tempBuffers to use
-
-	bool			allocatingTempBuffer;	// force GL_STREAM_DRAW_ARB
-
-	vertCache_t		*tempBuffers[NUM_VERTEX_FRAMES];		// allocated at startup
+	int				listNum;				// advanced by every EndFrame, determines which tempBuffers to use
+
+	// all frame temp memory is a single ring buffer, every frame allocates
+	// from its own section of frameBytes, which is reused NUM_VERTEX_FRAMES
+	// later. With r_smp the back end may still be drawing the previous frame.
+	GLuint			tempRing;
+	byte *			tempRingMapped;			// NULL if not persistently mapped
+	GLsync			tempFences[NUM_VERTEX_FRAMES];	// only used when persistently mapped
+	vertCache_t *	tempHeaders[NUM_VERTEX_FRAMES];	// MAX_FRAME_TEMP_HEADERS each, allocated at startup
 	bool			tempOverflow;			// had to alloc a temp in static memory
 
 	idBlockAlloc<vertCache_t,1024>	headerAllocator;
 
 	vertCache_t		freeStaticHeaders;		// head of doubly linked list
-	vertCache_t		freeDynamicHeaders;		// head of doubly linked list
-	vertCache_t		dynamicHeaders;			// head of doubly linked list
-	vertCache_t		deferredFreeList;		// head of doubly linked list
+
+	// deferred frees are kept for NUM_VERTEX_FRAMES
+	vertCache_t		deferredFreeList[NUM_VERTEX_FRAMES];	// head of doubly linked list
 	vertCache_t		staticHeaders;			// head of doubly linked list in MRU order,
 											// staticHeaders.next is most recently used
 
@@ -681,7 +681,7 @@ void RB_STD_T_RenderShaderPasses( const drawSurf_t *surf ) {
 	for ( stage = 0; stage < shader->GetNumStages() ; stage++ ) {
 		pStage = shader->GetStage(stage);
 
-		if ( tr.IsScopeView() ) {
+		if ( backEnd.scopeView ) {
 			if ( pStage->isNotScopeView ) {
 				continue;
 			}
@@ -691,7 +691,7 @@ void RB_STD_T_RenderShaderPasses( const drawSurf_t *surf ) {
 			}
 		}
 
-		if ( !tr.IsShuttleView() ) {
+		if ( !backEnd.shuttleView ) {
 			if ( pStage->isShuttleView ) {
 				continue;
 			}
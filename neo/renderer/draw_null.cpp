@@ -0,0 +1,358 @@
+/*
+===========================================================================
+
+Doom 3 GPL Source Code
+Copyright (C) 1999-2011 id Software LLC, a ZeniMax Media company.
+
+This file is part of the Doom 3 GPL Source Code ("Doom 3 Source Code").
+
+Doom 3 Source Code is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Doom 3 Source Code is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Doom 3 Source Code.  If not, see <http://www.gnu.org/licenses/>.
+
+In addition, the Doom 3 Source Code is also subject to certain additional terms. You should have received a copy of these additional terms immediately following the terms and conditions of the GNU General Public License which accompanied the Doom 3 Source Code.  If not, please request a copy in writing from id Software at the address below.
+
+If you have questions concerning this license or the applicable additional terms, you may contact in writing id Software LLC, c/o ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+
+===========================================================================
+*/
+#include "precompiled.h"
+#pragma hdrstop
+
+#include "tr_local.h"
+
+extern int backEndStartTime, backEndFinishTime;
+
+/*
+
+  null back end
+
+  With r_nullBackend set the renderer doesn't create a window or GL context.
+  All qgl functions are pointed at stubs that only return plausible values,
+  so the whole front end (view setup, light and model surfaces, interactions,
+  shadow volumes, draw surface sorting) runs unchanged, while the back end
+  only counts what it would have drawn. This makes timedemo usable as a front
+  end benchmark on machines without a GPU.
+
+*/
+
+static const char *nullExtensions =
+	"GL_ARB_multitexture GL_ARB_texture_env_combine GL_ARB_texture_cube_map "
+	"GL_ARB_texture_env_dot3 GL_ARB_texture_env_add GL_ARB_texture_non_power_of_two "
+	"GL_EXT_texture_filter_anisotropic GL_EXT_stencil_wrap GL_EXT_stencil_two_side "
+	"GL_ARB_vertex_buffer_object GL_ARB_vertex_program GL_ARB_fragment_program "
+	"EXT_depth_bounds_test";
+
+static GLuint	nullObjectNum;
+
+typedef struct {
+	int		frames;
+	int		views;
+	int		drawElements;
+	int		drawIndexes;
+	int		shadowElements;
+	int		shadowIndexes;
+	int		interactions;
+	int		copyRenders;
+} nullBackEndTotals_t;
+
+static nullBackEndTotals_t	nullTotals;
+
+static void APIENTRY RB_NullProc( void ) {
+}
+
+static GLenum APIENTRY RB_NullGetError( void ) {
+	return GL_NO_ERROR;
+}
+
+static const GLubyte * APIENTRY RB_NullGetString( GLenum name ) {
+	switch ( name ) {
+	case GL_VENDOR:
+		return (const GLubyte *)"null";
+	case GL_RENDERER:
+		return (const GLubyte *)"null back end";
+	case GL_VERSION:
+		return (const GLubyte *)"2.0";
+	case GL_EXTENSIONS:
+		return (const GLubyte *)nullExtensions;
+	}
+	return (const GLubyte *)"";
+}
+
+static void APIENTRY RB_NullGetIntegerv( GLenum pname, GLint *params ) {
+	switch ( pname ) {
+	case GL_MAX_TEXTURE_SIZE:
+		*params = 4096;
+		break;
+	case GL_MAX_TEXTURE_UNITS_ARB:
+	case GL_MAX_TEXTURE_COORDS_ARB:
+		*params = 8;
+		break;
+	case GL_MAX_TEXTURE_IMAGE_UNITS_ARB:
+		*params = 16;
+		break;
+	case GL_PROGRAM_ERROR_POSITION_ARB:
+		*params = -1;
+		break;
+	default:
+		*params = 0;
+		break;
+	}
+}
+
+static void APIENTRY RB_NullGetFloatv( GLenum pname, GLfloat *params ) {
+	if ( pname == GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT ) {
+		*params = 16.0f;
+	} else {
+		*params = 0.0f;
+	}
+}
+
+static void APIENTRY RB_NullGenObjects( GLsizei n, GLuint *names ) {
+	for ( int i = 0 ; i < n ; i++ ) {
+		names[i] = ++nullObjectNum;
+	}
+}
+
+static GLuint APIENTRY RB_NullGenLists( GLsizei range ) {
+	GLuint base = nullObjectNum + 1;
+	nullObjectNum += range;
+	return base;
+}
+
+static GLboolean APIENTRY RB_NullFalse( void ) {
+	return GL_FALSE;
+}
+
+static GLboolean APIENTRY RB_NullTrue( void ) {
+	return GL_TRUE;
+}
+
+static GLint APIENTRY RB_NullZero( void ) {
+	return 0;
+}
+
+static void * APIENTRY RB_NullMapBuffer( GLenum target, GLenum access ) {
+	return NULL;
+}
+
+/*
+==================
+RB_NullGetProcAddress
+
+Used instead of GLimp_ExtensionPointer() when r_nullBackend is set.
+Functions that return something or write to a pointer get a stub that
+behaves plausibly, everything else is a no-op.
+==================
+*/
+GLExtension_t RB_NullGetProcAddress( const char *name ) {
+	static const struct {
+		const char *	name;
+		GLExtension_t	proc;
+	} nullProcs[] = {
+		{ "glGetError",				(GLExtension_t)RB_NullGetError },
+		{ "glGetString",			(GLExtension_t)RB_NullGetString },
+		{ "glGetIntegerv",			(GLExtension_t)RB_NullGetIntegerv },
+		{ "glGetFloatv",			(GLExtension_t)RB_NullGetFloatv },
+		{ "glGenTextures",			(GLExtension_t)RB_NullGenObjects },
+		{ "glGenBuffersARB",		(GLExtension_t)RB_NullGenObjects },
+		{ "glGenProgramsARB",		(GLExtension_t)RB_NullGenObjects },
+		{ "glGenLists",				(GLExtension_t)RB_NullGenLists },
+		{ "glIsEnabled",			(GLExtension_t)RB_NullFalse },
+		{ "glIsList",				(GLExtension_t)RB_NullFalse },
+		{ "glIsTexture",			(GLExtension_t)RB_NullFalse },
+		{ "glIsBufferARB",			(GLExtension_t)RB_NullFalse },
+		{ "glAreTexturesResident",	(GLExtension_t)RB_NullTrue },
+		{ "glUnmapBufferARB",		(GLExtension_t)RB_NullTrue },
+		{ "glRenderMode",			(GLExtension_t)RB_NullZero },
+		{ "glMapBufferARB",			(GLExtension_t)RB_NullMapBuffer },
+		{ NULL,						NULL }
+	};
+
+	for ( int i = 0 ; nullProcs[i].name ; i++ ) {
+		if ( !idStr::Cmp( nullProcs[i].name, name ) ) {
+			return nullProcs[i].proc;
+		}
+	}
+	return (GLExtension_t)RB_NullProc;
+}
+
+/*
+==================
+RB_NullShadowIndexes
+
+Same cap selection as RB_T_Shadow()
+==================
+*/
+static int RB_NullShadowIndexes( const viewLight_t *vLight, const drawSurf_t *surf ) {
+	const srfTriangles_t *tri = surf->geo;
+
+	if ( !r_useExternalShadows.GetInteger() ) {
+		return tri->numIndexes;
+	}
+	if ( r_useExternalShadows.GetInteger() == 2 || !( surf->dsFlags & DSF_VIEW_INSIDE_SHADOW ) ) {
+		return tri->numShadowIndexesNoCaps;
+	}
+	if ( !vLight->viewInsideLight && !( tri->shadowCapPlaneBits & SHADOW_CAP_INFINITE ) ) {
+		if ( vLight->viewSeesShadowPlaneBits & tri->shadowCapPlaneBits ) {
+			return tri->numShadowIndexesNoFrontCaps;
+		}
+		return tri->numShadowIndexesNoCaps;
+	}
+	return tri->numIndexes;
+}
+
+/*
+==================
+RB_NullCountShadows
+==================
+*/
+static void RB_NullCountShadows( const viewLight_t *vLight, const drawSurf_t *surf ) {
+	for ( ; surf ; surf = surf->nextOnLight ) {
+		if ( !surf->geo->shadowCache ) {
+			continue;
+		}
+		int numIndexes = RB_NullShadowIndexes( vLight, surf );
+		backEnd.pc.c_shadowElements++;
+		backEnd.pc.c_shadowIndexes += numIndexes;
+		backEnd.pc.c_shadowVertexes += surf->geo->numVerts;
+		nullTotals.shadowElements++;
+		nullTotals.shadowIndexes += numIndexes;
+	}
+}
+
+/*
+==================
+RB_NullCountSurface
+==================
+*/
+static void RB_NullCountSurface( const srfTriangles_t *tri ) {
+	backEnd.pc.c_drawElements++;
+	backEnd.pc.c_drawIndexes += tri->numIndexes;
+	backEnd.pc.c_drawVertexes += tri->numVerts;
+	nullTotals.drawElements++;
+	nullTotals.drawIndexes += tri->numIndexes;
+}
+
+/*
+==================
+RB_NullCountInteractions
+==================
+*/
+static void RB_NullCountInteractions( const drawSurf_t *surf ) {
+	for ( ; surf ; surf = surf->nextOnLight ) {
+		RB_NullCountSurface( surf->geo );
+		nullTotals.interactions++;
+	}
+}
+
+/*
+==================
+RB_NullDrawView
+
+Counts the depth fill / shader passes of every draw surface, and the shadow
+and interaction chains of every light, roughly what RB_STD_DrawView() issues
+==================
+*/
+static void RB_NullDrawView( const drawSurfsCommand_t *cmd ) {
+	const viewDef_t	*viewDef = cmd->viewDef;
+
+	backEnd.viewDef = viewDef;
+	nullTotals.views++;
+
+	for ( int i = 0 ; i < viewDef->numDrawSurfs ; i++ ) {
+		const drawSurf_t *surf = viewDef->drawSurfs[i];
+		if ( surf->geo ) {
+			RB_NullCountSurface( surf->geo );
+		}
+	}
+
+	for ( const viewLight_t *vLight = viewDef->viewLights ; vLight ; vLight = vLight->next ) {
+		RB_NullCountShadows( vLight, vLight->globalShadows );
+		RB_NullCountShadows( vLight, vLight->localShadows );
+		RB_NullCountInteractions( vLight->localInteractions );
+		RB_NullCountInteractions( vLight->globalInteractions );
+		RB_NullCountInteractions( vLight->translucentInteractions );
+	}
+}
+
+/*
+====================
+RB_NullExecuteBackEndCommands
+
+Replaces RB_ExecuteBackEndCommands() when r_nullBackend is set
+====================
+*/
+void RB_NullExecuteBackEndCommands( const emptyCommand_t *cmds ) {
+	if ( cmds->commandId == RC_NOP && !cmds->next ) {
+		return;
+	}
+
+	backEndStartTime = Sys_Milliseconds();
+
+	// keep the image manager happy, uploads are no-ops
+	globalImages->CompleteBackgroundImageLoads();
+
+	for ( ; cmds ; cmds = (const emptyCommand_t *)cmds->next ) {
+		switch ( cmds->commandId ) {
+		case RC_NOP:
+		case RC_SET_BUFFER:
+			break;
+		case RC_DRAW_VIEW:
+			RB_NullDrawView( (const drawSurfsCommand_t *)cmds );
+			break;
+		case RC_SWAP_BUFFERS:
+			nullTotals.frames++;
+			break;
+		case RC_COPY_RENDER:
+			nullTotals.copyRenders++;
+			break;
+		default:
+			common->Error( "RB_NullExecuteBackEndCommands: bad commandId" );
+			break;
+		}
+	}
+
+	backEndFinishTime = Sys_Milliseconds();
+	backEnd.pc.msec = backEndFinishTime - backEndStartTime;
+}
+
+/*
+====================
+R_NullBackEndStats_f
+
+Prints the totals the null back end counted, "reset" clears them
+====================
+*/
+void R_NullBackEndStats_f( const idCmdArgs &args ) {
+	if ( !r_nullBackend.GetBool() ) {
+		common->Printf( "r_nullBackend is not set\n" );
+		return;
+	}
+
+	if ( args.Argc() > 1 && !idStr::Icmp( args.Argv( 1 ), "reset" ) ) {
+		memset( &nullTotals, 0, sizeof( nullTotals ) );
+		return;
+	}
+
+	int frames = Max( nullTotals.frames, 1 );
+	common->Printf( "null back end: %i frames, %i views\n", nullTotals.frames, nullTotals.views );
+	common->Printf( "%i draws (%.1f/frame), %i tris (%.1f/frame)\n",
+		nullTotals.drawElements, (float)nullTotals.drawElements / frames,
+		nullTotals.drawIndexes / 3, (float)nullTotals.drawIndexes / 3 / frames );
+	common->Printf( "%i interactions (%.1f/frame)\n",
+		nullTotals.interactions, (float)nullTotals.interactions / frames );
+	common->Printf( "%i shadow draws (%.1f/frame), %i shadow tris (%.1f/frame)\n",
+		nullTotals.shadowElements, (float)nullTotals.shadowElements / frames,
+		nullTotals.shadowIndexes / 3, (float)nullTotals.shadowIndexes / 3 / frames );
+	common->Printf( "%i render copies\n", nullTotals.copyRenders );
+}
@@ -134,6 +134,13 @@ extern PFNGLDEPTHBOUNDSEXTPROC              qglDepthBoundsEXT;
 // GL_ARB_debug_output
 extern PFNGLDEBUGMESSAGECALLBACKARBPROC    qglDebugMessageCallbackARB;
 
+// GL_ARB_buffer_storage, GL_ARB_map_buffer_range and GL_ARB_sync
+extern PFNGLBUFFERSTORAGEPROC				qglBufferStorage;
+extern PFNGLMAPBUFFERRANGEPROC				qglMapBufferRange;
+extern PFNGLFENCESYNCPROC					qglFenceSync;
+extern PFNGLCLIENTWAITSYNCPROC				qglClientWaitSync;
+extern PFNGLDELETESYNCPROC					qglDeleteSync;
+
 #if defined( _WIN32 ) && defined(ID_ALLOW_TOOLS)
 
 extern  BOOL(WINAPI * qwglSwapBuffers)(HDC);
@@ -527,6 +527,8 @@ RB_SwapBuffers
 =============
 */
 const void	RB_SwapBuffers( const void *data ) {
+	const swapBuffersCommand_t *cmd = (const swapBuffersCommand_t *)data;
+
 	// texture swapping test
 	if ( r_showImages.GetInteger() != 0 ) {
 		RB_ShowImages();
@@ -600,6 +602,9 @@ const void	RB_SwapBuffers( const void *data ) {
 			qglEnable( GL_SCISSOR_TEST );
 	}
 
+	// the frame temp vertexes of this frame can be overwritten once the GPU gets here
+	vertexCache.FenceFrameTemp( cmd->frameTempNum );
+
 	// force a gl sync if requested
 	if ( r_finish.GetBool() ) {
 		qglFinish();
@@ -701,3 +706,24 @@ void RB_ExecuteBackEndCommands( const emptyCommand_t *cmds ) {
 		backEnd.c_copyFrameBuffer = 0;
 	}
 }
+
+/*
+====================
+RB_RenderThread
+
+Runs the back end when r_smp is enabled, the front end hands over a
+command list with GLimp_WakeBackEnd() and NULL to make the thread exit
+====================
+*/
+void RB_RenderThread( void ) {
+	const emptyCommand_t *cmds;
+
+	while ( ( cmds = (const emptyCommand_t *)GLimp_BackEndSleep() ) != NULL ) {
+		RB_ExecuteBackEndCommands( cmds );
+
+		// the front end is going to read pixels with its own context
+		if ( backEnd.finishCommands ) {
+			qglFinish();
+		}
+	}
+}
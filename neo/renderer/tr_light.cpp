@@ -162,7 +162,13 @@ void R_SkyboxTexGen( drawSurf_t *surf, const idVec3 &viewOrg ) {
 
 	int numVerts = surf->geo->numVerts;
 	int size = numVerts * sizeof( idVec3 );
-	idVec3 *texCoords = (idVec3 *) _alloca16( size );
+
+	// write straight to the vertex cache if possible
+	vertCache_t *cache;
+	idVec3 *texCoords = (idVec3 *) vertexCache.MapFrameTemp( size, &cache );
+	if ( !texCoords ) {
+		texCoords = (idVec3 *) _alloca16( size );
+	}
 
 	const idDrawVert *verts = surf->geo->verts;
 	for ( i = 0; i < numVerts; i++ ) {
@@ -171,7 +177,7 @@ void R_SkyboxTexGen( drawSurf_t *surf, const idVec3 &viewOrg ) {
 		texCoords[i][2] = verts[i].xyz[2] - localViewOrigin[2];
 	}
 
-	surf->dynamicTexCoords = vertexCache.AllocFrameTemp( texCoords, size );
+	surf->dynamicTexCoords = cache ? cache : vertexCache.AllocFrameTemp( texCoords, size );
 }
 
 /*
@@ -240,7 +246,13 @@ void R_WobbleskyTexGen( drawSurf_t *surf, const idVec3 &viewOrg ) {
 
 	int numVerts = surf->geo->numVerts;
 	int size = numVerts * sizeof( idVec3 );
-	idVec3 *texCoords = (idVec3 *) _alloca16( size );
+
+	// write straight to the vertex cache if possible
+	vertCache_t *cache;
+	idVec3 *texCoords = (idVec3 *) vertexCache.MapFrameTemp( size, &cache );
+	if ( !texCoords ) {
+		texCoords = (idVec3 *) _alloca16( size );
+	}
 
 	const idDrawVert *verts = surf->geo->verts;
 	for ( i = 0; i < numVerts; i++ ) {
@@ -253,7 +265,7 @@ void R_WobbleskyTexGen( drawSurf_t *surf, const idVec3 &viewOrg ) {
 		R_LocalPointToGlobal( transform, v, texCoords[i] );
 	}
 
-	surf->dynamicTexCoords = vertexCache.AllocFrameTemp( texCoords, size );
+	surf->dynamicTexCoords = cache ? cache : vertexCache.AllocFrameTemp( texCoords, size );
 }
 
 //=======================================================================================================
@@ -980,15 +992,13 @@ bool R_IssueEntityDefCallback( idRenderEntityLocal *def ) {
 
 /*
 ===================
-R_EntityDefDynamicModel
+R_EntityDefUpdateModel
 
-Issues a deferred entity callback if necessary.
-If the model isn't dynamic, it returns the original.
-Returns the cached dynamic model if present, otherwise creates
-it and any necessary overlays
+Issues a deferred entity callback if necessary and clears the dynamic
+model snapshot if it has to be regenerated
 ===================
 */
-idRenderModel *R_EntityDefDynamicModel( idRenderEntityLocal *def ) {
+static idRenderModel *R_EntityDefUpdateModel( idRenderEntityLocal *def ) {
 	bool callbackUpdate;
 
 	// allow deferred entities to construct themselves
@@ -1015,35 +1025,65 @@ idRenderModel *R_EntityDefDynamicModel( idRenderEntityLocal *def ) {
 		R_ClearEntityDefDynamicModel( def );
 	}
 
-	// if we don't have a snapshot of the dynamic model, generate it now
-	if ( !def->dynamicModel ) {
+	return model;
+}
 
-		// instantiate the snapshot of the dynamic model, possibly reusing memory from the cached snapshot
-		def->cachedDynamicModel = model->InstantiateDynamicModel( &def->parms, tr.viewDef, def->cachedDynamicModel );
-		if ( def->cachedDynamicModel ) {
+/*
+===================
+R_EntityDefSetDynamicModel
 
-			// add any overlays to the snapshot of the dynamic model
-			if ( def->overlay && !r_skipOverlays.GetBool() ) {
-				def->overlay->AddOverlaySurfacesToModel( def->cachedDynamicModel );
-			} else {
-				idRenderModelOverlay::RemoveOverlaySurfacesFromModel( def->cachedDynamicModel );
-			}
+Adds any overlays to the new snapshot in def->cachedDynamicModel and makes it current
+===================
+*/
+static void R_EntityDefSetDynamicModel( idRenderEntityLocal *def ) {
+	if ( def->cachedDynamicModel ) {
 
-			if ( r_checkBounds.GetBool() ) {
-				idBounds b = def->cachedDynamicModel->Bounds();
-				if (	b[0][0] < def->referenceBounds[0][0] - CHECK_BOUNDS_EPSILON ||
-						b[0][1] < def->referenceBounds[0][1] - CHECK_BOUNDS_EPSILON ||
-						b[0][2] < def->referenceBounds[0][2] - CHECK_BOUNDS_EPSILON ||
-						b[1][0] > def->referenceBounds[1][0] + CHECK_BOUNDS_EPSILON ||
-						b[1][1] > def->referenceBounds[1][1] + CHECK_BOUNDS_EPSILON ||
-						b[1][2] > def->referenceBounds[1][2] + CHECK_BOUNDS_EPSILON ) {
-					common->Printf( "entity %i dynamic model exceeded reference bounds\n", def->index );
-				}
+		// add any overlays to the snapshot of the dynamic model
+		if ( def->overlay && !r_skipOverlays.GetBool() ) {
+			def->overlay->AddOverlaySurfacesToModel( def->cachedDynamicModel );
+		} else {
+			idRenderModelOverlay::RemoveOverlaySurfacesFromModel( def->cachedDynamicModel );
+		}
+
+		if ( r_checkBounds.GetBool() ) {
+			idBounds b = def->cachedDynamicModel->Bounds();
+			if (	b[0][0] < def->referenceBounds[0][0] - CHECK_BOUNDS_EPSILON ||
+					b[0][1] < def->referenceBounds[0][1] - CHECK_BOUNDS_EPSILON ||
+					b[0][2] < def->referenceBounds[0][2] - CHECK_BOUNDS_EPSILON ||
+					b[1][0] > def->referenceBounds[1][0] + CHECK_BOUNDS_EPSILON ||
+					b[1][1] > def->referenceBounds[1][1] + CHECK_BOUNDS_EPSILON ||
+					b[1][2] > def->referenceBounds[1][2] + CHECK_BOUNDS_EPSILON ) {
+				common->Printf( "entity %i dynamic model exceeded reference bounds\n", def->index );
 			}
 		}
+	}
+
+	def->dynamicModel = def->cachedDynamicModel;
+	def->dynamicModelFrameCount = tr.frameCount;
+}
 
-		def->dynamicModel = def->cachedDynamicModel;
-		def->dynamicModelFrameCount = tr.frameCount;
+/*
+===================
+R_EntityDefDynamicModel
+
+Issues a deferred entity callback if necessary.
+If the model isn't dynamic, it returns the original.
+Returns the cached dynamic model if present, otherwise creates
+it and any necessary overlays
+===================
+*/
+idRenderModel *R_EntityDefDynamicModel( idRenderEntityLocal *def ) {
+	idRenderModel *model = R_EntityDefUpdateModel( def );
+
+	if ( model->IsDynamicModel() == DM_STATIC ) {
+		return model;
+	}
+
+	// if we don't have a snapshot of the dynamic model, generate it now
+	if ( !def->dynamicModel ) {
+		// instantiate the snapshot of the dynamic model, possibly reusing memory from the cached snapshot
+		def->cachedDynamicModel = model->InstantiateDynamicModel( &def->parms, tr.viewDef, def->cachedDynamicModel );
+		R_EntityDefSetDynamicModel( def );
 	}
 
 	// set model depth hack value
@@ -1335,6 +1375,126 @@ idScreenRect R_CalcEntityScissorRectangle( viewEntity_t *vEntity ) {
 	return R_ScreenRectFromViewFrustumBounds( bounds );
 }
 
+typedef struct {
+	idRenderEntityLocal *		def;
+	idRenderModelStatic *		model;
+	const viewDef_t *			viewDef;
+} deferredModel_t;
+
+/*
+===================
+R_FinishDynamicModels
+
+Runs on the job workers
+===================
+*/
+static void R_FinishDynamicModels( void *data, int first, int last ) {
+	const deferredModel_t *deferred = (const deferredModel_t *)data;
+
+	for ( int i = first; i < last; i++ ) {
+		idRenderEntityLocal *def = deferred[i].def;
+		deferred[i].model->FinishDynamicModel( &def->parms, deferred[i].viewDef, def->cachedDynamicModel );
+	}
+}
+
+/*
+===================
+R_InstantiateDynamicModels
+
+r_parallelDynamicModels: creates the snapshots of all dynamic models
+R_AddModelSurfaces is going to draw. Callbacks and allocations are done
+serially, the skinning and particle generation run on the job workers.
+The entity scissor rectangles are set up here and left to R_AddModelSurfaces.
+===================
+*/
+static void R_InstantiateDynamicModels( void ) {
+	viewEntity_t	*vEntity;
+	int				numViewEntities = 0;
+	int				numDeferred = 0;
+
+	for ( vEntity = tr.viewDef->viewEntitys; vEntity; vEntity = vEntity->next ) {
+		numViewEntities++;
+	}
+	if ( numViewEntities == 0 ) {
+		return;
+	}
+
+	deferredModel_t *deferred = (deferredModel_t *)R_FrameAlloc( numViewEntities * sizeof( deferred[0] ) );
+
+	for ( vEntity = tr.viewDef->viewEntitys; vEntity; vEntity = vEntity->next ) {
+		idRenderEntityLocal *def = vEntity->entityDef;
+
+		if ( r_useEntityScissors.GetBool() ) {
+			vEntity->scissorRect.Intersect( R_CalcEntityScissorRectangle( vEntity ) );
+		}
+
+		// the same tests as R_AddModelSurfaces, entities that only cast shadows
+		// are still instantiated by their interactions
+		if ( tr.viewDef->isXraySubview && def->parms.xrayIndex == 1 ) {
+			continue;
+		} else if ( !tr.viewDef->isXraySubview && def->parms.xrayIndex == 2 ) {
+			continue;
+		}
+
+		if ( vEntity->scissorRect.IsEmpty() ) {
+			continue;
+		}
+
+		float oldFloatTime = 0.0f;
+		int oldTime = 0;
+
+		game->SelectTimeGroup( def->parms.timeGroup );
+
+		if ( def->parms.timeGroup ) {
+			oldFloatTime = tr.viewDef->floatTime;
+			oldTime = tr.viewDef->renderView.time;
+
+			tr.viewDef->floatTime = game->GetTimeGroupTime( def->parms.timeGroup ) * 0.001;
+			tr.viewDef->renderView.time = game->GetTimeGroupTime( def->parms.timeGroup );
+		}
+
+		idRenderModel *model = R_EntityDefUpdateModel( def );
+
+		if ( model->IsDynamicModel() != DM_STATIC && !def->dynamicModel ) {
+			idRenderModelStatic *staticModel = dynamic_cast<idRenderModelStatic *>( model );
+
+			if ( staticModel == NULL ) {
+				def->cachedDynamicModel = model->InstantiateDynamicModel( &def->parms, tr.viewDef, def->cachedDynamicModel );
+				R_EntityDefSetDynamicModel( def );
+			} else {
+				const viewDef_t *viewDef = tr.viewDef;
+
+				// the workers need to see the time of the entity's time group
+				if ( def->parms.timeGroup ) {
+					viewDef_t *groupViewDef = (viewDef_t *)R_FrameAlloc( sizeof( *groupViewDef ) );
+					*groupViewDef = *tr.viewDef;
+					viewDef = groupViewDef;
+				}
+
+				def->cachedDynamicModel = staticModel->PrepareDynamicModel( &def->parms, viewDef, def->cachedDynamicModel );
+
+				deferred[numDeferred].def = def;
+				deferred[numDeferred].model = staticModel;
+				deferred[numDeferred].viewDef = viewDef;
+				numDeferred++;
+			}
+		}
+
+		if ( def->parms.timeGroup ) {
+			tr.viewDef->floatTime = oldFloatTime;
+			tr.viewDef->renderView.time = oldTime;
+		}
+	}
+
+	jobSystem->ParallelFor( numDeferred, 1, R_FinishDynamicModels, deferred );
+	R_MergeJobCounters();
+
+	// overlays copy the skinned vertexes
+	for ( int i = 0; i < numDeferred; i++ ) {
+		R_EntityDefSetDynamicModel( deferred[i].def );
+	}
+}
+
 /*
 ===================
 R_AddModelSurfaces
@@ -1350,20 +1510,28 @@ void R_AddModelSurfaces( void ) {
 	viewEntity_t		*vEntity;
 	idInteraction		*inter, *next;
 	idRenderModel		*model;
+	bool				scissorsDone = false;
 
 	// clear the ambient surface list
 	tr.viewDef->numDrawSurfs = 0;
 	tr.viewDef->maxDrawSurfs = 0;	// will be set to INITIAL_DRAWSURFS on R_AddDrawSurf
 
+	if ( r_parallelDynamicModels.GetBool() && jobSystem->GetNumWorkers() > 0 ) {
+		R_InstantiateDynamicModels();
+		scissorsDone = true;
+	}
+
 	// go through each entity that is either visible to the view, or to
 	// any light that intersects the view (for shadows)
 	for ( vEntity = tr.viewDef->viewEntitys; vEntity; vEntity = vEntity->next ) {
 
 		if ( r_useEntityScissors.GetBool() ) {
-			// calculate the screen area covered by the entity
-			idScreenRect scissorRect = R_CalcEntityScissorRectangle( vEntity );
-			// intersect with the portal crossing scissor rectangle
-			vEntity->scissorRect.Intersect( scissorRect );
+			if ( !scissorsDone ) {
+				// calculate the screen area covered by the entity
+				idScreenRect scissorRect = R_CalcEntityScissorRectangle( vEntity );
+				// intersect with the portal crossing scissor rectangle
+				vEntity->scissorRect.Intersect( scissorRect );
+			}
 
 			if ( r_showEntityScissors.GetBool() ) {
 				R_ShowColoredScreenRect( vEntity->scissorRect, vEntity->entityDef->index );
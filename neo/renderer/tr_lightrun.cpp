@@ -344,14 +344,13 @@ void R_FreeLightDefFrustum( idRenderLightLocal *ldef ) {
 
 /*
 =================
-R_DeriveLightData
+R_DeriveLightShader
 
-Fills everything in based on light->parms
+Picks the light shader and falloff image, which can change without
+invalidating the rest of the derived light data
 =================
 */
-void R_DeriveLightData( idRenderLightLocal *light ) {
-	int i;
-
+void R_DeriveLightShader( idRenderLightLocal *light ) {
 	// decide which light shader we are going to use
 	if ( light->parms.shader ) {
 		light->lightShader = light->parms.shader;
@@ -379,6 +378,19 @@ void R_DeriveLightData( idRenderLightLocal *light ) {
 			light->falloffImage = defaultShader->LightFalloffImage();
 		}
 	}
+}
+
+/*
+=================
+R_DeriveLightData
+
+Fills everything in based on light->parms
+=================
+*/
+void R_DeriveLightData( idRenderLightLocal *light ) {
+	int i;
+
+	R_DeriveLightShader( light );
 
 	// set the projection
 	if ( !light->parms.pointLight ) {
@@ -37,7 +37,7 @@ class idRenderWorldLocal;
 // everything that is needed by the backend needs
 // to be double buffered to allow it to run in
 // parallel on a dual cpu machine
-const int SMP_FRAMES = 1;
+const int SMP_FRAMES = 2;
 
 const int FALLOFF_TEXTURE_SIZE =	64;
 
@@ -499,6 +499,11 @@ typedef struct {
 	viewDef_t	*viewDef;
 } drawSurfsCommand_t;
 
+typedef struct {
+	renderCommand_t		commandId, *next;
+	int		frameTempNum;				// vertex cache frame temp section used by the frame
+} swapBuffersCommand_t;
+
 typedef struct {
 	renderCommand_t		commandId, *next;
 	int		x, y, imageWidth, imageHeight;
@@ -525,18 +530,35 @@ typedef struct frameMemoryBlock_s {
 	byte	base[4];	// dynamically allocated as [size]
 } frameMemoryBlock_t;
 
-// all of the information needed by the back end must be
-// contained in a frameData_t.  This entire structure is
-// duplicated so the front and back end can run in parallel
-// on an SMP machine (OBSOLETE: this capability has been removed)
+// every thread that can run front end work allocates frame memory from
+// its own arena, so R_FrameAlloc never has to lock.
+// 0 is the main thread, the others are the job workers
+const int MAX_FRAME_ARENAS = MAX_JOB_WORKERS + 1;
+
+const int CACHE_LINE_SIZE = 64;
+
 typedef struct {
-	// one or more blocks of memory for all frame
-	// temporary allocations
+	// one or more blocks of memory, the first one is grown to the
+	// highwater mark when the arena is reset, so usually there is only one
 	frameMemoryBlock_t	*memory;
 
 	// alloc will point somewhere into the memory chain
 	frameMemoryBlock_t	*alloc;
 
+	int					highwater;			// max used on any frame
+	int					newBlocks;			// blocks allocated during the frame
+
+	int					pad[ ( CACHE_LINE_SIZE - 2 * sizeof( void * ) - 2 * sizeof( int ) ) / sizeof( int ) ];	// arenas are written by different threads
+} frameArena_t;
+
+// all of the information needed by the back end must be
+// contained in a frameData_t.  This entire structure is
+// duplicated so the front and back end can run in parallel
+// on an SMP machine (r_smp)
+typedef struct {
+	// all frame temporary allocations
+	frameArena_t		arenas[MAX_FRAME_ARENAS];
+
 	srfTriangles_t *	firstDeferredFreeTriSurf;
 	srfTriangles_t *	lastDeferredFreeTriSurf;
 
@@ -555,6 +577,9 @@ extern	frameData_t	*frameData;
 void R_ClearCommandChain( void );
 void R_AddDrawViewCmd( viewDef_t *parms );
 
+void R_SyncRenderThread( void );		// waits until the render thread has finished all issued commands
+void R_ShutdownRenderThread( void );
+
 void R_ReloadGuis_f( const idCmdArgs &args );
 void R_ListGuis_f( const idCmdArgs &args );
 
@@ -577,6 +602,9 @@ typedef struct {
 	int		c_sphere_cull_in, c_sphere_cull_clip, c_sphere_cull_out;
 	int		c_box_cull_in, c_box_cull_out;
 	int		c_createInteractions;	// number of calls to idInteraction::CreateInteraction
+	int		c_interactionCacheHits;	// idInteraction::AddActiveInteraction() with surfaces already built
+	int		c_interactionCacheSurfaces;	// surfaces of those that didn't need new light or shadow tris
+	int		c_entityUpdatesKept, c_lightUpdatesKept;	// updates that kept the derived data and interactions
 	int		c_createLightTris;
 	int		c_createShadowVolumes;
 	int		c_generateMd5;
@@ -671,6 +699,8 @@ typedef struct {
 	
 	bool scopeView;
 	bool shuttleView;
+
+	bool				finishCommands;		// glFinish after the command list, so the front end can read back the results
 } backEndState_t;
 
 
@@ -845,6 +875,7 @@ extern idCVar r_ignore2;				// used for random debugging without defining new va
 extern idCVar r_znear;					// near Z clip plane
 
 extern idCVar r_finish;					// force a call to glFinish() every frame
+extern idCVar r_smp;					// run the back end in a separate thread
 extern idCVar r_frontBuffer;			// draw to front buffer for debugging
 extern idCVar r_swapInterval;			// changes the GL swap interval
 extern idCVar r_offsetFactor;			// polygon offset parameter
@@ -866,6 +897,7 @@ extern idCVar r_useLightPortalFlow;		// 1 = do a more precise area reference det
 extern idCVar r_useShadowSurfaceScissor;// 1 = scissor shadows by the scissor rect of the interaction surfaces
 extern idCVar r_useConstantMaterials;	// 1 = use pre-calculated material registers if possible
 extern idCVar r_useInteractionTable;	// create a full entityDefs * lightDefs table to make finding interactions faster
+extern idCVar r_useInteractionCache;	// keep interactions over entity and light updates that don't change geometry or shadows
 extern idCVar r_useNodeCommonChildren;	// stop pushing reference bounds early when possible
 extern idCVar r_useSilRemap;			// 1 = consider verts with the same XYZ, but different ST the same for shadows
 extern idCVar r_useCulling;				// 0 = none, 1 = sphere, 2 = sphere + box
@@ -883,9 +915,12 @@ extern idCVar r_useTurboShadow;			// 1 = use the infinite projection with W tech
 extern idCVar r_useExternalShadows;		// 1 = skip drawing caps when outside the light volume
 extern idCVar r_useOptimizedShadows;	// 1 = use the dmap generated static shadow volumes
 extern idCVar r_useShadowVertexProgram;	// 1 = do the shadow projection in the vertex program on capable cards
+extern idCVar r_useSIMDShadowVolumes;	// 1 = batch the point, triangle and silhouette edge culling of shadow volumes
 extern idCVar r_useShadowProjectedCull;	// 1 = discard triangles outside light volume before shadowing
 extern idCVar r_useDeferredTangents;	// 1 = don't always calc tangents after deform
 extern idCVar r_useCachedDynamicModels;	// 1 = cache snapshots of dynamic models
+extern idCVar r_parallelDynamicModels;	// 1 = instantiate dynamic models of a view on the job workers
+extern idCVar r_parallelPortalFlood;		// 1 = clip the portals of a view flood level on the job workers
 extern idCVar r_useTwoSidedStencil;		// 1 = do stencil shadows in one pass with different ops on each side
 extern idCVar r_useInfiniteFarZ;		// 1 = use the no-far-clip-plane trick
 extern idCVar r_useScissor;				// 1 = scissor clip as portals and lights are processed
@@ -903,6 +938,7 @@ extern idCVar r_skipSuppress;			// ignore the per-view suppressions
 extern idCVar r_skipInteractions;		// skip all light/surface interaction drawing
 extern idCVar r_skipFrontEnd;			// bypasses all front end work, but 2D gui rendering still draws
 extern idCVar r_skipBackEnd;			// don't draw anything
+extern idCVar r_nullBackend;			// no GL context, the back end only counts what it would draw
 extern idCVar r_skipCopyTexture;		// do all rendering, but don't actually copyTexSubImage2D
 extern idCVar r_skipRender;				// skip 3D rendering, but pass 2D
 extern idCVar r_skipRenderContext;		// NULL the rendering context during backend 3D rendering
@@ -960,8 +996,10 @@ extern idCVar r_showEntityScissors;		// show entity scissor rectangles
 extern idCVar r_showInteractionFrustums;// show a frustum for each interaction
 extern idCVar r_showInteractionScissors;// show screen rectangle which contains the interaction frustum
 extern idCVar r_showMemory;				// print frame memory utilization
+extern idCVar r_showFrameMemory;			// print frame memory use and highwater of every arena
 extern idCVar r_showCull;				// report sphere and box culling stats
 extern idCVar r_showInteractions;		// report interaction generation activity
+extern idCVar r_showInteractionCache;	// report interaction cache hits and misses
 extern idCVar r_showSurfaces;			// report surface/light/shadow counts
 extern idCVar r_showPrimitives;			// report vertex/index/draw counts
 extern idCVar r_showPortals;			// draw portal outlines in color based on passed / not passed
@@ -1116,7 +1154,21 @@ void		GLimp_SetGamma( unsigned short red[256],
 void		GLimp_ResetGamma();
 // resets the gamma to what it was at startup
 
-// Returns false if the system only has a single processor
+bool		GLimp_SpawnRenderThread( void (*function)( void ) );
+// Creates a second OpenGL context that shares all objects with the
+// main one and runs function in a new thread with that context current.
+// Returns false if the system can't run the back end in another thread.
+
+void		GLimp_ShutdownRenderThread( void );
+// Wakes the render thread with NULL data, waits for it to exit and
+// destroys its context.
+
+void *		GLimp_BackEndSleep( void );
+void		GLimp_FrontEndSleep( void );
+void		GLimp_WakeBackEnd( void *data );
+// GLimp_WakeBackEnd hands data to the render thread, which is sleeping in
+// GLimp_BackEndSleep.  GLimp_FrontEndSleep waits until the render thread
+// has finished with the data and called GLimp_BackEndSleep again.
 
 void		GLimp_ActivateContext( void );
 void		GLimp_DeactivateContext( void );
@@ -1233,6 +1285,7 @@ void R_ReCreateWorldReferences( void );
 void R_CreateEntityRefs( idRenderEntityLocal *def );
 void R_CreateLightRefs( idRenderLightLocal *light );
 
+void R_DeriveLightShader( idRenderLightLocal *light );
 void R_DeriveLightData( idRenderLightLocal *light );
 void R_FreeLightDefDerivedData( idRenderLightLocal *light );
 void R_CheckForEntityDefsUsingModel( idRenderModel *model );
@@ -1565,11 +1618,17 @@ SCENE GENERATION
 void R_InitFrameData( void );
 void R_ShutdownFrameData( void );
 int R_CountFrameData( void );
+void R_PrintFrameData( void );
 void R_ToggleSmpFrame( void );
 void *R_FrameAlloc( int bytes );
 void *R_ClearedFrameAlloc( int bytes );
 void R_FrameFree( void *data );
 
+// front end jobs count into performance counters of their own thread,
+// R_MergeJobCounters adds them to tr.pc after the jobs are done
+performanceCounters_t *R_ThreadCounters( void );
+void R_MergeJobCounters( void );
+
 void *R_StaticAlloc( int bytes );		// just malloc with error checking
 void *R_ClearedStaticAlloc( int bytes );	// with memset
 void R_StaticFree( void *data );
@@ -1614,6 +1673,12 @@ void RB_SetGL2D( void );
 void RB_ShowImages( void );
 
 void RB_ExecuteBackEndCommands( const emptyCommand_t *cmds );
+void RB_RenderThread( void );
+
+// draw_null.cpp
+GLExtension_t RB_NullGetProcAddress( const char *name );
+void RB_NullExecuteBackEndCommands( const emptyCommand_t *cmds );
+void R_NullBackEndStats_f( const idCmdArgs &args );
 
 
 /*
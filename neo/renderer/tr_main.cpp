@@ -177,29 +177,105 @@ void R_ShowColoredScreenRect( const idScreenRect &rect, int colorIndex ) {
 	}
 }
 
+// the front end fills one of these while the back end may still be drawing from the other
+static frameData_t	*smpFrameData[SMP_FRAMES];
+static void			*smpFrameDataAlloc[SMP_FRAMES];	// smpFrameData is cache line aligned in here
+static int			smpFrame;
+
+#define	MEMORY_BLOCK_SIZE	0x100000
+
+/*
+====================
+R_AllocFrameMemoryBlock
+====================
+*/
+static frameMemoryBlock_t *R_AllocFrameMemoryBlock( int size ) {
+	frameMemoryBlock_t *block;
+
+	block = (frameMemoryBlock_t *)Mem_Alloc( size + sizeof( *block ) );
+	if ( !block ) {
+		common->FatalError( "R_AllocFrameMemoryBlock: Mem_Alloc() failed" );
+	}
+	block->size = size;
+	block->used = 0;
+	block->next = NULL;
+	return block;
+}
+
+/*
+====================
+R_ArenaUsed
+
+bytes handed out by the arena this frame
+====================
+*/
+static int R_ArenaUsed( const frameArena_t *arena ) {
+	const frameMemoryBlock_t *block;
+	int count;
+
+	count = 0;
+	for ( block = arena->memory ; block ; block = block->next ) {
+		count += block->used;
+		if ( block == arena->alloc ) {
+			break;
+		}
+	}
+	return count;
+}
+
+/*
+====================
+R_ResetFrameArena
+
+Only the first block is reset, the following blocks are reset when
+R_FrameAlloc advances to them.  If the arena had to chain blocks, they are
+replaced by a single block big enough for the highwater mark, so the
+arena stops allocating memory during frames after a few frames.
+====================
+*/
+static void R_ResetFrameArena( frameArena_t *arena ) {
+	if ( !arena->memory ) {
+		return;
+	}
+
+	if ( arena->memory->next ) {
+		frameMemoryBlock_t *block, *nextBlock;
+		for ( block = arena->memory ; block ; block = nextBlock ) {
+			nextBlock = block->next;
+			Mem_Free( block );
+		}
+		arena->memory = R_AllocFrameMemoryBlock( ( arena->highwater + MEMORY_BLOCK_SIZE - 1 ) & ~( MEMORY_BLOCK_SIZE - 1 ) );
+	}
+
+	arena->memory->used = 0;
+	arena->alloc = arena->memory;
+	arena->newBlocks = 0;
+}
+
 /*
 ====================
 R_ToggleSmpFrame
+
+Switches the front end to the other frameData.  The back end may still be
+drawing from the current one when running with r_smp, so the frame that is
+reset here is the one from two frames ago.
 ====================
 */
 void R_ToggleSmpFrame( void ) {
-	R_FreeDeferredTriSurfs( frameData );
-
 	// clear frame-temporary data
 	frameData_t		*frame;
-	frameMemoryBlock_t	*block;
 
 	// update the highwater mark
 	R_CountFrameData();
 
-	frame = frameData;
+	smpFrame++;
+	frame = frameData = smpFrameData[smpFrame % SMP_FRAMES];
 
-	// reset the memory allocation to the first block
-	frame->alloc = frame->memory;
+	R_FreeDeferredTriSurfs( frame );
 
-	// clear all the blocks
-	for ( block = frame->memory ; block ; block = block->next ) {
-		block->used = 0;
+	// reset the memory allocation to the first block of every arena
+	for ( int i = 0 ; i < MAX_FRAME_ARENAS ; i++ ) {
+		R_ResetFrameArena( &frame->arenas[i] );
 	}
 
 	R_ClearCommandChain();
@@ -208,8 +284,6 @@ void R_ToggleSmpFrame( void ) {
 
 //=====================================================
 
-#define	MEMORY_BLOCK_SIZE	0x100000
-
 /*
 =====================
 R_ShutdownFrameData
@@ -219,47 +293,54 @@ void R_ShutdownFrameData( void ) {
 	frameData_t *frame;
 	frameMemoryBlock_t *block;
 
-	// free any current data
-	frame = frameData;
-	if ( !frame ) {
-		return;
-	}
+	R_ShutdownRenderThread();
 
-	R_FreeDeferredTriSurfs( frame );
+	for ( int i = 0 ; i < SMP_FRAMES ; i++ ) {
+		// free any current data
+		frame = smpFrameData[i];
+		if ( !frame ) {
+			continue;
+		}
+
+		R_FreeDeferredTriSurfs( frame );
 
-	frameMemoryBlock_t *nextBlock;
-	for ( block = frame->memory ; block ; block = nextBlock ) {
-		nextBlock = block->next;
-		Mem_Free( block );
+		for ( int j = 0 ; j < MAX_FRAME_ARENAS ; j++ ) {
+			frameMemoryBlock_t *nextBlock;
+			for ( block = frame->arenas[j].memory ; block ; block = nextBlock ) {
+				nextBlock = block->next;
+				Mem_Free( block );
+			}
+		}
+		Mem_Free( smpFrameDataAlloc[i] );
+		smpFrameDataAlloc[i] = NULL;
+		smpFrameData[i] = NULL;
 	}
-	Mem_Free( frame );
 	frameData = NULL;
 }
 
 /*
 =====================
 R_InitFrameData
+
+The arenas of the job workers get their first block when they first allocate
 =====================
 */
 void R_InitFrameData( void ) {
-	int size;
 	frameData_t *frame;
-	frameMemoryBlock_t *block;
 
 	R_ShutdownFrameData();
 
-	frameData = (frameData_t *)Mem_ClearedAlloc( sizeof( *frameData ));
-	frame = frameData;
-	size = MEMORY_BLOCK_SIZE;
-	block = (frameMemoryBlock_t *)Mem_Alloc( size + sizeof( *block ) );
-	if ( !block ) {
-		common->FatalError( "R_InitFrameData: Mem_Alloc() failed" );
+	for ( int i = 0 ; i < SMP_FRAMES ; i++ ) {
+		smpFrameDataAlloc[i] = Mem_ClearedAlloc( sizeof( *smpFrameData[i] ) + CACHE_LINE_SIZE - 1 );
+		smpFrameData[i] = (frameData_t *)( ( (intptr_t)smpFrameDataAlloc[i] + CACHE_LINE_SIZE - 1 ) & ~( CACHE_LINE_SIZE - 1 ) );
+		frame = smpFrameData[i];
+		frame->arenas[0].memory = R_AllocFrameMemoryBlock( MEMORY_BLOCK_SIZE );
+		frame->arenas[0].alloc = frame->arenas[0].memory;
+		frame->memoryHighwater = 0;
 	}
-	block->size = size;
-	block->used = 0;
-	block->next = NULL;
-	frame->memory = block;
-	frame->memoryHighwater = 0;
+
+	smpFrame = 0;
+	frameData = smpFrameData[0];
 
 	R_ToggleSmpFrame();
 }
@@ -271,16 +352,18 @@ R_CountFrameData
 */
 int R_CountFrameData( void ) {
 	frameData_t		*frame;
-	frameMemoryBlock_t	*block;
 	int				count;
 
 	count = 0;
 	frame = frameData;
-	for ( block = frame->memory ; block ; block=block->next ) {
-		count += block->used;
-		if ( block == frame->alloc ) {
-			break;
+	for ( int i = 0 ; i < MAX_FRAME_ARENAS ; i++ ) {
+		frameArena_t *arena = &frame->arenas[i];
+		int used = R_ArenaUsed( arena );
+
+		if ( used > arena->highwater ) {
+			arena->highwater = used;
 		}
+		count += used;
 	}
 
 	// note if this is a new highwater mark
@@ -291,6 +374,71 @@ int R_CountFrameData( void ) {
 	return count;
 }
 
+/*
+================
+R_PrintFrameData
+
+r_showFrameMemory
+================
+*/
+void R_PrintFrameData( void ) {
+	frameData_t		*frame;
+	int				total, newBlocks;
+
+	frame = frameData;
+	if ( !frame ) {
+		return;
+	}
+
+	total = R_CountFrameData();
+	newBlocks = 0;
+	common->Printf( "frameMemory: %ik (%ik)", total / 1024, frame->memoryHighwater / 1024 );
+	for ( int i = 0 ; i < MAX_FRAME_ARENAS ; i++ ) {
+		const frameArena_t *arena = &frame->arenas[i];
+		if ( !arena->memory ) {
+			continue;
+		}
+		common->Printf( " %i:%ik(%ik)", i, R_ArenaUsed( arena ) / 1024, arena->highwater / 1024 );
+		newBlocks += arena->newBlocks;
+	}
+	common->Printf( " newBlocks:%i\n", newBlocks );
+}
+
+/*
+=================
+R_ThreadCounters
+=================
+*/
+static performanceCounters_t	jobCounters[MAX_FRAME_ARENAS];
+
+performanceCounters_t *R_ThreadCounters( void ) {
+	int index = jobSystem->GetThreadIndex();
+
+	if ( index == 0 ) {
+		return &tr.pc;
+	}
+	return &jobCounters[index];
+}
+
+/*
+=================
+R_MergeJobCounters
+
+The counters are all ints
+=================
+*/
+void R_MergeJobCounters( void ) {
+	int *total = (int *)&tr.pc;
+
+	for ( int i = 1 ; i < MAX_FRAME_ARENAS ; i++ ) {
+		const int *counters = (const int *)&jobCounters[i];
+		for ( int j = 0 ; j < (int)( sizeof( performanceCounters_t ) / sizeof( int ) ) ; j++ ) {
+			total[j] += counters[j];
+		}
+	}
+	memset( &jobCounters[1], 0, ( MAX_FRAME_ARENAS - 1 ) * sizeof( jobCounters[0] ) );
+}
+
 /*
 =================
 R_StaticAlloc
@@ -344,6 +492,8 @@ current frame's back end completes.
 
 This should only be called by the front end.  The
 back end shouldn't need to allocate memory.
+The main thread and every job worker have their own
+arena, so front end jobs can allocate without locking.
 
 If we passed smpFrame in, the back end could
 alloc memory, because it will always be a
@@ -361,46 +511,38 @@ Should part of this be inlined in a macro?
 ================
 */
 void *R_FrameAlloc( int bytes ) {
-	frameData_t		*frame;
+	frameArena_t		*arena;
 	frameMemoryBlock_t	*block;
 	void			*buf;
 
 	bytes = (bytes+16)&~15;
 	// see if it can be satisfied in the current block
-	frame = frameData;
-	block = frame->alloc;
+	arena = &frameData->arenas[ jobSystem->GetThreadIndex() ];
+	block = arena->alloc;
 
-	if ( block->size - block->used >= bytes ) {
+	if ( block && block->size - block->used >= bytes ) {
 		buf = block->base + block->used;
 		block->used += bytes;
 		return buf;
 	}
 
-	// advance to the next memory block if available
-	block = block->next;
-	// create a new block if we are at the end of
-	// the chain
-	if ( !block ) {
-		int		size;
-
-		size = MEMORY_BLOCK_SIZE;
-		block = (frameMemoryBlock_t *)Mem_Alloc( size + sizeof( *block ) );
-		if ( !block ) {
-			common->FatalError( "R_FrameAlloc: Mem_Alloc() failed" );
+	// advance to the next memory block if available and big enough,
+	// it still has the use count of an earlier frame
+	if ( block && block->next && block->next->size >= bytes ) {
+		block = block->next;
+	} else {
+		// create a new block, big allocations get a block of their own size
+		block = R_AllocFrameMemoryBlock( Max( bytes, (int)MEMORY_BLOCK_SIZE ) );
+		if ( !arena->alloc ) {
+			arena->memory = block;
+		} else {
+			block->next = arena->alloc->next;
+			arena->alloc->next = block;
 		}
-		block->size = size;
-		block->used = 0;
-		block->next = NULL;
-		frame->alloc->next = block;
-	}
-
-	// we could fix this if we needed to...
-	if ( bytes > block->size ) {
-		common->FatalError( "R_FrameAlloc of %i exceeded MEMORY_BLOCK_SIZE",
-			bytes );
+		arena->newBlocks++;
 	}
 
-	frame->alloc = block;
+	arena->alloc = block;
 
 	block->used = bytes;
 
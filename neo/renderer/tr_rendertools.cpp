@@ -297,8 +297,13 @@ static void R_ColorByStencilBuffer( void ) {
 /*
 ==================
 RB_ShowOverdraw
+
+The surface list is kept in memory of the back end, with r_smp the
+front end is allocating frame memory for the next frame at the same time
 ==================
 */
+static idList<drawSurf_t *> overdrawSurfs;
+
 void RB_ShowOverdraw( void ) {
 	const idMaterial *	material;
 	int					i;
@@ -329,7 +334,9 @@ void RB_ShowOverdraw( void ) {
 		}
 	}
 
-	drawSurf_t **newDrawSurfs = (drawSurf_t **)R_FrameAlloc( numDrawSurfs + interactions * sizeof( newDrawSurfs[0] ) );
+	overdrawSurfs.SetGranularity( 1024 );
+	overdrawSurfs.AssureSize( numDrawSurfs + interactions );
+	drawSurf_t **newDrawSurfs = overdrawSurfs.Ptr();
 
 	for ( i = 0; i < numDrawSurfs; i++ ) {
 		surf = drawSurfs[i];
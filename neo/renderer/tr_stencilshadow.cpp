@@ -631,6 +631,110 @@ static void R_AddClipSilEdges( void ) {
 	}
 }
 
+/*
+=================
+R_LowestBit
+
+Index of the lowest set bit, bits must not be 0
+=================
+*/
+static ID_INLINE int R_LowestBit( unsigned int bits ) {
+#if defined( __GNUC__ )
+	return __builtin_ctz( bits );
+#elif defined( _MSC_VER )
+	unsigned long index;
+	_BitScanForward( &index, bits );
+	return (int)index;
+#else
+	int i;
+	for ( i = 0; !( bits & 1 ); i++ ) {
+		bits >>= 1;
+	}
+	return i;
+#endif
+}
+
+/*
+=================
+R_AddSilEdge
+
+Adds the quad from the front points to the projected points of a
+single silhouette edge.
+Returns false if the shadow tables overflowed.
+=================
+*/
+static bool R_AddSilEdge( const srfTriangles_t *tri, const silEdge_t *sil, const unsigned short *pointCull, const idPlane frustum[6] ) {
+	int		v1, v2;
+
+	// see if the edge needs to be clipped
+	if ( EDGE_CLIPPED( sil->v1, sil->v2 ) ) {
+		if ( numShadowVerts + 4 > MAX_SHADOW_VERTS ) {
+			overflowed = true;
+			return false;
+		}
+		v1 = numShadowVerts;
+		v2 = v1 + 2;
+		if ( !R_ClipLineToLight( tri->verts[ sil->v1 ].xyz, tri->verts[ sil->v2 ].xyz,
+			frustum, shadowVerts[v1].ToVec3(), shadowVerts[v2].ToVec3() ) ) {
+			return true;	// clipped away
+		}
+
+		numShadowVerts += 4;
+	} else {
+		// use the entire edge
+		v1 = remap[ sil->v1 ];
+		v2 = remap[ sil->v2 ];
+		if ( v1 < 0 || v2 < 0 ) {
+			common->Error( "R_AddSilEdges: bad remap[]" );
+		}
+	}
+
+	// don't overflow
+	if ( numShadowIndexes + 6 > MAX_SHADOW_INDEXES ) {
+		overflowed = true;
+		return false;
+	}
+
+	// we need to choose the correct way of triangulating the silhouette quad
+	// consistantly between any two points, no matter which order they are specified.
+	// If this wasn't done, slight rasterization cracks would show in the shadow
+	// volume when two sil edges were exactly coincident
+	if ( faceCastsShadow[ sil->p2 ] ) {
+		if ( PointsOrdered( shadowVerts[ v1 ].ToVec3(), shadowVerts[ v2 ].ToVec3() ) ) {
+			shadowIndexes[numShadowIndexes++] = v1;
+			shadowIndexes[numShadowIndexes++] = v1+1;
+			shadowIndexes[numShadowIndexes++] = v2;
+			shadowIndexes[numShadowIndexes++] = v2;
+			shadowIndexes[numShadowIndexes++] = v1+1;
+			shadowIndexes[numShadowIndexes++] = v2+1;
+		} else {
+			shadowIndexes[numShadowIndexes++] = v1;
+			shadowIndexes[numShadowIndexes++] = v2+1;
+			shadowIndexes[numShadowIndexes++] = v2;
+			shadowIndexes[numShadowIndexes++] = v1;
+			shadowIndexes[numShadowIndexes++] = v1+1;
+			shadowIndexes[numShadowIndexes++] = v2+1;
+		}
+	} else {
+		if ( PointsOrdered( shadowVerts[ v1 ].ToVec3(), shadowVerts[ v2 ].ToVec3() ) ) {
+			shadowIndexes[numShadowIndexes++] = v1;
+			shadowIndexes[numShadowIndexes++] = v2;
+			shadowIndexes[numShadowIndexes++] = v1+1;
+			shadowIndexes[numShadowIndexes++] = v2;
+			shadowIndexes[numShadowIndexes++] = v2+1;
+			shadowIndexes[numShadowIndexes++] = v1+1;
+		} else {
+			shadowIndexes[numShadowIndexes++] = v1;
+			shadowIndexes[numShadowIndexes++] = v2;
+			shadowIndexes[numShadowIndexes++] = v2+1;
+			shadowIndexes[numShadowIndexes++] = v1;
+			shadowIndexes[numShadowIndexes++] = v2+1;
+			shadowIndexes[numShadowIndexes++] = v1+1;
+		}
+	}
+	return true;
+}
+
 /*
 =================
 R_AddSilEdges
@@ -640,13 +744,40 @@ for each silhouette edge in the light
 =================
 */
 static void R_AddSilEdges( const srfTriangles_t *tri, unsigned short *pointCull, const idPlane frustum[6] ) {
-	int		v1, v2;
 	int		i;
 	silEdge_t	*sil;
 	int		numPlanes;
 
 	numPlanes = tri->numIndexes / 3;
 
+	if ( r_useSIMDShadowVolumes.GetBool() ) {
+		// build a mask of the potential silhouette edges 32 at a time without
+		// branching, then only visit the edges that have their bit set
+		for ( int first = 0 ; first < tri->numSilEdges ; first += 32 ) {
+			const int count = Min( 32, tri->numSilEdges - first );
+			unsigned int bits = 0;
+
+			sil = tri->silEdges + first;
+			for ( i = 0 ; i < count ; i++ ) {
+				if ( sil[i].p1 < 0 || sil[i].p1 > numPlanes || sil[i].p2 < 0 || sil[i].p2 > numPlanes ) {
+					common->Error( "Bad sil planes" );
+				}
+				const unsigned int sil1 = faceCastsShadow[ sil[i].p1 ] ^ faceCastsShadow[ sil[i].p2 ];
+				const unsigned int culled = EDGE_CULLED( sil[i].v1, sil[i].v2 );
+				bits |= ( sil1 & ( culled == 0 ) ) << i;
+			}
+
+			while ( bits ) {
+				i = R_LowestBit( bits );
+				bits &= bits - 1;
+				if ( !R_AddSilEdge( tri, sil + i, pointCull, frustum ) ) {
+					return;
+				}
+			}
+		}
+		return;
+	}
+
 	// add sil edges for any true silhouette boundaries on the surface
 	for ( i = 0 ; i < tri->numSilEdges ; i++ ) {
 		sil = tri->silEdges + i;
@@ -672,72 +803,9 @@ static void R_AddSilEdges( const srfTriangles_t *tri, unsigned short *pointCull,
 			continue;
 		}
 
-		// see if the edge needs to be clipped
-		if ( EDGE_CLIPPED( sil->v1, sil->v2 ) ) {
-			if ( numShadowVerts + 4 > MAX_SHADOW_VERTS ) {
-				overflowed = true;
-				return;
-			}
-			v1 = numShadowVerts;
-			v2 = v1 + 2;
-			if ( !R_ClipLineToLight( tri->verts[ sil->v1 ].xyz, tri->verts[ sil->v2 ].xyz,
-				frustum, shadowVerts[v1].ToVec3(), shadowVerts[v2].ToVec3() ) ) {
-				continue;	// clipped away
-			}
-
-			numShadowVerts += 4;
-		} else {
-			// use the entire edge
-			v1 = remap[ sil->v1 ];
-			v2 = remap[ sil->v2 ];
-			if ( v1 < 0 || v2 < 0 ) {
-				common->Error( "R_AddSilEdges: bad remap[]" );
-			}
-		}
-
-		// don't overflow
-		if ( numShadowIndexes + 6 > MAX_SHADOW_INDEXES ) {
-			overflowed = true;
+		if ( !R_AddSilEdge( tri, sil, pointCull, frustum ) ) {
 			return;
 		}
-
-		// we need to choose the correct way of triangulating the silhouette quad
-		// consistantly between any two points, no matter which order they are specified.
-		// If this wasn't done, slight rasterization cracks would show in the shadow
-		// volume when two sil edges were exactly coincident
-		if ( faceCastsShadow[ sil->p2 ] ) {
-			if ( PointsOrdered( shadowVerts[ v1 ].ToVec3(), shadowVerts[ v2 ].ToVec3() ) ) {
-				shadowIndexes[numShadowIndexes++] = v1;
-				shadowIndexes[numShadowIndexes++] = v1+1;
-				shadowIndexes[numShadowIndexes++] = v2;
-				shadowIndexes[numShadowIndexes++] = v2;
-				shadowIndexes[numShadowIndexes++] = v1+1;
-				shadowIndexes[numShadowIndexes++] = v2+1;
-			} else {
-				shadowIndexes[numShadowIndexes++] = v1;
-				shadowIndexes[numShadowIndexes++] = v2+1;
-				shadowIndexes[numShadowIndexes++] = v2;
-				shadowIndexes[numShadowIndexes++] = v1;
-				shadowIndexes[numShadowIndexes++] = v1+1;
-				shadowIndexes[numShadowIndexes++] = v2+1;
-			}
-		} else {
-			if ( PointsOrdered( shadowVerts[ v1 ].ToVec3(), shadowVerts[ v2 ].ToVec3() ) ) {
-				shadowIndexes[numShadowIndexes++] = v1;
-				shadowIndexes[numShadowIndexes++] = v2;
-				shadowIndexes[numShadowIndexes++] = v1+1;
-				shadowIndexes[numShadowIndexes++] = v2;
-				shadowIndexes[numShadowIndexes++] = v2+1;
-				shadowIndexes[numShadowIndexes++] = v1+1;
-			} else {
-				shadowIndexes[numShadowIndexes++] = v1;
-				shadowIndexes[numShadowIndexes++] = v2;
-				shadowIndexes[numShadowIndexes++] = v2+1;
-				shadowIndexes[numShadowIndexes++] = v1;
-				shadowIndexes[numShadowIndexes++] = v2+1;
-				shadowIndexes[numShadowIndexes++] = v1+1;
-			}
-		}
 	}
 }
 
@@ -763,6 +831,11 @@ static void R_CalcPointCull( const srfTriangles_t *tri, const idPlane frustum[6]
 		}
 	}
 
+	if ( r_useSIMDShadowVolumes.GetBool() ) {
+		SIMDProcessor->ShadowPointCull( pointCull, frustum, frontBits, LIGHT_CLIP_EPSILON, tri->verts, tri->numVerts );
+		return;
+	}
+
 	// initialize point cull
 	for ( i = 0; i < tri->numVerts; i++ ) {
 		pointCull[i] = frontBits;
@@ -794,6 +867,75 @@ static void R_CalcPointCull( const srfTriangles_t *tri, const idPlane frustum[6]
 	}
 }
 
+/*
+=================
+R_AddFrontCapTriangle
+
+Adds a triangle that is not culled by the frustum to the front cap,
+clipping it to the frustum if needed.
+Returns false if the shadow tables overflowed.
+=================
+*/
+static bool R_AddFrontCapTriangle( const srfTriangles_t *tri, const unsigned short *pointCull, const idPlane frustum[6], int i, bool clipped ) {
+	int		i1, i2, i3;
+	int		cullBits;
+
+	i1 = tri->silIndexes[ i*3 + 0 ];
+	i2 = tri->silIndexes[ i*3 + 1 ];
+	i3 = tri->silIndexes[ i*3 + 2 ];
+
+	// make sure the verts that are not on the negative sides
+	// of the frustum are copied over.
+	// we need to get the original verts even from clipped triangles
+	// so the edges reference correctly, because an edge may be unclipped
+	// even when a triangle is clipped.
+	if ( numShadowVerts + 6 > MAX_SHADOW_VERTS ) {
+		overflowed = true;
+		return false;
+	}
+
+	if ( !POINT_CULLED(i1) && remap[i1] == -1 ) {
+		remap[i1] = numShadowVerts;
+		shadowVerts[ numShadowVerts ].ToVec3() = tri->verts[i1].xyz;
+		numShadowVerts+=2;
+	}
+	if ( !POINT_CULLED(i2) && remap[i2] == -1 ) {
+		remap[i2] = numShadowVerts;
+		shadowVerts[ numShadowVerts ].ToVec3() = tri->verts[i2].xyz;
+		numShadowVerts+=2;
+	}
+	if ( !POINT_CULLED(i3) && remap[i3] == -1 ) {
+		remap[i3] = numShadowVerts;
+		shadowVerts[ numShadowVerts ].ToVec3() = tri->verts[i3].xyz;
+		numShadowVerts+=2;
+	}
+
+	// clip the triangle if any points are on the negative sides
+	if ( clipped ) {
+		cullBits = ( ( pointCull[ i1 ] ^ 0xfc0 ) | ( pointCull[ i2 ] ^ 0xfc0 ) | ( pointCull[ i3 ] ^ 0xfc0 ) ) >> 6;
+		// this will also define clip edges that will become
+		// silhouette planes
+		if ( R_ClipTriangleToLight( tri->verts[i1].xyz, tri->verts[i2].xyz,
+			tri->verts[i3].xyz, cullBits, frustum ) ) {
+			faceCastsShadow[i] = 1;
+		}
+	} else {
+		// instead of overflowing or drawing a streamer shadow, don't draw a shadow at all
+		if ( numShadowIndexes + 3 > MAX_SHADOW_INDEXES ) {
+			overflowed = true;
+			return false;
+		}
+		if ( remap[i1] == -1 || remap[i2] == -1 || remap[i3] == -1 ) {
+			common->Error( "R_CreateShadowVolumeInFrustum: bad remap[]" );
+		}
+		shadowIndexes[numShadowIndexes++] = remap[i3];
+		shadowIndexes[numShadowIndexes++] = remap[i2];
+		shadowIndexes[numShadowIndexes++] = remap[i1];
+		faceCastsShadow[i] = 1;
+	}
+	return true;
+}
+
 /*
 =================
 R_CreateShadowVolumeInFrustum
@@ -821,9 +963,10 @@ static void R_CreateShadowVolumeInFrustum( const idRenderEntityLocal *ent,
 	int		numCapIndexes;
 	int		firstShadowIndex;
 	int		firstShadowVert;
-	int		cullBits;
 
-	pointCull = (unsigned short *)_alloca16( tri->numVerts * sizeof( pointCull[0] ) );
+	// + 1 so the SIMD triangle cull can read the point cull bits as 32 bit words
+	pointCull = (unsigned short *)_alloca16( ( tri->numVerts + 1 ) * sizeof( pointCull[0] ) );
+	pointCull[tri->numVerts] = 0;
 
 	// test the vertexes for inside the light frustum, which will allow
 	// us to completely cull away some triangles from consideration.
@@ -836,75 +979,49 @@ static void R_CreateShadowVolumeInFrustum( const idRenderEntityLocal *ent,
 	// decide which triangles front shadow volumes, clipping as needed
 	numClipSilEdges = 0;
 	numTris = tri->numIndexes / 3;
-	for ( i = 0 ; i < numTris ; i++ ) {
-		int		i1, i2, i3;
-
-		faceCastsShadow[i] = 0;	// until shown otherwise
-
-		// if it isn't facing the right way, don't add it
-		// to the shadow volume
-		if ( globalFacing[i] ) {
-			continue;
-		}
-
-		i1 = tri->silIndexes[ i*3 + 0 ];
-		i2 = tri->silIndexes[ i*3 + 1 ];
-		i3 = tri->silIndexes[ i*3 + 2 ];
-
-		// if all the verts are off one side of the frustum,
-		// don't add any of them
-		if ( TRIANGLE_CULLED( i1, i2, i3 ) ) {
-			continue;
-		}
-
-		// make sure the verts that are not on the negative sides
-		// of the frustum are copied over.
-		// we need to get the original verts even from clipped triangles
-		// so the edges reference correctly, because an edge may be unclipped
-		// even when a triangle is clipped.
-		if ( numShadowVerts + 6 > MAX_SHADOW_VERTS ) {
-			overflowed = true;
-			return;
+	if ( r_useSIMDShadowVolumes.GetBool() ) {
+		unsigned int	*castBits, *clipBits;
+		int				numWords;
+
+		// classify the triangles 32 at a time, only the ones that cast
+		// a shadow are visited, in the same order as the scalar loop
+		numWords = ( numTris + 31 ) >> 5;
+		castBits = (unsigned int *)_alloca16( numWords * sizeof( castBits[0] ) );
+		clipBits = (unsigned int *)_alloca16( numWords * sizeof( clipBits[0] ) );
+		SIMDProcessor->ShadowTriangleCull( castBits, clipBits, globalFacing, pointCull, tri->silIndexes, numTris );
+		SIMDProcessor->Memset( faceCastsShadow, 0, numTris * sizeof( faceCastsShadow[0] ) );
+
+		for ( int w = 0 ; w < numWords ; w++ ) {
+			unsigned int bits = castBits[w];
+			while ( bits ) {
+				const int b = R_LowestBit( bits );
+				bits &= bits - 1;
+				i = ( w << 5 ) + b;
+				if ( !R_AddFrontCapTriangle( tri, pointCull, frustum, i, ( clipBits[w] & ( 1u << b ) ) != 0 ) ) {
+					return;
+				}
+			}
 		}
+	} else {
+		for ( i = 0 ; i < numTris ; i++ ) {
+			faceCastsShadow[i] = 0;	// until shown otherwise
 
-		if ( !POINT_CULLED(i1) && remap[i1] == -1 ) {
-			remap[i1] = numShadowVerts;
-			shadowVerts[ numShadowVerts ].ToVec3() = tri->verts[i1].xyz;
-			numShadowVerts+=2;
-		}
-		if ( !POINT_CULLED(i2) && remap[i2] == -1 ) {
-			remap[i2] = numShadowVerts;
-			shadowVerts[ numShadowVerts ].ToVec3() = tri->verts[i2].xyz;
-			numShadowVerts+=2;
-		}
-		if ( !POINT_CULLED(i3) && remap[i3] == -1 ) {
-			remap[i3] = numShadowVerts;
-			shadowVerts[ numShadowVerts ].ToVec3() = tri->verts[i3].xyz;
-			numShadowVerts+=2;
-		}
+			// if it isn't facing the right way, don't add it
+			// to the shadow volume
+			if ( globalFacing[i] ) {
+				continue;
+			}
 
-		// clip the triangle if any points are on the negative sides
-		if ( TRIANGLE_CLIPPED( i1, i2, i3 ) ) {
-			cullBits = ( ( pointCull[ i1 ] ^ 0xfc0 ) | ( pointCull[ i2 ] ^ 0xfc0 ) | ( pointCull[ i3 ] ^ 0xfc0 ) ) >> 6;
-			// this will also define clip edges that will become
-			// silhouette planes
-			if ( R_ClipTriangleToLight( tri->verts[i1].xyz, tri->verts[i2].xyz,
-				tri->verts[i3].xyz, cullBits, frustum ) ) {
-				faceCastsShadow[i] = 1;
+			// if all the verts are off one side of the frustum,
+			// don't add any of them
+			if ( TRIANGLE_CULLED( tri->silIndexes[ i*3 + 0 ], tri->silIndexes[ i*3 + 1 ], tri->silIndexes[ i*3 + 2 ] ) ) {
+				continue;
 			}
-		} else {
-			// instead of overflowing or drawing a streamer shadow, don't draw a shadow at all
-			if ( numShadowIndexes + 3 > MAX_SHADOW_INDEXES ) {
-				overflowed = true;
+
+			if ( !R_AddFrontCapTriangle( tri, pointCull, frustum, i,
+					TRIANGLE_CLIPPED( tri->silIndexes[ i*3 + 0 ], tri->silIndexes[ i*3 + 1 ], tri->silIndexes[ i*3 + 2 ] ) ) ) {
 				return;
 			}
-			if ( remap[i1] == -1 || remap[i2] == -1 || remap[i3] == -1 ) {
-				common->Error( "R_CreateShadowVolumeInFrustum: bad remap[]" );
-			}
-			shadowIndexes[numShadowIndexes++] = remap[i3];
-			shadowIndexes[numShadowIndexes++] = remap[i2];
-			shadowIndexes[numShadowIndexes++] = remap[i1];
-			faceCastsShadow[i] = 1;
 		}
 	}
 
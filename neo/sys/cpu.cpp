@@ -195,6 +195,107 @@ void Sys_FPU_SetFTZ(bool enable) {
 }
 #endif
 
+#if ( defined(__GNUC__) && ( defined(__i386__) || defined(__x86_64__) ) ) || ( defined(_MSC_VER) && ( defined(_M_IX86) || defined(_M_X64) ) && !defined(_M_ARM64EC) )
+
+#if defined(__GNUC__)
+#include <cpuid.h>
+
+static inline void CPUidEx(int index, int subIndex, int *a, int *b, int *c, int *d) {
+	unsigned int ra = 0, rb = 0, rc = 0, rd = 0;
+
+	__cpuid_count(index, subIndex, ra, rb, rc, rd);
+
+	*a = ra;
+	*b = rb;
+	*c = rc;
+	*d = rd;
+}
+
+static inline unsigned int GetXCR0() {
+	unsigned int lo, hi;
+
+	// xgetbv, spelled out for assemblers that don't know the mnemonic
+	__asm__ volatile (".byte 0x0f, 0x01, 0xd0" : "=a" (lo), "=d" (hi) : "c" (0));
+
+	return lo;
+}
+#else
+#include <intrin.h>
+#include <immintrin.h>
+
+static inline void CPUidEx(int index, int subIndex, int *a, int *b, int *c, int *d) {
+	int info[4] = { };
+
+	__cpuidex(info, index, subIndex);
+
+	*a = info[0];
+	*b = info[1];
+	*c = info[2];
+	*d = info[3];
+}
+
+static inline unsigned int GetXCR0() {
+	return (unsigned int)_xgetbv(0);
+}
+#endif
+
+#define c_FMA3		(1 << 12)
+#define c_OSXSAVE	(1 << 27)
+#define c_AVX		(1 << 28)
+#define b_AVX2		(1 << 5)
+#define XCR0_XMM	(1 << 1)
+#define XCR0_YMM	(1 << 2)
+
+/*
+================
+HasAVXState
+
+the YMM registers can only be used if the OS saves them on context switches
+================
+*/
+static inline bool HasAVXState() {
+	int a, b, c, d;
+
+	CPUidEx(0, 0, &a, &b, &c, &d);
+	if (a < 1)
+		return false;
+
+	CPUidEx(1, 0, &a, &b, &c, &d);
+	if ((c & (c_OSXSAVE | c_AVX)) != (c_OSXSAVE | c_AVX))
+		return false;
+
+	return (GetXCR0() & (XCR0_XMM | XCR0_YMM)) == (XCR0_XMM | XCR0_YMM);
+}
+
+static inline bool HasAVX2() {
+	int a, b, c, d;
+
+	if (!HasAVXState())
+		return false;
+
+	CPUidEx(0, 0, &a, &b, &c, &d);
+	if (a < 7)
+		return false;
+
+	CPUidEx(7, 0, &a, &b, &c, &d);
+
+	return (b & b_AVX2) == b_AVX2;
+}
+
+static inline bool HasFMA3() {
+	int a, b, c, d;
+
+	if (!HasAVXState())
+		return false;
+
+	CPUidEx(1, 0, &a, &b, &c, &d);
+
+	return (c & c_FMA3) == c_FMA3;
+}
+
+#define HAS_AVX2_DETECTION
+#endif
+
 /*
 ================
 Sys_GetProcessorId
@@ -218,6 +319,14 @@ int Sys_GetProcessorId( void ) {
 		flags |= CPUID_SSE3;
 #endif
 
+#ifdef HAS_AVX2_DETECTION
+	if (HasAVX2())
+		flags |= CPUID_AVX2;
+
+	if (HasFMA3())
+		flags |= CPUID_FMA3;
+#endif
+
 	return flags;
 }
 
@@ -1157,6 +1157,158 @@ void GLimp_DeactivateContext() {
 	common->DPrintf("TODO: GLimp_DeactivateContext\n");
 }
 
+/*
+===========================================================
+
+r_smp render thread
+
+===========================================================
+*/
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+static SDL_GLContext	smpContext = NULL;
+#endif
+static xthreadInfo		renderThread = { };
+static void				(*renderThreadFunction)( void ) = NULL;
+static void *			smpData = NULL;
+static bool				smpFrontEndWaiting = false;	// only used by the main thread
+static bool				smpBackEndWorking = false;	// only used by the render thread
+
+// TRIGGER_EVENT_ZERO and TRIGGER_EVENT_ONE are used by the file system and the async tics
+static const int		TRIGGER_EVENT_RENDER_WAKE = TRIGGER_EVENT_TWO;
+static const int		TRIGGER_EVENT_RENDER_DONE = TRIGGER_EVENT_THREE;
+
+/*
+===================
+GLimp_RenderThread
+===================
+*/
+static int GLimp_RenderThread( void *parms ) {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	SDL_GL_MakeCurrent( window, smpContext );
+
+	// the swap interval is part of the context state
+	GLimp_SetSwapInterval( r_swapInterval.GetInteger() );
+
+	renderThreadFunction();
+
+	SDL_GL_MakeCurrent( window, NULL );
+#endif
+	return 0;
+}
+
+/*
+===================
+GLimp_SpawnRenderThread
+===================
+*/
+bool GLimp_SpawnRenderThread( void (*function)( void ) ) {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	if ( !window || !context ) {
+		return false;
+	}
+
+	if ( renderThread.threadHandle ) {
+		common->Warning( "GLimp_SpawnRenderThread: render thread is already running" );
+		return false;
+	}
+
+	// the main context stays current on the main thread, the front end
+	// still uploads vertex caches and images with it
+	SDL_GL_SetAttribute( SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1 );
+	smpContext = SDL_GL_CreateContext( window );
+	SDL_GL_SetAttribute( SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0 );
+
+	// creating a context makes it current
+	SDL_GL_MakeCurrent( window, context );
+
+	if ( !smpContext ) {
+		common->Warning( "GLimp_SpawnRenderThread: couldn't create a shared context: %s", SDL_GetError() );
+		return false;
+	}
+
+	renderThreadFunction = function;
+	smpData = NULL;
+	smpFrontEndWaiting = false;
+	smpBackEndWorking = false;
+
+	Sys_CreateThread( GLimp_RenderThread, NULL, renderThread, "renderBackEnd" );
+
+	return true;
+#else
+	// SDL1.2 can't create a second context
+	return false;
+#endif
+}
+
+/*
+===================
+GLimp_ShutdownRenderThread
+===================
+*/
+void GLimp_ShutdownRenderThread( void ) {
+	if ( !renderThread.threadHandle ) {
+		return;
+	}
+
+	GLimp_WakeBackEnd( NULL );
+	Sys_DestroyThread( renderThread );
+
+	renderThreadFunction = NULL;
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	SDL_GL_DeleteContext( smpContext );
+	smpContext = NULL;
+#endif
+}
+
+/*
+===================
+GLimp_BackEndSleep
+
+Called by the render thread, returns the data of the next GLimp_WakeBackEnd()
+===================
+*/
+void *GLimp_BackEndSleep( void ) {
+	if ( smpBackEndWorking ) {
+		smpBackEndWorking = false;
+		Sys_TriggerEvent( TRIGGER_EVENT_RENDER_DONE );
+	}
+
+	Sys_WaitForEvent( TRIGGER_EVENT_RENDER_WAKE );
+
+	void *data = smpData;
+	smpBackEndWorking = ( data != NULL );
+	return data;
+}
+
+/*
+===================
+GLimp_FrontEndSleep
+===================
+*/
+void GLimp_FrontEndSleep( void ) {
+	if ( smpFrontEndWaiting ) {
+		Sys_WaitForEvent( TRIGGER_EVENT_RENDER_DONE );
+		smpFrontEndWaiting = false;
+	}
+}
+
+/*
+===================
+GLimp_WakeBackEnd
+
+NULL data makes the render thread exit without signalling back
+===================
+*/
+void GLimp_WakeBackEnd( void *data ) {
+	GLimp_FrontEndSleep();
+
+	smpData = data;
+	smpFrontEndWaiting = ( data != NULL );
+	Sys_TriggerEvent( TRIGGER_EVENT_RENDER_WAKE );
+}
+
 /*
 ===================
 GLimp_ExtensionPointer
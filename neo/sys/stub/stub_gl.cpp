@@ -395,6 +395,11 @@ void GLimp_ResetGamma() {}
 bool GLimp_SetScreenParms(glimpParms_t parms, bool) { return true; };
 void GLimp_Shutdown() {};
 void GLimp_SwapBuffers() {};
+bool GLimp_SpawnRenderThread( void (*function)( void ) ) { return false; }
+void GLimp_ShutdownRenderThread() {}
+void *GLimp_BackEndSleep() { return NULL; }
+void GLimp_FrontEndSleep() {}
+void GLimp_WakeBackEnd( void *data ) {}
 void GLimp_ActivateContext() {};
 void GLimp_DeactivateContext() {};
 void GLimp_GrabInput(int flags) {};
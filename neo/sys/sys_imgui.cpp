@@ -586,6 +586,11 @@ bool ShouldShowCursor()
 	}
 }
 
+bool IsFramePending()
+{
+	return haveNewFrame || openImguiWindows != 0;
+}
+
 void EndFrame()
 {
 	if (openImguiWindows == 0 && !haveNewFrame)
@@ -74,6 +74,11 @@ extern void NewFrame();
 // renders ImGui menus then
 extern void EndFrame();
 
+// returns true if the next EndFrame() will render something. the ImGui frame
+// is built on the main thread, so with r_smp the render thread must be done
+// with it before the next NewFrame()
+extern bool IsFramePending();
+
 extern float GetScale();
 extern void SetScale( float scale );
 
@@ -130,6 +135,8 @@ inline void NewFrame() {}
 
 inline void EndFrame() {}
 
+inline bool IsFramePending() { return false; }
+
 inline void OpenWindow( D3ImGuiWindow win ) {}
 
 inline void CloseWindow( D3ImGuiWindow win ) {}
@@ -43,6 +43,8 @@ public:
 	virtual void			DebugVPrintf( const char *fmt, va_list arg );
 
 	virtual unsigned int	GetMilliseconds( void );
+	virtual double			GetClockTicks( void );
+	virtual double			ClockTicksPerSecond( void );
 	virtual int				GetProcessorId( void );
 	virtual void			FPU_SetFTZ( bool enable );
 	virtual void			FPU_SetDAZ( bool enable );
@@ -39,6 +39,8 @@ typedef enum {
 	CPUID_SSE							= 0x00040,	// Streaming SIMD Extensions
 	CPUID_SSE2							= 0x00080,	// Streaming SIMD Extensions 2
 	CPUID_SSE3							= 0x00100,	// Streaming SIMD Extentions 3 aka Prescott's New Instructions
+	CPUID_AVX2							= 0x00200,	// Advanced Vector Extensions 2 (only set if the OS saves the YMM state)
+	CPUID_FMA3							= 0x00400,	// Fused Multiply-Add with three operands
 } cpuidSimd_t;
 
 typedef enum {
@@ -161,6 +163,10 @@ void			Sys_Sleep( int msec );
 // any game related timing information should come from event timestamps
 unsigned int	Sys_Milliseconds( void );
 
+// high resolution clock ticks, should only be used for profiling purposes
+double			Sys_GetClockTicks( void );
+double			Sys_ClockTicksPerSecond( void );
+
 // returns a selection of the CPUID_* flags
 int				Sys_GetProcessorId( void );
 
@@ -422,6 +428,9 @@ enum {
 void				Sys_EnterCriticalSection( int index = CRITICAL_SECTION_ZERO );
 void				Sys_LeaveCriticalSection( int index = CRITICAL_SECTION_ZERO );
 
+// atomically adds to *value and returns the new value
+int					Sys_InterlockedAdd( volatile int *value, int add );
+
 const int MAX_TRIGGER_EVENTS		= 4;
 
 enum {
@@ -434,6 +443,66 @@ enum {
 void				Sys_WaitForEvent( int index = TRIGGER_EVENT_ZERO );
 void				Sys_TriggerEvent( int index = TRIGGER_EVENT_ZERO );
 
+/*
+==============================================================
+
+	Job system
+
+	Jobs are added to a group and run by a pool of worker threads.
+	Every worker owns a deque, jobs added by a worker go to the back
+	of its own deque, jobs added by any other thread go to a shared
+	queue. Idle workers steal from the front of the other queues.
+
+	Wait() runs queued jobs on the calling thread until the group is
+	done, so it's fine to wait from inside a job.
+
+	ParallelFor() always splits the range into the same batches, no
+	matter how many workers are running, so results don't depend on
+	the machine as long as every batch writes to its own output.
+	With sys_jobWorkers 0 everything runs on the calling thread in
+	submission order.
+
+==============================================================
+*/
+
+const int MAX_JOB_WORKERS			= 8;
+const int MAX_JOB_GROUPS			= 64;
+
+typedef void (*jobRun_t)( void *data );
+typedef void (*jobRange_t)( void *data, int first, int last );	// runs [first, last)
+
+typedef int jobGroupHandle_t;
+
+const jobGroupHandle_t INVALID_JOB_GROUP = -1;
+
+class idJobSystem {
+public:
+	virtual					~idJobSystem( void ) {}
+
+	virtual void			Init( void ) = 0;
+	virtual void			Shutdown( void ) = 0;
+
+							// number of worker threads, 0 if jobs run on the calling thread
+	virtual int				GetNumWorkers( void ) const = 0;
+							// 1 to GetNumWorkers() on a worker thread, 0 on any other thread
+	virtual int				GetThreadIndex( void ) const = 0;
+
+							// the name isn't copied
+	virtual jobGroupHandle_t AllocGroup( const char *name ) = 0;
+							// waits for any jobs still in the group
+	virtual void			FreeGroup( jobGroupHandle_t group ) = 0;
+
+	virtual void			AddJob( jobGroupHandle_t group, jobRun_t function, void *data ) = 0;
+	virtual void			AddRangeJob( jobGroupHandle_t group, jobRange_t function, void *data, int first, int last ) = 0;
+	virtual bool			IsDone( jobGroupHandle_t group ) = 0;
+	virtual void			Wait( jobGroupHandle_t group ) = 0;
+
+							// calls function on batches of at most granularity items and waits for all of them
+	virtual void			ParallelFor( int count, int granularity, jobRange_t function, void *data ) = 0;
+};
+
+extern idJobSystem *		jobSystem;
+
 /*
 ==============================================================
 
@@ -448,6 +517,8 @@ public:
 	virtual void			DebugVPrintf( const char *fmt, va_list arg ) = 0;
 
 	virtual unsigned int	GetMilliseconds( void ) = 0;
+	virtual double			GetClockTicks( void ) = 0;
+	virtual double			ClockTicksPerSecond( void ) = 0;
 	virtual int				GetProcessorId( void ) = 0;
 	virtual void			FPU_SetFTZ( bool enable ) = 0;
 	virtual void			FPU_SetDAZ( bool enable ) = 0;
@@ -86,6 +86,37 @@ unsigned int Sys_Milliseconds() {
 	return SDL_GetTicks();
 }
 
+/*
+================
+Sys_GetClockTicks
+================
+*/
+double Sys_GetClockTicks() {
+#if SDL_MAJOR_VERSION < 2
+	return (double)SDL_GetTicks();
+#else
+	return (double)SDL_GetPerformanceCounter();
+#endif
+}
+
+/*
+================
+Sys_ClockTicksPerSecond
+================
+*/
+double Sys_ClockTicksPerSecond() {
+	static double ticks = 0.0;
+
+	if ( !ticks ) {
+#if SDL_MAJOR_VERSION < 2
+		ticks = 1000.0;
+#else
+		ticks = (double)SDL_GetPerformanceFrequency();
+#endif
+	}
+	return ticks;
+}
+
 /*
 ==================
 Sys_InitThreads
@@ -192,6 +223,29 @@ void Sys_LeaveCriticalSection(int index) {
 #endif
 }
 
+/*
+==================
+Sys_InterlockedAdd
+
+returns the new value
+==================
+*/
+int Sys_InterlockedAdd(volatile int *value, int add) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+	return SDL_AddAtomicInt((SDL_AtomicInt *)value, add) + add;
+#elif SDL_VERSION_ATLEAST(2, 0, 2)
+	return SDL_AtomicAdd((SDL_atomic_t *)value, add) + add;
+#else // SDL1.2 has no atomics
+	int result;
+
+	Sys_EnterCriticalSection(CRITICAL_SECTION_SYS);
+	result = *value += add;
+	Sys_LeaveCriticalSection(CRITICAL_SECTION_SYS);
+
+	return result;
+#endif
+}
+
 /*
 ======================================================
 wait and trigger events
@@ -372,3 +426,526 @@ bool Sys_IsMainThread() {
 	// any threads yet so it should be the main thread
 	return true;
 }
+
+/*
+===========================================================
+
+job system
+
+===========================================================
+*/
+
+#if SDL_MAJOR_VERSION >= 3
+  #define SDL_CondBroadcast SDL_BroadcastCondition
+#endif
+
+idCVar sys_jobWorkers( "sys_jobWorkers", "-1", CVAR_SYSTEM | CVAR_INTEGER | CVAR_INIT, "number of job worker threads, -1 = one less than the number of cores, 0 = run all jobs on the calling thread", -1, MAX_JOB_WORKERS );
+
+const int JOB_QUEUE_SIZE = 1024;	// power of two
+
+typedef struct {
+	jobRun_t		run;
+	jobRange_t		range;
+	void *			data;
+	int				first;
+	int				last;
+	int				group;
+} job_t;
+
+typedef struct {
+	SDL_mutex *		lock;
+	job_t			jobs[JOB_QUEUE_SIZE];
+	int				head;			// other threads steal from the front
+	int				tail;			// the owner pushes and pops at the back
+} jobQueue_t;
+
+typedef struct {
+	const char *	name;
+	int				pending;		// added but not finished yet
+	bool			inUse;
+} jobGroup_t;
+
+class idJobSystemLocal : public idJobSystem {
+public:
+							idJobSystemLocal( void );
+
+	virtual void			Init( void );
+	virtual void			Shutdown( void );
+
+	virtual int				GetNumWorkers( void ) const;
+	virtual int				GetThreadIndex( void ) const;
+
+	virtual jobGroupHandle_t AllocGroup( const char *name );
+	virtual void			FreeGroup( jobGroupHandle_t group );
+
+	virtual void			AddJob( jobGroupHandle_t group, jobRun_t function, void *data );
+	virtual void			AddRangeJob( jobGroupHandle_t group, jobRange_t function, void *data, int first, int last );
+	virtual bool			IsDone( jobGroupHandle_t group );
+	virtual void			Wait( jobGroupHandle_t group );
+
+	virtual void			ParallelFor( int count, int granularity, jobRange_t function, void *data );
+
+private:
+	bool					initialized;
+	bool					quit;
+	int						numWorkers;
+
+	// groups, numQueued, numWaiting and quit are protected by jobLock
+	SDL_mutex *				jobLock;
+	SDL_cond *				wakeCond;		// idle workers sleep on this
+	SDL_cond *				doneCond;		// threads in Wait() sleep on this
+	int						numQueued;
+	int						numWaiting;
+	jobGroup_t				groups[MAX_JOB_GROUPS];
+
+	// queue 0 is shared by all threads that aren't workers
+	jobQueue_t				queues[MAX_JOB_WORKERS + 1];
+
+	xthreadInfo				threads[MAX_JOB_WORKERS];
+	SDL_threadID			threadIds[MAX_JOB_WORKERS];		// set by the workers themselves
+	int						threadIndex[MAX_JOB_WORKERS];
+	char					threadNames[MAX_JOB_WORKERS][16];
+
+	void					QueueJob( const job_t &job );
+	bool					GetJob( int queue, job_t &job );
+	void					RunJob( const job_t &job );
+
+	static int				WorkerThread( void *parms );
+};
+
+static idJobSystemLocal		jobSystemLocal;
+idJobSystem *				jobSystem = &jobSystemLocal;
+
+/*
+==================
+idJobSystemLocal::idJobSystemLocal
+==================
+*/
+idJobSystemLocal::idJobSystemLocal( void ) {
+	initialized = false;
+	quit = false;
+	numWorkers = 0;
+	jobLock = NULL;
+	wakeCond = NULL;
+	doneCond = NULL;
+	numQueued = 0;
+	numWaiting = 0;
+	memset( groups, 0, sizeof( groups ) );
+	memset( queues, 0, sizeof( queues ) );
+	memset( threads, 0, sizeof( threads ) );
+	memset( threadIds, 0, sizeof( threadIds ) );
+	memset( threadIndex, 0, sizeof( threadIndex ) );
+	memset( threadNames, 0, sizeof( threadNames ) );
+}
+
+/*
+==================
+idJobSystemLocal::Init
+==================
+*/
+void idJobSystemLocal::Init( void ) {
+	if ( initialized ) {
+		return;
+	}
+
+	jobLock = SDL_CreateMutex();
+	wakeCond = SDL_CreateCond();
+	doneCond = SDL_CreateCond();
+	for ( int i = 0; i <= MAX_JOB_WORKERS; i++ ) {
+		queues[i].lock = SDL_CreateMutex();
+		queues[i].head = queues[i].tail = 0;
+	}
+	if ( !jobLock || !wakeCond || !doneCond ) {
+		common->FatalError( "idJobSystem::Init: couldn't create the job locks: %s", SDL_GetError() );
+	}
+
+	quit = false;
+	numQueued = 0;
+	numWaiting = 0;
+	memset( groups, 0, sizeof( groups ) );
+	initialized = true;
+
+	numWorkers = sys_jobWorkers.GetInteger();
+	if ( numWorkers < 0 ) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+		numWorkers = SDL_GetNumLogicalCPUCores() - 1;
+#elif SDL_VERSION_ATLEAST(2, 0, 0)
+		numWorkers = SDL_GetCPUCount() - 1;
+#else
+		numWorkers = 0;
+#endif
+	}
+	numWorkers = idMath::ClampInt( 0, MAX_JOB_WORKERS, numWorkers );
+
+	for ( int i = 0; i < numWorkers; i++ ) {
+		threadIndex[i] = i + 1;
+		threadIds[i] = 0;
+		idStr::snPrintf( threadNames[i], sizeof( threadNames[i] ), "jobWorker%d", i + 1 );
+		Sys_CreateThread( WorkerThread, &threadIndex[i], threads[i], threadNames[i] );
+	}
+
+	common->Printf( "%d job worker thread%s\n", numWorkers, numWorkers == 1 ? "" : "s" );
+}
+
+/*
+==================
+idJobSystemLocal::Shutdown
+==================
+*/
+void idJobSystemLocal::Shutdown( void ) {
+	if ( !initialized ) {
+		return;
+	}
+
+	// the workers finish everything that is still queued
+	SDL_LockMutex( jobLock );
+	quit = true;
+	SDL_CondBroadcast( wakeCond );
+	SDL_UnlockMutex( jobLock );
+
+	for ( int i = 0; i < numWorkers; i++ ) {
+		Sys_DestroyThread( threads[i] );
+		threadIds[i] = 0;
+	}
+	numWorkers = 0;
+
+	for ( int i = 0; i <= MAX_JOB_WORKERS; i++ ) {
+		SDL_DestroyMutex( queues[i].lock );
+		queues[i].lock = NULL;
+	}
+	SDL_DestroyCond( doneCond );
+	SDL_DestroyCond( wakeCond );
+	SDL_DestroyMutex( jobLock );
+	doneCond = NULL;
+	wakeCond = NULL;
+	jobLock = NULL;
+
+	initialized = false;
+}
+
+/*
+==================
+idJobSystemLocal::GetNumWorkers
+==================
+*/
+int idJobSystemLocal::GetNumWorkers( void ) const {
+	return numWorkers;
+}
+
+/*
+==================
+idJobSystemLocal::GetThreadIndex
+==================
+*/
+int idJobSystemLocal::GetThreadIndex( void ) const {
+	SDL_threadID id = SDL_ThreadID();
+
+	for ( int i = 0; i < numWorkers; i++ ) {
+		if ( threadIds[i] == id ) {
+			return i + 1;
+		}
+	}
+	return 0;
+}
+
+/*
+==================
+idJobSystemLocal::AllocGroup
+==================
+*/
+jobGroupHandle_t idJobSystemLocal::AllocGroup( const char *name ) {
+	assert( initialized );
+
+	SDL_LockMutex( jobLock );
+	for ( int i = 0; i < MAX_JOB_GROUPS; i++ ) {
+		if ( !groups[i].inUse ) {
+			groups[i].name = name;
+			groups[i].pending = 0;
+			groups[i].inUse = true;
+			SDL_UnlockMutex( jobLock );
+			return i;
+		}
+	}
+	SDL_UnlockMutex( jobLock );
+
+	common->FatalError( "idJobSystem::AllocGroup: MAX_JOB_GROUPS hit allocating '%s'", name );
+	return INVALID_JOB_GROUP;
+}
+
+/*
+==================
+idJobSystemLocal::FreeGroup
+==================
+*/
+void idJobSystemLocal::FreeGroup( jobGroupHandle_t group ) {
+	if ( group == INVALID_JOB_GROUP ) {
+		return;
+	}
+	assert( group >= 0 && group < MAX_JOB_GROUPS && groups[group].inUse );
+
+	Wait( group );
+
+	SDL_LockMutex( jobLock );
+	groups[group].name = NULL;
+	groups[group].inUse = false;
+	SDL_UnlockMutex( jobLock );
+}
+
+/*
+==================
+idJobSystemLocal::QueueJob
+
+Runs the job right away if there are no workers or the queue is full
+==================
+*/
+void idJobSystemLocal::QueueJob( const job_t &job ) {
+	assert( job.group >= 0 && job.group < MAX_JOB_GROUPS && groups[job.group].inUse );
+
+	if ( numWorkers == 0 ) {
+		if ( job.run ) {
+			job.run( job.data );
+		} else {
+			job.range( job.data, job.first, job.last );
+		}
+		return;
+	}
+
+	// count the job before it can be seen, so Wait() can't miss it
+	SDL_LockMutex( jobLock );
+	groups[job.group].pending++;
+	SDL_UnlockMutex( jobLock );
+
+	jobQueue_t &queue = queues[GetThreadIndex()];
+	bool queued = false;
+
+	SDL_LockMutex( queue.lock );
+	if ( queue.tail - queue.head < JOB_QUEUE_SIZE ) {
+		queue.jobs[queue.tail & ( JOB_QUEUE_SIZE - 1 )] = job;
+		queue.tail++;
+		queued = true;
+	}
+	SDL_UnlockMutex( queue.lock );
+
+	if ( !queued ) {
+		RunJob( job );
+		return;
+	}
+
+	SDL_LockMutex( jobLock );
+	numQueued++;
+	if ( numWaiting > 0 ) {
+		// threads in Wait() help out as well
+		SDL_CondBroadcast( doneCond );
+	}
+	SDL_CondSignal( wakeCond );
+	SDL_UnlockMutex( jobLock );
+}
+
+/*
+==================
+idJobSystemLocal::GetJob
+
+Pops the newest job of our own queue, or steals the oldest job of another one
+==================
+*/
+bool idJobSystemLocal::GetJob( int queueNum, job_t &job ) {
+	const int numQueues = numWorkers + 1;
+	bool found = false;
+
+	for ( int i = 0; i < numQueues && !found; i++ ) {
+		jobQueue_t &queue = queues[( queueNum + i ) % numQueues];
+
+		SDL_LockMutex( queue.lock );
+		if ( queue.tail != queue.head ) {
+			if ( i == 0 ) {
+				queue.tail--;
+				job = queue.jobs[queue.tail & ( JOB_QUEUE_SIZE - 1 )];
+			} else {
+				job = queue.jobs[queue.head & ( JOB_QUEUE_SIZE - 1 )];
+				queue.head++;
+			}
+			if ( queue.tail == queue.head ) {
+				queue.tail = queue.head = 0;
+			}
+			found = true;
+		}
+		SDL_UnlockMutex( queue.lock );
+	}
+
+	if ( found ) {
+		SDL_LockMutex( jobLock );
+		numQueued--;
+		SDL_UnlockMutex( jobLock );
+	}
+
+	return found;
+}
+
+/*
+==================
+idJobSystemLocal::RunJob
+==================
+*/
+void idJobSystemLocal::RunJob( const job_t &job ) {
+	if ( job.run ) {
+		job.run( job.data );
+	} else {
+		job.range( job.data, job.first, job.last );
+	}
+
+	SDL_LockMutex( jobLock );
+	if ( --groups[job.group].pending == 0 && numWaiting > 0 ) {
+		SDL_CondBroadcast( doneCond );
+	}
+	SDL_UnlockMutex( jobLock );
+}
+
+/*
+==================
+idJobSystemLocal::AddJob
+==================
+*/
+void idJobSystemLocal::AddJob( jobGroupHandle_t group, jobRun_t function, void *data ) {
+	job_t job;
+
+	job.run = function;
+	job.range = NULL;
+	job.data = data;
+	job.first = 0;
+	job.last = 0;
+	job.group = group;
+
+	QueueJob( job );
+}
+
+/*
+==================
+idJobSystemLocal::AddRangeJob
+==================
+*/
+void idJobSystemLocal::AddRangeJob( jobGroupHandle_t group, jobRange_t function, void *data, int first, int last ) {
+	job_t job;
+
+	job.run = NULL;
+	job.range = function;
+	job.data = data;
+	job.first = first;
+	job.last = last;
+	job.group = group;
+
+	QueueJob( job );
+}
+
+/*
+==================
+idJobSystemLocal::IsDone
+==================
+*/
+bool idJobSystemLocal::IsDone( jobGroupHandle_t group ) {
+	assert( group >= 0 && group < MAX_JOB_GROUPS && groups[group].inUse );
+
+	SDL_LockMutex( jobLock );
+	bool done = ( groups[group].pending == 0 );
+	SDL_UnlockMutex( jobLock );
+
+	return done;
+}
+
+/*
+==================
+idJobSystemLocal::Wait
+
+Runs queued jobs of any group until this one is done
+==================
+*/
+void idJobSystemLocal::Wait( jobGroupHandle_t group ) {
+	assert( group >= 0 && group < MAX_JOB_GROUPS && groups[group].inUse );
+
+	if ( numWorkers == 0 ) {
+		return;
+	}
+
+	const int queueNum = GetThreadIndex();
+	job_t job;
+
+	while ( 1 ) {
+		if ( IsDone( group ) ) {
+			break;
+		}
+
+		if ( GetJob( queueNum, job ) ) {
+			RunJob( job );
+			continue;
+		}
+
+		// the remaining jobs are running on other threads
+		SDL_LockMutex( jobLock );
+		numWaiting++;
+		while ( groups[group].pending > 0 && numQueued <= 0 ) {
+			SDL_CondWait( doneCond, jobLock );
+		}
+		numWaiting--;
+		SDL_UnlockMutex( jobLock );
+	}
+}
+
+/*
+==================
+idJobSystemLocal::ParallelFor
+==================
+*/
+void idJobSystemLocal::ParallelFor( int count, int granularity, jobRange_t function, void *data ) {
+	if ( count <= 0 ) {
+		return;
+	}
+	if ( granularity < 1 ) {
+		granularity = 1;
+	}
+
+	// the batches are the same with or without workers
+	if ( numWorkers == 0 || count <= granularity ) {
+		for ( int first = 0; first < count; first += granularity ) {
+			function( data, first, Min( first + granularity, count ) );
+		}
+		return;
+	}
+
+	jobGroupHandle_t group = AllocGroup( "parallelFor" );
+	for ( int first = 0; first < count; first += granularity ) {
+		AddRangeJob( group, function, data, first, Min( first + granularity, count ) );
+	}
+	FreeGroup( group );
+}
+
+/*
+==================
+idJobSystemLocal::WorkerThread
+==================
+*/
+int idJobSystemLocal::WorkerThread( void *parms ) {
+	idJobSystemLocal &js = jobSystemLocal;
+	const int index = *(int *)parms;
+	job_t job;
+
+	js.threadIds[index - 1] = SDL_ThreadID();
+
+	while ( 1 ) {
+		if ( js.GetJob( index, job ) ) {
+			js.RunJob( job );
+			continue;
+		}
+
+		SDL_LockMutex( js.jobLock );
+		while ( js.numQueued <= 0 && !js.quit ) {
+			SDL_CondWait( js.wakeCond, js.jobLock );
+		}
+		bool done = ( js.quit && js.numQueued <= 0 );
+		SDL_UnlockMutex( js.jobLock );
+
+		if ( done ) {
+			break;
+		}
+	}
+
+	return 0;
+}